@@ -76,7 +76,10 @@ static eOresult_t s_eon_mutex_delete(void *p);
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EONmutex";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EONmutex";
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -78,7 +78,10 @@ static eOid08_t s_eov_task_dummy_get_id(void *tsk);
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOVtask";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOVtask";
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -72,8 +72,10 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
-// commented out as it is not used
-//static const char s_eobj_ownname[] = "EOaction";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOaction";
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
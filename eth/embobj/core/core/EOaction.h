@@ -72,7 +72,12 @@ typedef enum
 typedef struct EOaction_hid EOaction;
 
 
+// the callback variant holds three pointers, thus the size depends on the width of the pointers
+#if     defined(UINTPTR_MAX) && (UINTPTR_MAX > 0xffffffffu)
+enum { EOaction_sizeof = 32 };
+#else
 enum { EOaction_sizeof = 16 };
+#endif
 typedef uint8_t EOaction_strg[EOaction_sizeof];
 
     
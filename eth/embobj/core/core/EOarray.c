@@ -70,7 +70,10 @@
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOarray";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOarray";
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
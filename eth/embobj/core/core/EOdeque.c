@@ -577,6 +577,116 @@ extern void eo_deque_hid_QuickPopFront(EOdeque * deque)
 }
 
 
+extern eOsizecntnr_t eo_deque_hid_PushBackSpan(EOdeque * deque, const void *p, eOsizecntnr_t number) 
+{
+    uint8_t *start = (uint8_t*) (deque->stored_items);
+    const uint8_t *src = (const uint8_t*)p;
+    // we use uint32_t because next + number can go beyond max eOsizecntnr_t
+    uint32_t n = deque->capacity - deque->size;
+    uint32_t chunk = 0;
+    uint32_t i = 0;
+    
+    n = (number < n) ? (number) : (n);
+    
+    if(NULL != deque->item_copy_fn)
+    {
+        for(i=0; i<n; i++)
+        {
+            deque->item_copy_fn(&start[(uint32_t)deque->next * deque->item_size], (void*)&src[i * deque->item_size]);
+            deque->next = (deque->next + 1) % (deque->capacity);
+        }
+    }
+    else
+    {   // from next to the end of the array and then from its start
+        chunk = deque->capacity - deque->next;
+        chunk = (n < chunk) ? (n) : (chunk);
+        memcpy(&start[(uint32_t)deque->next * deque->item_size], src, chunk * deque->item_size);
+        memcpy(start, &src[chunk * deque->item_size], (n - chunk) * deque->item_size);
+        deque->next = (eOsizecntnr_t)((deque->next + n) % deque->capacity);
+    }
+    
+    deque->size += n;
+    
+    return((eOsizecntnr_t)n); 
+}
+
+
+extern eOsizecntnr_t eo_deque_hid_PopFrontSpan(EOdeque * deque, void *p, eOsizecntnr_t number) 
+{
+    uint8_t *start = (uint8_t*) (deque->stored_items);
+    uint8_t *dst = (uint8_t*)p;
+    uint8_t *item = NULL;
+    uint32_t n = (number < deque->size) ? (number) : (deque->size);
+    uint32_t chunk = 0;
+    uint32_t i = 0;
+    
+    if((NULL != deque->item_copy_fn) || (NULL != deque->item_clear_fn))
+    {
+        for(i=0; i<n; i++)
+        {
+            item = &start[(uint32_t)deque->first * deque->item_size];
+            if(NULL != dst)
+            {
+                if(NULL != deque->item_copy_fn)
+                {
+                    deque->item_copy_fn(&dst[i * deque->item_size], item);
+                }
+                else
+                {
+                    s_eo_deque_default_copy(&dst[i * deque->item_size], item, deque);
+                }
+            }
+            if(NULL != deque->item_clear_fn) 
+            {
+                deque->item_clear_fn(item);
+            } 
+            else 
+            {
+                s_eo_deque_default_clear(item, deque);
+            }
+            deque->first = (deque->first + 1) % (deque->capacity);
+        }
+    }
+    else
+    {   // from first to the end of the array and then from its start
+        chunk = deque->capacity - deque->first;
+        chunk = (n < chunk) ? (n) : (chunk);
+        item = &start[(uint32_t)deque->first * deque->item_size];
+        if(NULL != dst)
+        {
+            memcpy(dst, item, chunk * deque->item_size);
+            memcpy(&dst[chunk * deque->item_size], start, (n - chunk) * deque->item_size);
+        }
+#if !defined(EODEQUE_DEFAULTCLEAR_DOES_NOTHING)
+        memset(item, 0, chunk * deque->item_size);
+        memset(start, 0, (n - chunk) * deque->item_size);
+#endif        
+        deque->first = (eOsizecntnr_t)((deque->first + n) % deque->capacity);
+    }
+    
+    deque->size -= n;
+    
+    return((eOsizecntnr_t)n); 
+}
+
+
+extern void * eo_deque_hid_FrontSpan(EOdeque * deque, eOsizecntnr_t *number) 
+{
+    uint8_t *start = (uint8_t*) (deque->stored_items);
+    uint32_t chunk = deque->capacity - deque->first;
+    
+    if(0 == deque->size) 
+    {
+        *number = 0;
+        return(NULL);     
+    }
+    
+    *number = (eOsizecntnr_t)((deque->size < chunk) ? (deque->size) : (chunk));
+    
+    return(&start[(uint32_t)deque->first * deque->item_size]);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -72,6 +72,14 @@ struct EOdeque_hid
 
 extern void eo_deque_hid_QuickPopFront(EOdeque * deque);
 
+// they move up to number items with at most two memcpy() around the end of the array (one by one if item_copy_fn is 
+// not NULL) and return the number of moved items. in eo_deque_hid_PopFrontSpan() p can be NULL. 
+extern eOsizecntnr_t eo_deque_hid_PushBackSpan(EOdeque * deque, const void *p, eOsizecntnr_t number);
+extern eOsizecntnr_t eo_deque_hid_PopFrontSpan(EOdeque * deque, void *p, eOsizecntnr_t number);
+
+// it returns the front item and in number how many items follow it without crossing the end of the array, or NULL
+extern void * eo_deque_hid_FrontSpan(EOdeque * deque, eOsizecntnr_t *number);
+
 
 #ifdef __cplusplus
 }       // closing brace for extern "C"
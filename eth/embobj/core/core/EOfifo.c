@@ -48,7 +48,17 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the lock-free modes use the __atomic builtins of gcc (and clang)
+#if     defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#define EOFIFO_USE_ATOMICS
+#define EOFIFO_LOAD_RELAXED(p)          __atomic_load_n((p), __ATOMIC_RELAXED)
+#define EOFIFO_LOAD_ACQUIRE(p)          __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define EOFIFO_STORE_RELEASE(p, v)      __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define EOFIFO_CAS(p, pexp, v)          __atomic_compare_exchange_n((p), (pexp), (v), 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#endif
+
+#define EOFIFO_RING_MAXCAPACITY         32768
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -67,7 +77,20 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static eOfifo_ring_t * s_eo_fifo_ring_new(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                          eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                          eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                                          eOfifo_mode_t mode);
+static void s_eo_fifo_ring_delete(eOfifo_ring_t *ring);
+static eOsizecntnr_t s_eo_fifo_ring_size(eOfifo_ring_t *ring);
+static eOsizecntnr_t s_eo_fifo_ring_put(eOfifo_ring_t *ring, const uint8_t *items, eOsizecntnr_t number);
+static eOsizecntnr_t s_eo_fifo_ring_getrem(eOfifo_ring_t *ring, uint8_t *items, eOsizecntnr_t number);
+static const void * s_eo_fifo_ring_front(eOfifo_ring_t *ring);
+static const void * s_eo_fifo_ring_frontspan(eOfifo_ring_t *ring, eOsizecntnr_t *number);
+
+static eOresult_t s_eo_fifo_take(EOfifo *fifo, eOreltime_t tout);
+static void s_eo_fifo_release(EOfifo *fifo);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -86,6 +109,15 @@ extern EOfifo * eo_fifo_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                             eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
                             eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
                             EOVmutexDerived *mutex) 
+{
+    return(eo_fifo_NewExt(item_size, capacity, item_init, init_arg, item_copy, item_clear, mutex, eo_fifo_mode_locked));
+}
+
+
+extern EOfifo * eo_fifo_NewExt(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                               eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                               eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                               EOVmutexDerived *mutex, eOfifo_mode_t mode)
 {
     EOfifo *retptr = NULL; 
     
@@ -95,11 +127,22 @@ extern EOfifo * eo_fifo_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     eo_errman_Assert(eo_errman_GetHandle(), (0 != item_size), "eo_fifo_New(): 0 item_size", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
     eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity), "eo_fifo_New(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
     
-    // now i fill the mutexfifo with a deque 
-    retptr->dek = eo_deque_New(item_size, capacity, item_init, init_arg, item_copy, item_clear);
+    if(eo_fifo_mode_locked == mode)
+    {
+        // now i fill the mutexfifo with a deque 
+        retptr->dek = eo_deque_New(item_size, capacity, item_init, init_arg, item_copy, item_clear);
 
-    // now i copy the passed mutex into mutexfifo. beware for future use, ... it may be NULL
-    retptr->mutex = mutex;
+        // now i copy the passed mutex into mutexfifo. beware for future use, ... it may be NULL
+        retptr->mutex = mutex;
+        
+        retptr->ring = NULL;
+    }
+    else
+    {   // no deque and no mutex: the lock-free ring
+        retptr->dek = NULL;
+        retptr->mutex = NULL;
+        retptr->ring = s_eo_fifo_ring_new(item_size, capacity, item_init, init_arg, item_copy, item_clear, mode);
+    }
  
     // ok, done
     return(retptr);
@@ -112,6 +155,14 @@ extern void eo_fifo_Delete(EOfifo * fifo)
         return;    
     }   
     
+    if(NULL != fifo->ring)
+    {
+        s_eo_fifo_ring_delete(fifo->ring);
+        memset(fifo, 0, sizeof(EOfifo));    
+        eo_mempool_Delete(eo_mempool_GetHandle(), fifo);
+        return;
+    }
+    
     if(NULL == fifo->dek)
     {
         return;
@@ -150,6 +201,12 @@ extern eOresult_t eo_fifo_Capacity(EOfifo *fifo, eOsizecntnr_t *capacity, eOrelt
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        *capacity = fifo->ring->capacity;
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -188,6 +245,12 @@ extern eOresult_t eo_fifo_Size(EOfifo *fifo, eOsizecntnr_t *size, eOreltime_t to
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        *size = s_eo_fifo_ring_size(fifo->ring);
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -225,6 +288,11 @@ extern eOresult_t eo_fifo_Put(EOfifo *fifo, void *pitem, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        return((1 == s_eo_fifo_ring_put(fifo->ring, (const uint8_t*)pitem, 1)) ? (eores_OK) : (eores_NOK_busy));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -282,6 +350,16 @@ extern eOresult_t eo_fifo_Get(EOfifo *fifo, const void **ppitem, eOreltime_t tou
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {   // in mpmc another consumer could take the item while it is used
+        if(eo_fifo_mode_mpmc == fifo->ring->mode)
+        {
+            return(eores_NOK_unsupported);
+        }
+        *ppitem = s_eo_fifo_ring_front(fifo->ring);
+        return((NULL != *ppitem) ? (eores_OK) : (eores_NOK_nodata));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -333,6 +411,12 @@ extern eOresult_t eo_fifo_Rem(EOfifo *fifo, eOreltime_t tout) {
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        s_eo_fifo_ring_getrem(fifo->ring, NULL, 1);
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -371,6 +455,11 @@ extern eOresult_t eo_fifo_GetRem(EOfifo *fifo, void *pitem, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        return((1 == s_eo_fifo_ring_getrem(fifo->ring, (uint8_t*)pitem, 1)) ? (eores_OK) : (eores_NOK_nodata));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -449,6 +538,15 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {   // it removes what it finds. the producers can add meanwhile
+        while(0 != s_eo_fifo_ring_getrem(fifo->ring, NULL, fifo->ring->capacity))
+        {
+            ;
+        }
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -476,6 +574,147 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
 }
 
 
+extern eOresult_t eo_fifo_PutBatch(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+{
+    const uint8_t *item = (const uint8_t*)items;
+    eOsizecntnr_t n = 0;
+    
+    if(NULL != put)
+    {
+        *put = 0;
+    }
+    
+    if((NULL == fifo) || (NULL == items)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != fifo->ring)
+    {
+        n = s_eo_fifo_ring_put(fifo->ring, item, number);
+    }
+    else
+    {
+        if(eores_OK != s_eo_fifo_take(fifo, tout))
+        {
+            return(eores_NOK_timeout);
+        }
+        
+        n = eo_deque_hid_PushBackSpan(fifo->dek, item, number);
+        
+        s_eo_fifo_release(fifo);
+    }
+    
+    if(NULL != put)
+    {
+        *put = n;
+    }
+    
+    return((n == number) ? (eores_OK) : (eores_NOK_busy));
+}
+
+
+extern eOresult_t eo_fifo_GetRemBatch(EOfifo *fifo, void *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout)
+{
+    uint8_t *item = (uint8_t*)items;
+    eOsizecntnr_t n = 0;
+    
+    if(NULL != got)
+    {
+        *got = 0;
+    }
+    
+    if((NULL == fifo) || (NULL == items)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != fifo->ring)
+    {
+        n = s_eo_fifo_ring_getrem(fifo->ring, item, number);
+    }
+    else
+    {
+        if(eores_OK != s_eo_fifo_take(fifo, tout))
+        {
+            return(eores_NOK_timeout);
+        }
+        
+        n = eo_deque_hid_PopFrontSpan(fifo->dek, item, number);
+        
+        s_eo_fifo_release(fifo);
+    }
+    
+    if(NULL != got)
+    {
+        *got = n;
+    }
+    
+    return((0 != n) ? (eores_OK) : (eores_NOK_nodata));
+}
+
+
+extern eOresult_t eo_fifo_PeekBatch(EOfifo *fifo, const void **items, eOsizecntnr_t *number, eOreltime_t tout)
+{
+    if((NULL == fifo) || (NULL == items) || (NULL == number)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    *items = NULL;
+    *number = 0;
+    
+    if(NULL != fifo->ring)
+    {
+        if(eo_fifo_mode_mpmc == fifo->ring->mode)
+        {
+            return(eores_NOK_unsupported);
+        }
+        *items = s_eo_fifo_ring_frontspan(fifo->ring, number);
+    }
+    else
+    {
+        if(eores_OK != s_eo_fifo_take(fifo, tout))
+        {
+            return(eores_NOK_timeout);
+        }
+        
+        *items = eo_deque_hid_FrontSpan(fifo->dek, number);
+        
+        s_eo_fifo_release(fifo);
+    }
+    
+    return((NULL != *items) ? (eores_OK) : (eores_NOK_nodata));
+}
+
+
+extern eOresult_t eo_fifo_RemBatch(EOfifo *fifo, eOsizecntnr_t number, eOreltime_t tout)
+{
+    if(NULL == fifo) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != fifo->ring)
+    {
+        s_eo_fifo_ring_getrem(fifo->ring, NULL, number);
+    }
+    else
+    {
+        if(eores_OK != s_eo_fifo_take(fifo, tout))
+        {
+            return(eores_NOK_timeout);
+        }
+        
+        eo_deque_hid_PopFrontSpan(fifo->dek, NULL, number);
+        
+        s_eo_fifo_release(fifo);
+    }
+    
+    return(eores_OK);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -485,7 +724,358 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+
+static eOresult_t s_eo_fifo_take(EOfifo *fifo, eOreltime_t tout)
+{
+    if(NULL == fifo->mutex)
+    {
+        return(eores_OK);
+    }
+    return((eores_OK == eov_mutex_Take(fifo->mutex, tout)) ? (eores_OK) : (eores_NOK_timeout));
+}
+
+
+static void s_eo_fifo_release(EOfifo *fifo)
+{
+    if(NULL != fifo->mutex)
+    {
+        eov_mutex_Release(fifo->mutex);
+    }
+}
+
+
+#if     defined(EOFIFO_USE_ATOMICS)
+
+EO_static_inline uint8_t * s_eo_fifo_ring_cell(eOfifo_ring_t *ring, uint32_t position)
+{
+    return(ring->cells + (position & ring->mask) * ring->stride);
+}
+
+
+EO_static_inline void s_eo_fifo_ring_copy_in(eOfifo_ring_t *ring, uint8_t *item, const uint8_t *pitem)
+{
+    if(NULL != ring->item_copy_fn)
+    {
+        ring->item_copy_fn(item, (void*)pitem);
+    }
+    else
+    {
+        memcpy(item, pitem, ring->item_size);
+    }
+}
+
+
+EO_static_inline void s_eo_fifo_ring_copy_out(eOfifo_ring_t *ring, uint8_t *item, uint8_t *pitem)
+{
+    if(NULL != pitem)
+    {
+        if(NULL != ring->item_copy_fn)
+        {
+            ring->item_copy_fn(pitem, item);
+        }
+        else
+        {
+            memcpy(pitem, item, ring->item_size);
+        }
+    }
+    
+    if(NULL != ring->item_clear_fn)
+    {
+        ring->item_clear_fn(item);
+    }
+}
+
+
+static eOfifo_ring_t * s_eo_fifo_ring_new(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                          eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                          eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                                          eOfifo_mode_t mode)
+{
+    eOfifo_ring_t *ring = NULL;
+    eOmempool_alignment_t align = eo_mempool_align_64bit;
+    uint32_t slots = 1;
+    uint32_t i = 0;
+    uint8_t *cell = NULL;
+    
+    eo_errman_Assert(eo_errman_GetHandle(), (capacity <= EOFIFO_RING_MAXCAPACITY), "eo_fifo_NewExt(): capacity too big", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), ((eo_fifo_mode_spsc == mode) || (eo_fifo_mode_mpmc == mode)), "eo_fifo_NewExt(): wrong mode", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    
+    while(slots < capacity)
+    {
+        slots <<= 1;
+    }
+    
+    ring = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOfifo_ring_t), 1);
+    
+    ring->mask              = slots - 1;
+    ring->item_size         = item_size;
+    ring->capacity          = (eOsizecntnr_t)slots;
+    ring->mode              = (uint8_t)mode;
+    ring->item_copy_fn      = item_copy;
+    ring->item_clear_fn     = item_clear;
+    ring->head.value        = 0;
+    ring->tail.value        = 0;
+    
+    if(eo_fifo_mode_spsc == mode)
+    {   // the items are contiguous as in the EOdeque
+        ring->offset = 0;
+        ring->stride = item_size;
+        align = (1 == item_size) ? (eo_mempool_align_08bit) : ((2 == item_size) ? (eo_mempool_align_16bit) : ((item_size <= 4) ? (eo_mempool_align_32bit) : (eo_mempool_align_64bit)));
+    }
+    else
+    {   // each item follows the sequence number of its cell, aligned to 4 or 8 bytes
+        ring->offset = (item_size > 4) ? (8) : (4);
+        ring->stride = ring->offset + ((item_size + ring->offset - 1) / ring->offset) * ring->offset;
+        align = eo_mempool_align_64bit;
+    }
+    
+    ring->cells = eo_mempool_GetMemory(eo_mempool_GetHandle(), align, ring->stride, (uint16_t)slots);
+    
+    for(i=0; i<slots; i++)
+    {
+        cell = s_eo_fifo_ring_cell(ring, i);
+        if(eo_fifo_mode_mpmc == mode)
+        {   // the cell of position i can be written at position i
+            *((uint32_t*)cell) = i;
+        }
+        if(NULL != item_init)
+        {
+            item_init(cell + ring->offset, init_arg);
+        }
+        else
+        {
+            memset(cell + ring->offset, 0, item_size);
+        }
+    }
+    
+    return(ring);
+}
+
+
+static void s_eo_fifo_ring_delete(eOfifo_ring_t *ring)
+{
+    // the items are removed so that their clear function is called
+    while(0 != s_eo_fifo_ring_getrem(ring, NULL, ring->capacity))
+    {
+        ;
+    }
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), ring->cells);
+    memset(ring, 0, sizeof(eOfifo_ring_t));
+    eo_mempool_Delete(eo_mempool_GetHandle(), ring);
+}
+
+
+static eOsizecntnr_t s_eo_fifo_ring_size(eOfifo_ring_t *ring)
+{   // it is exact only if no one is using the ring
+    uint32_t head = EOFIFO_LOAD_ACQUIRE(&ring->head.value);
+    uint32_t tail = EOFIFO_LOAD_ACQUIRE(&ring->tail.value);
+    uint32_t size = tail - head;
+    
+    // the head read before the tail can only make the difference bigger
+    return((eOsizecntnr_t)((size > ring->capacity) ? (ring->capacity) : (size)));
+}
+
+
+static eOsizecntnr_t s_eo_fifo_ring_put(eOfifo_ring_t *ring, const uint8_t *items, eOsizecntnr_t number)
+{
+    uint32_t pos = 0;
+    uint32_t seq = 0;
+    uint32_t n = 0;
+    uint32_t i = 0;
+    uint8_t *cell = NULL;
+    
+    if(eo_fifo_mode_spsc == ring->mode)
+    {   // the only producer: it owns the tail and waits for nobody
+        pos = EOFIFO_LOAD_RELAXED(&ring->tail.value);
+        n = ring->capacity - (pos - EOFIFO_LOAD_ACQUIRE(&ring->head.value));
+        n = (n < number) ? (n) : (number);
+        
+        for(i=0; i<n; i++)
+        {
+            s_eo_fifo_ring_copy_in(ring, s_eo_fifo_ring_cell(ring, pos+i), items + i*ring->item_size);
+        }
+        
+        // the consumer sees the items only after they are copied
+        EOFIFO_STORE_RELEASE(&ring->tail.value, pos+n);
+        
+        return((eOsizecntnr_t)n);
+    }
+    
+    // mpmc: the cells from pos which can be written are claimed by moving the tail with a single cas
+    pos = EOFIFO_LOAD_RELAXED(&ring->tail.value);
+    for(;;)
+    {
+        for(n=0; n<number; n++)
+        {
+            if((pos+n) != EOFIFO_LOAD_ACQUIRE((uint32_t*)s_eo_fifo_ring_cell(ring, pos+n)))
+            {
+                break;
+            }
+        }
+        
+        if(0 == n)
+        {
+            seq = EOFIFO_LOAD_ACQUIRE((uint32_t*)s_eo_fifo_ring_cell(ring, pos));
+            if((int32_t)(seq - pos) < 0)
+            {   // the cell still holds the item of the previous lap: the ring is full
+                return(0);
+            }
+            // another producer has taken pos
+            pos = EOFIFO_LOAD_RELAXED(&ring->tail.value);
+        }
+        else if(EOFIFO_CAS(&ring->tail.value, &pos, pos+n))
+        {
+            break;
+        }
+    }
+    
+    for(i=0; i<n; i++)
+    {
+        cell = s_eo_fifo_ring_cell(ring, pos+i);
+        s_eo_fifo_ring_copy_in(ring, cell + ring->offset, items + i*ring->item_size);
+        // the cell can now be read at position pos+i
+        EOFIFO_STORE_RELEASE((uint32_t*)cell, pos+i+1);
+    }
+    
+    return((eOsizecntnr_t)n);
+}
+
+
+static eOsizecntnr_t s_eo_fifo_ring_getrem(eOfifo_ring_t *ring, uint8_t *items, eOsizecntnr_t number)
+{
+    uint32_t pos = 0;
+    uint32_t seq = 0;
+    uint32_t n = 0;
+    uint32_t i = 0;
+    uint8_t *cell = NULL;
+    
+    if(eo_fifo_mode_spsc == ring->mode)
+    {   // the only consumer: it owns the head and waits for nobody
+        pos = EOFIFO_LOAD_RELAXED(&ring->head.value);
+        n = EOFIFO_LOAD_ACQUIRE(&ring->tail.value) - pos;
+        n = (n < number) ? (n) : (number);
+        
+        for(i=0; i<n; i++)
+        {
+            s_eo_fifo_ring_copy_out(ring, s_eo_fifo_ring_cell(ring, pos+i), (NULL == items) ? (NULL) : (items + i*ring->item_size));
+        }
+        
+        // the producer reuses the cells only after they are read
+        EOFIFO_STORE_RELEASE(&ring->head.value, pos+n);
+        
+        return((eOsizecntnr_t)n);
+    }
+    
+    // mpmc: the cells from pos which can be read are claimed by moving the head with a single cas
+    pos = EOFIFO_LOAD_RELAXED(&ring->head.value);
+    for(;;)
+    {
+        for(n=0; n<number; n++)
+        {
+            if((pos+n+1) != EOFIFO_LOAD_ACQUIRE((uint32_t*)s_eo_fifo_ring_cell(ring, pos+n)))
+            {
+                break;
+            }
+        }
+        
+        if(0 == n)
+        {
+            seq = EOFIFO_LOAD_ACQUIRE((uint32_t*)s_eo_fifo_ring_cell(ring, pos));
+            if((int32_t)(seq - (pos+1)) < 0)
+            {   // the cell is not written yet: the ring is empty
+                return(0);
+            }
+            // another consumer has taken pos
+            pos = EOFIFO_LOAD_RELAXED(&ring->head.value);
+        }
+        else if(EOFIFO_CAS(&ring->head.value, &pos, pos+n))
+        {
+            break;
+        }
+    }
+    
+    for(i=0; i<n; i++)
+    {
+        cell = s_eo_fifo_ring_cell(ring, pos+i);
+        s_eo_fifo_ring_copy_out(ring, cell + ring->offset, (NULL == items) ? (NULL) : (items + i*ring->item_size));
+        // the cell can now be written at the position of the next lap
+        EOFIFO_STORE_RELEASE((uint32_t*)cell, pos+i+ring->mask+1);
+    }
+    
+    return((eOsizecntnr_t)n);
+}
+
+
+static const void * s_eo_fifo_ring_front(eOfifo_ring_t *ring)
+{   // only in spsc and only by the consumer
+    uint32_t pos = EOFIFO_LOAD_RELAXED(&ring->head.value);
+    
+    if(pos == EOFIFO_LOAD_ACQUIRE(&ring->tail.value))
+    {
+        return(NULL);
+    }
+    
+    return(s_eo_fifo_ring_cell(ring, pos));
+}
+
+
+static const void * s_eo_fifo_ring_frontspan(eOfifo_ring_t *ring, eOsizecntnr_t *number)
+{   // only in spsc and only by the consumer. the items are contiguous up to the end of the cells
+    uint32_t pos = EOFIFO_LOAD_RELAXED(&ring->head.value);
+    uint32_t n = EOFIFO_LOAD_ACQUIRE(&ring->tail.value) - pos;
+    uint32_t chunk = ring->capacity - (pos & ring->mask);
+    
+    *number = (eOsizecntnr_t)((n < chunk) ? (n) : (chunk));
+    
+    return((0 == n) ? (NULL) : (s_eo_fifo_ring_cell(ring, pos)));
+}
+
+#else
+
+// without atomics there is no ring: eo_fifo_NewExt() refuses the lock-free modes and the other functions are never called
+
+static eOfifo_ring_t * s_eo_fifo_ring_new(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                          eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                          eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                                          eOfifo_mode_t mode)
+{
+    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_fifo_NewExt(): lock-free modes not supported by the compiler", s_eobj_ownname, &eo_errman_DescrUnspecified);
+    return(NULL);
+}
+
+static void s_eo_fifo_ring_delete(eOfifo_ring_t *ring)
+{
+}
+
+static eOsizecntnr_t s_eo_fifo_ring_size(eOfifo_ring_t *ring)
+{
+    return(0);
+}
+
+static eOsizecntnr_t s_eo_fifo_ring_put(eOfifo_ring_t *ring, const uint8_t *items, eOsizecntnr_t number)
+{
+    return(0);
+}
+
+static eOsizecntnr_t s_eo_fifo_ring_getrem(eOfifo_ring_t *ring, uint8_t *items, eOsizecntnr_t number)
+{
+    return(0);
+}
+
+static const void * s_eo_fifo_ring_front(eOfifo_ring_t *ring)
+{
+    return(NULL);
+}
+
+static const void * s_eo_fifo_ring_frontspan(eOfifo_ring_t *ring, eOsizecntnr_t *number)
+{
+    *number = 0;
+    return(NULL);
+}
+
+#endif
 
 
 
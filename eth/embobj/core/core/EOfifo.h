@@ -35,6 +35,13 @@ extern "C" {
     It contains an object EOdeque and an object derived from EOVmutex.
     It can be used alone with void * items or can be used inside another object to act such as
     a template in C++.  For example see EOfifoByte.
+    If created with eo_fifo_NewExt() in mode eo_fifo_mode_spsc or eo_fifo_mode_mpmc, the EOfifo does not use any
+    mutex but a lock-free ring whose capacity is rounded up to a power of two, with the read and write indices in
+    different cache lines. The spsc ring is for a single producer and a single consumer, for instance an I/O
+    thread and a control thread. The mpmc ring is bounded and admits any number of producers and consumers, but
+    it does not support eo_fifo_Get() because an item can be taken by another consumer while it is used.
+    In the lock-free modes the functions never wait, thus their timeout is ignored. They are available only with
+    compilers which have the __atomic builtins of gcc.
    
    @{        
  */
@@ -60,6 +67,17 @@ extern "C" {
 typedef struct EOfifo_hid EOfifo;
 
 
+/** @typedef    typedef enum eOfifo_mode_t
+    @brief      The synchronisation of the EOfifo, chosen at its creation.
+ **/
+typedef enum
+{
+    eo_fifo_mode_locked     = 0,    /**< the items are in an EOdeque protected by the optional mutex */
+    eo_fifo_mode_spsc       = 1,    /**< lock-free ring for a single producer and a single consumer */
+    eo_fifo_mode_mpmc       = 2     /**< lock-free bounded ring for many producers and many consumers */
+} eOfifo_mode_t;
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 // empty-section
@@ -92,6 +110,23 @@ extern EOfifo * eo_fifo_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                             eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
                             EOVmutexDerived *mutex);
 
+/** @fn         extern EOfifo * eo_fifo_NewExt(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                               eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                               eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                                               EOVmutexDerived *mutex, eOfifo_mode_t mode)
+    @brief      As eo_fifo_New() but with the choice of the synchronisation. 
+    @param      mutex           Used only in eo_fifo_mode_locked.
+    @param      mode            The synchronisation. In eo_fifo_mode_spsc and eo_fifo_mode_mpmc the capacity is
+                                rounded up to a power of two and must not be higher than 32768.
+    @return     Pointer to the required EOfifo object. The pointer is always not NULL. Any error in parameters
+                will cause a call to the error manager.
+ **/
+extern EOfifo * eo_fifo_NewExt(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                               eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                               eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                               EOVmutexDerived *mutex, eOfifo_mode_t mode);
+
+
 /** @fn         extern void eo_fifo_Delete(EOfifo * fifo)
     @brief      deletes the fifo, it calls eo_fifo_Clear() before destroying the objects.
     @param      fifo            Pointer to the EOfifo object.
@@ -142,7 +177,7 @@ extern eOresult_t eo_fifo_Put(EOfifo *fifo, void *item, eOreltime_t tout);
     @param      tout      Timeout for the operation in micro-seconds.
     @return     eores_OK upon success (retrieval of valid data), eores_NOK_nodata if fifo is empty, 
                 eores_NOK_nullpointer if fifo is NULL, eores_NOK_timeout if the mutex was busy within 
-                the specified timeout. 
+                the specified timeout, eores_NOK_unsupported in mode eo_fifo_mode_mpmc. 
  **/
 extern eOresult_t eo_fifo_Get(EOfifo *fifo, const void **ppitem, eOreltime_t tout);
 
@@ -179,6 +214,63 @@ extern eOresult_t eo_fifo_GetRem(EOfifo *fifo, void *pitem, eOreltime_t tout);
 extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifo_PutBatch(EOfifo *fifo, const void *items, eOsizecntnr_t number, 
+                                                   eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Copies in the fifo queue as many as possible of the @e number consecutive items in @e items, with
+                a single take of the mutex or a single update of the write index.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      items           Pointer to the array of the items to be copied. 
+    @param      number          The number of items in @e items.
+    @param      put             If not NULL, filled with the number of copied items.
+    @param      tout            Timeout for the operation in micro-seconds.
+    @return     eores_OK if all the items were copied, eores_NOK_busy if the queue became full, eores_NOK_nullpointer 
+                if fifo or items are NULL, eores_NOK_timeout if the mutex was busy within the specified timeout.
+ **/
+extern eOresult_t eo_fifo_PutBatch(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifo_GetRemBatch(EOfifo *fifo, void *items, eOsizecntnr_t number, 
+                                                      eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Copies in @e items and removes from the fifo queue at most @e number first-in items, with a single
+                take of the mutex or a single update of the read index.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      items           Pointer to the array which receives the items. 
+    @param      number          The capacity of @e items.
+    @param      got             If not NULL, filled with the number of retrieved items.
+    @param      tout            Timeout for the operation in micro-seconds.
+    @return     eores_OK if at least one item was retrieved, eores_NOK_nodata if fifo is empty, eores_NOK_nullpointer 
+                if fifo or items are NULL, eores_NOK_timeout if the mutex was busy within the specified timeout.
+ **/
+extern eOresult_t eo_fifo_GetRemBatch(EOfifo *fifo, void *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifo_PeekBatch(EOfifo *fifo, const void **items, eOsizecntnr_t *number, eOreltime_t tout)
+    @brief      Retrieves a pointer to the first-in item and the number of items which follow it contiguously in
+                memory, without removing them. They can be less than the size of the fifo when the items wrap around
+                the end of the storage. The items can be used in place and then removed with eo_fifo_RemBatch(). 
+                The pointer stays valid only until the items are removed, thus there must be a single consumer.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      items           The address in which the function will copy the pointer to the first-in item. 
+    @param      number          The address in which the function will copy the number of contiguous items.
+    @param      tout            Timeout for the operation in micro-seconds.
+    @return     eores_OK upon success, eores_NOK_nodata if fifo is empty, eores_NOK_nullpointer if some argument 
+                is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout, eores_NOK_unsupported
+                in mode eo_fifo_mode_mpmc.
+ **/
+extern eOresult_t eo_fifo_PeekBatch(EOfifo *fifo, const void **items, eOsizecntnr_t *number, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifo_RemBatch(EOfifo *fifo, eOsizecntnr_t number, eOreltime_t tout)
+    @brief      Removes at most @e number first-in items from the fifo queue.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      number          The number of items to remove.
+    @param      tout            Timeout for the operation in micro-seconds.
+    @return     eores_OK upon success, eores_NOK_nullpointer if fifo is NULL, eores_NOK_timeout if the mutex was 
+                busy within the specified timeout.
+ **/
+extern eOresult_t eo_fifo_RemBatch(EOfifo *fifo, eOsizecntnr_t number, eOreltime_t tout);
+
+
 
 /** @}            
     end of group eo_fifo  
@@ -196,6 +196,50 @@ extern eOresult_t eo_fifobyte_Clear(EOfifoByte *fifobyte, eOreltime_t tout)
     return(eo_fifo_Clear(fifobyte->fifo, tout));
 }
 
+
+extern eOresult_t eo_fifobyte_PutSpan(EOfifoByte *fifobyte, const uint8_t *data, eOsizecntnr_t size, eOsizecntnr_t *put, eOreltime_t tout) 
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_PutBatch(fifobyte->fifo, data, size, put, tout));
+}
+
+
+extern eOresult_t eo_fifobyte_GetSpan(EOfifoByte *fifobyte, uint8_t *data, eOsizecntnr_t size, eOsizecntnr_t *got, eOreltime_t tout) 
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_GetRemBatch(fifobyte->fifo, data, size, got, tout));
+}
+
+
+extern eOresult_t eo_fifobyte_PeekSpan(EOfifoByte *fifobyte, const uint8_t **data, eOsizecntnr_t *size, eOreltime_t tout) 
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_PeekBatch(fifobyte->fifo, (const void**)data, size, tout));
+}
+
+
+extern eOresult_t eo_fifobyte_CommitSpan(EOfifoByte *fifobyte, eOsizecntnr_t size, eOreltime_t tout) 
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_RemBatch(fifobyte->fifo, size, tout));
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
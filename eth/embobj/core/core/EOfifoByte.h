@@ -155,6 +155,64 @@ extern eOresult_t eo_fifobyte_Rem(EOfifoByte *fifobyte, eOreltime_t tout);
 extern eOresult_t eo_fifobyte_Clear(EOfifoByte *fifobyte, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifobyte_PutSpan(EOfifoByte *fifobyte, const uint8_t *data, eOsizecntnr_t size, 
+                                                    eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Copies in the fifobyte queue as many as possible of the @e size bytes in @e data. The mutex is taken
+                only once and the bytes are copied with at most two memcpy().
+    @param      fifobyte        Pointer to the fifobyte object.
+    @param      data            The bytes to be copied.  
+    @param      size            The number of bytes in @e data.
+    @param      put             If not NULL, filled with the number of copied bytes.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK if all the bytes were copied, eores_NOK_busy if the queue became full, eores_NOK_nullpointer
+                if fifobyte or data are NULL, eores_NOK_timeout if the mutex was busy within the specified timeout
+ **/
+extern eOresult_t eo_fifobyte_PutSpan(EOfifoByte *fifobyte, const uint8_t *data, eOsizecntnr_t size, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifobyte_GetSpan(EOfifoByte *fifobyte, uint8_t *data, eOsizecntnr_t size, 
+                                                    eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Copies in @e data and removes from the fifobyte queue at most @e size first-in bytes. The mutex is
+                taken only once and the bytes are copied with at most two memcpy().
+    @param      fifobyte        Pointer to the fifobyte object.
+    @param      data            The address in which the function will copy the retrieved bytes. 
+    @param      size            The capacity of @e data.
+    @param      got             If not NULL, filled with the number of retrieved bytes.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK if at least one byte was retrieved, eores_NOK_nodata if fifobyte is empty, 
+                eores_NOK_nullpointer if fifobyte or data are NULL, eores_NOK_timeout if the mutex was busy within the 
+                specified timeout. 
+ **/
+extern eOresult_t eo_fifobyte_GetSpan(EOfifoByte *fifobyte, uint8_t *data, eOsizecntnr_t size, eOsizecntnr_t *got, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifobyte_PeekSpan(EOfifoByte *fifobyte, const uint8_t **data, eOsizecntnr_t *size, eOreltime_t tout)
+    @brief      Retrieves the first-in bytes which are contiguous in memory, without copying nor removing them. They
+                can be less than the size of the queue when they wrap around the end of its storage, in which case
+                a second call after eo_fifobyte_CommitSpan() returns the rest. The bytes must be used only by
+                a single consumer and only until they are committed.
+    @param      fifobyte        Pointer to the fifobyte object.
+    @param      data            The address in which the function will copy the pointer to the first-in byte. 
+    @param      size            The address in which the function will copy the number of contiguous bytes.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK upon success, eores_NOK_nodata if fifobyte is empty, eores_NOK_nullpointer if some argument 
+                is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout. 
+ **/
+extern eOresult_t eo_fifobyte_PeekSpan(EOfifoByte *fifobyte, const uint8_t **data, eOsizecntnr_t *size, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifobyte_CommitSpan(EOfifoByte *fifobyte, eOsizecntnr_t size, eOreltime_t tout)
+    @brief      Removes the first @e size bytes of the fifobyte queue, typically after they were used in place 
+                with eo_fifobyte_PeekSpan().
+    @param      fifobyte        Pointer to the fifobyte object.
+    @param      size            The number of bytes to remove.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK upon success, eores_NOK_nullpointer if fifobyte is NULL, eores_NOK_timeout if 
+                the mutex was busy within the specified timeout.
+ **/
+extern eOresult_t eo_fifobyte_CommitSpan(EOfifoByte *fifobyte, eOsizecntnr_t size, eOreltime_t tout);
+
+
 /** @}            
     end of group eo_fifobyte  
  **/
@@ -197,6 +197,50 @@ extern eOresult_t eo_fifoword_Clear(EOfifoWord *fifoword, eOreltime_t tout)
 }
 
 
+extern eOresult_t eo_fifoword_PutSpan(EOfifoWord *fifoword, const uint32_t *data, eOsizecntnr_t size, eOsizecntnr_t *put, eOreltime_t tout) 
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_PutBatch(fifoword->fifo, data, size, put, tout));
+}
+
+
+extern eOresult_t eo_fifoword_GetSpan(EOfifoWord *fifoword, uint32_t *data, eOsizecntnr_t size, eOsizecntnr_t *got, eOreltime_t tout) 
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_GetRemBatch(fifoword->fifo, data, size, got, tout));
+}
+
+
+extern eOresult_t eo_fifoword_PeekSpan(EOfifoWord *fifoword, const uint32_t **data, eOsizecntnr_t *size, eOreltime_t tout) 
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_PeekBatch(fifoword->fifo, (const void**)data, size, tout));
+}
+
+
+extern eOresult_t eo_fifoword_CommitSpan(EOfifoWord *fifoword, eOsizecntnr_t size, eOreltime_t tout) 
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_RemBatch(fifoword->fifo, size, tout));
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
@@ -154,6 +154,64 @@ extern eOresult_t eo_fifoword_Rem(EOfifoWord *fifo, eOreltime_t tout);
 extern eOresult_t eo_fifoword_Clear(EOfifoWord *fifo, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifoword_PutSpan(EOfifoWord *fifo, const uint32_t *data, eOsizecntnr_t size, 
+                                                    eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Copies in the fifoword queue as many as possible of the @e size words in @e data. The mutex is taken
+                only once and the words are copied with at most two memcpy().
+    @param      fifo            Pointer to the fifoword object.
+    @param      data            The words to be copied.  
+    @param      size            The number of words in @e data.
+    @param      put             If not NULL, filled with the number of copied words.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK if all the words were copied, eores_NOK_busy if the queue became full, eores_NOK_nullpointer
+                if fifo or data are NULL, eores_NOK_timeout if the mutex was busy within the specified timeout
+ **/
+extern eOresult_t eo_fifoword_PutSpan(EOfifoWord *fifo, const uint32_t *data, eOsizecntnr_t size, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifoword_GetSpan(EOfifoWord *fifo, uint32_t *data, eOsizecntnr_t size, 
+                                                    eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Copies in @e data and removes from the fifoword queue at most @e size first-in words. The mutex is
+                taken only once and the words are copied with at most two memcpy().
+    @param      fifo            Pointer to the fifoword object.
+    @param      data            The address in which the function will copy the retrieved words. 
+    @param      size            The capacity of @e data.
+    @param      got             If not NULL, filled with the number of retrieved words.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK if at least one word was retrieved, eores_NOK_nodata if fifo is empty, 
+                eores_NOK_nullpointer if fifo or data are NULL, eores_NOK_timeout if the mutex was busy within the 
+                specified timeout. 
+ **/
+extern eOresult_t eo_fifoword_GetSpan(EOfifoWord *fifo, uint32_t *data, eOsizecntnr_t size, eOsizecntnr_t *got, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifoword_PeekSpan(EOfifoWord *fifo, const uint32_t **data, eOsizecntnr_t *size, eOreltime_t tout)
+    @brief      Retrieves the first-in words which are contiguous in memory, without copying nor removing them. They
+                can be less than the size of the queue when they wrap around the end of its storage, in which case
+                a second call after eo_fifoword_CommitSpan() returns the rest. The words must be used only by
+                a single consumer and only until they are committed.
+    @param      fifo            Pointer to the fifoword object.
+    @param      data            The address in which the function will copy the pointer to the first-in word. 
+    @param      size            The address in which the function will copy the number of contiguous words.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK upon success, eores_NOK_nodata if fifo is empty, eores_NOK_nullpointer if some argument 
+                is NULL, eores_NOK_timeout if the mutex was busy within the specified timeout. 
+ **/
+extern eOresult_t eo_fifoword_PeekSpan(EOfifoWord *fifo, const uint32_t **data, eOsizecntnr_t *size, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifoword_CommitSpan(EOfifoWord *fifo, eOsizecntnr_t size, eOreltime_t tout)
+    @brief      Removes the first @e size words of the fifoword queue, typically after they were used in place 
+                with eo_fifoword_PeekSpan().
+    @param      fifo            Pointer to the fifoword object.
+    @param      size            The number of words to remove.
+    @param      tout            The timeout for the operation in micro-seconds.
+    @return     eores_OK upon success, eores_NOK_nullpointer if fifo is NULL, eores_NOK_timeout if 
+                the mutex was busy within the specified timeout.
+ **/
+extern eOresult_t eo_fifoword_CommitSpan(EOfifoWord *fifo, eOsizecntnr_t size, eOreltime_t tout);
+
+
 /** @}            
     end of group eo_fifoword  
  **/
@@ -36,12 +36,40 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
+
+#define EOFIFO_CACHELINE        64
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 
+// an index of the lock-free ring, alone in its cache line so that producers and consumers do not share it
+typedef struct
+{
+    volatile uint32_t           value;
+    uint8_t                     filler[EOFIFO_CACHELINE - sizeof(uint32_t)];
+} eOfifo_index_t;
+
+
+// the lock-free ring. the positions grow without bounds and the cell of a position is (position & mask).
+// in mpmc each cell begins with a sequence number which tells if the cell can be written or read at a position.
+// the indices come first so that the fields which are only read do not share their cache lines.
+typedef struct
+{
+    eOfifo_index_t              head;               // the next position to read, written by the consumers
+    eOfifo_index_t              tail;               // the next position to write, written by the producers
+    uint8_t                     *cells;
+    uint32_t                    mask;
+    uint16_t                    stride;             // size of a cell
+    uint16_t                    offset;             // of the item inside the cell
+    eOsizeitem_t                item_size;
+    eOsizecntnr_t               capacity;
+    uint8_t                     mode;               // eo_fifo_mode_spsc or eo_fifo_mode_mpmc
+    eOres_fp_voidp_voidp_t      item_copy_fn;
+    eOres_fp_voidp_t            item_clear_fn;
+} eOfifo_ring_t;
+
+
 /* @struct     EOfifo_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -54,6 +82,7 @@ struct EOfifo_hid
     EOdeque                 *dek;
     EOVmutexDerived         *mutex;
     // other stuff
+    eOfifo_ring_t           *ring;              // not NULL in the lock-free modes, where dek and mutex are NULL
 };
 
 #ifdef __cplusplus
@@ -86,6 +86,25 @@ EO_static_inline void s_eo_list_default_init(void* item,  EOlist* list)
 }
 
 
+#if     defined(EOLIST_USE_INDEXED_STORAGE)
+
+EO_static_inline EOlistIter* s_eo_list_node(EOlist *list, uint16_t index)
+{
+    return((EOLIST_INDEX_NONE == index) ? (NULL) : ((EOlistIter*)(list->nodes + (uint32_t)index*list->stride)));
+}
+
+EO_static_inline uint16_t s_eo_list_index(EOlist *list, EOlistIter *li)
+{
+    return((uint16_t)(((uint8_t*)li - list->nodes) / list->stride));
+}
+
+EO_static_inline void* s_eo_list_get_data(EOlist *list, EOlistIter *li)
+{   // the item follows the iterator inside the node
+    (void)list;
+    return(((uint8_t*)li) + sizeof(EOlistIter));
+}
+
+#else
 
 EO_static_inline void* s_eo_list_get_data(EOlist *list, EOlistIter *li)
 {
@@ -99,28 +118,36 @@ EO_static_inline void* s_eo_list_get_data(EOlist *list, EOlistIter *li)
     }
 }
 
-static EOlistIter * s_eo_list_push_front(EOlistIter *head, EOlistIter *li);
-static EOlistIter * s_eo_list_push_back(EOlistIter *tail, EOlistIter *li);
-static EOlistIter * s_eo_list_insert_before(EOlistIter *head, EOlistIter *iter, EOlistIter *li);
-static EOlistIter * s_eo_list_rem_front(EOlistIter *head);
-static EOlistIter * s_eo_list_rem_back(EOlistIter *tail);
-//static EOlistIter * s_eo_list_rem_iter(EOlistIter *head, EOlistIter *li);
-static void s_eo_list_rem_any(EOlist *list, EOlistIter *li);
+#endif
+
+static void s_eo_list_storage_init(EOlist *list);
+static void s_eo_list_storage_deinit(EOlist *list);
+static uint32_t s_eo_list_storage_footprint(EOlist *list);
+
+static void s_eo_list_link_front(EOlist *list, EOlistIter *li);
+static void s_eo_list_link_back(EOlist *list, EOlistIter *li);
+static void s_eo_list_link_before(EOlist *list, EOlistIter *iter, EOlistIter *li);
+static void s_eo_list_unlink(EOlist *list, EOlistIter *li);
 static EOlistIter * s_eo_list_front(EOlist *list);
 static EOlistIter * s_eo_list_back(EOlist *list);
-static EOlistIter * s_eo_list_iter_next(EOlistIter *li);
-static EOlistIter * s_eo_list_iter_prev(EOlistIter *li);
+static EOlistIter * s_eo_list_iter_next(EOlist *list, EOlistIter *li);
+static EOlistIter * s_eo_list_iter_prev(EOlist *list, EOlistIter *li);
+static eObool_t s_eo_list_iter_isinside(EOlist *list, EOlistIter *li);
 
 static void s_eo_list_copy_item_into_iterator(EOlist *list, EOlistIter *li, void *p);
 static void s_eo_list_clean_iterator(EOlist *list, EOlistIter *li);
-
-static EOlistIter* s_eo_list_iterator_create(EOlist* list);
-
-static void s_eo_list_iterator_destroy(EOlist* list, EOlistIter* li);
+static void s_eo_list_init_item(EOlist *list, void *data);
 
 static EOlistIter* s_eo_list_iterator_get(EOlist* list);
 static void s_eo_list_iterator_release(EOlist* list, EOlistIter* li);
 
+#if     defined(EOLIST_USE_INDEXED_STORAGE)
+static void s_eo_list_nodes_add(EOlist* list, uint16_t number);
+#else
+static EOlistIter* s_eo_list_iterator_create(EOlist* list);
+static void s_eo_list_iterator_destroy(EOlist* list, EOlistIter* li);
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
@@ -138,7 +165,6 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                            eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
 {
     EOlist *retptr = NULL;
-    eOsizecntnr_t i = 0; 
 
 
     // i get the memory for the object
@@ -146,8 +172,6 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 
     
     // now the obj has valid memory. i need to initialise it with user-defined data,
-    retptr->head            = NULL;
-    retptr->tail            = NULL;
     retptr->size            = 0;
  
     eo_errman_Assert(eo_errman_GetHandle(), (0 != item_size), "eo_list_New(): 0 item_size", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
@@ -163,17 +187,10 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     if(eo_listcapacity_dynamic == retptr->capacity)
     {
         eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_New(): eo_vectorcapacity_dynamic only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
-        retptr->freeiters = NULL;        
     }
-    else
-    {   
-        for(i=0; i<capacity; i++) 
-        {
-            EOlistIter *li = s_eo_list_iterator_create(retptr);    
-            retptr->freeiters = s_eo_list_push_front(retptr->freeiters, li);
-        } 
 
-    }    
+    // in static mode all the iterators are created now
+    s_eo_list_storage_init(retptr);
 
     return(retptr);
 }
@@ -202,6 +219,17 @@ extern eOsizecntnr_t eo_list_Capacity(EOlist *list)
 }
 
 
+extern uint32_t eo_list_Footprint(EOlist *list) 
+{
+    if(NULL == list)
+    {
+        return(0);    
+    }
+    
+    return(sizeof(EOlist) + s_eo_list_storage_footprint(list));
+}
+
+
 extern eObool_t eo_list_Empty(EOlist *list) 
 {
     if(NULL == list) 
@@ -246,14 +274,8 @@ extern void eo_list_PushFront(EOlist *list, void *p)
         // copy the passed obj inside the iter or store it directly if size is small
         s_eo_list_copy_item_into_iterator(list, tmpiter, p);
         
-        // if it is the first element in the list, set the tail.
-        if(0 == list->size) 
-        {
-            list->tail = tmpiter;
-        }
-
-        // insert the iter in front of the head
-        list->head = s_eo_list_push_front(list->head, tmpiter);
+        // insert the iter in front of the head. if it is the first element in the list, it is also the tail.
+        s_eo_list_link_front(list, tmpiter);
 
         // increment size of the list    
         list->size ++;
@@ -308,14 +330,8 @@ extern void eo_list_PushBack(EOlist *list, void *p)
         // copy the passed obj inside the iter or store it directly if size is small
         s_eo_list_copy_item_into_iterator(list, tmpiter, p);
         
-        // if it is the first element in the list, set the head.
-        if(0 == list->size) 
-        {
-             list->head = tmpiter;
-        }
-
-        // insert the iter after the tail
-        list->tail = s_eo_list_push_back(list->tail, tmpiter);
+        // insert the iter after the tail. if it is the first element in the list, it is also the head.
+        s_eo_list_link_back(list, tmpiter);
 
         // increment size of the list    
         list->size ++;
@@ -369,13 +385,14 @@ extern void eo_list_Insert(EOlist *list, EOlistIter *li, void *p)
         // copy the passed obj inside the iter tmpiter or store it directly if size is small
         s_eo_list_copy_item_into_iterator(list, tmpiter, p);
         
-        // if it is the first element in the list, set the tail.
         if(0 == list->size) 
-        {
-             list->tail = tmpiter;
+        {   // li cannot be inside an empty list: tmpiter is the only element
+            s_eo_list_link_back(list, tmpiter);
+        }
+        else
+        {   // insert the element tmpiter in front of the iter li
+            s_eo_list_link_before(list, li, tmpiter);
         }
-        // insert the element tmpiter in front of the iter li
-        list->head = s_eo_list_insert_before(list->head, li, tmpiter);
         // increment size of the list    
         list->size ++;
     }
@@ -413,7 +430,7 @@ extern EOlistIter* eo_list_Next(EOlist *list, EOlistIter *li)
     {
         return(NULL);
     }
-    return(s_eo_list_iter_next(li));         
+    return(s_eo_list_iter_next(list, li));
     
 }
 
@@ -427,7 +444,7 @@ extern EOlistIter* eo_list_Prev(EOlist *list, EOlistIter *li)
     {
         return(NULL);
     }
-    return(s_eo_list_iter_prev(li));         
+    return(s_eo_list_iter_prev(list, li));
 }
 
 
@@ -443,7 +460,7 @@ extern EOlistIter* eo_list_FindItem(EOlist *list, void *p)
     }
     
     // i navigate from beginning to end until i find a NULL pointer or i break
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter))
     {
         data = s_eo_list_get_data(list, tmpiter);
         // data is a pointer to what is contained inside the list.
@@ -481,7 +498,7 @@ extern EOlistIter* eo_list_FindItem(EOlist *list, void *p)
 //    
 //    
 //    // i navigate from beginning to end until i find a NULL pointer or i break
-//    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+//    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter))
 //    {
 //        data = s_eo_list_get_data(list, tmpiter);
 //
@@ -519,7 +536,7 @@ extern EOlistIter* eo_list_Find(EOlist *list, eOresult_t (matching_rule)(void *i
     }
     
     // i navigate from beginning to end until i find a NULL pointer or i break
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter))
     {
         data = s_eo_list_get_data(list, tmpiter);
 
@@ -555,7 +572,7 @@ extern void eo_list_Execute(EOlist *list, void (execute)(void *item, void *param
     }
     
     // i navigate from beginning to end until i find a NULL pointer
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter))
     {
         data = s_eo_list_get_data(list, tmpiter);
         execute(data, param);
@@ -576,7 +593,7 @@ extern void eo_list_ExecuteFromIter(EOlist *list, void (execute)(void *item, voi
     }
     
     // i navigate from li to end until i find a NULL pointer
-    for(tmpiter = li; NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = li; NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter))
     {
         data = s_eo_list_get_data(list, tmpiter);
         execute(data, param);
@@ -588,23 +605,12 @@ extern void eo_list_ExecuteFromIter(EOlist *list, void (execute)(void *item, voi
 
 extern eObool_t eo_list_IsIterInside(EOlist *list, EOlistIter *li)
 {
-    EOlistIter *tmpiter = NULL;
-
     if((NULL == list) || (NULL == li)) 
     {
          return(eobool_false);
     }
     
-    // i navigate from beginning to end until we find li pointer or we return
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
-    {
-        if(li == tmpiter) 
-        {
-            return(eobool_true);
-        }
-    }
-    
-    return(eobool_false);    
+    return(s_eo_list_iter_isinside(list, li));
 }
 
 
@@ -622,20 +628,14 @@ extern void eo_list_PopFront(EOlist *list)
     
     if(NULL != tmpiter) 
     {
-        // i remove it from front of the list
-        list->head = s_eo_list_rem_front(list->head);
+        // i remove it from front of the list. if it was the only one, head and tail become empty
+        s_eo_list_unlink(list, tmpiter);
 
         // release it
         s_eo_list_iterator_release(list, tmpiter);
         
         // finally, i decrement size of list
         list->size --;
-
-        // if there are no more elements in the list, set the tail to NULL
-        if(0 == list->size) 
-        {
-             list->tail = NULL;
-        }
     }
     
     return; 
@@ -657,20 +657,14 @@ extern void eo_list_PopBack(EOlist *list)
     
     if(NULL != tmpiter) 
     {
-        // i remove it from end of the list
-        list->tail = s_eo_list_rem_back(list->tail);
+        // i remove it from end of the list. if it was the only one, head and tail become empty
+        s_eo_list_unlink(list, tmpiter);
 
         // release it
         s_eo_list_iterator_release(list, tmpiter);
 
         // finally, i decrement size of list
         list->size --;
-
-        // if there are no more elements in the list, set the head to NULL
-        if(0 == list->size) 
-        {
-             list->head = NULL;
-        }
     }
     
     return; 
@@ -679,42 +673,25 @@ extern void eo_list_PopBack(EOlist *list)
 
 extern void eo_list_Erase(EOlist *list, EOlistIter *li) 
 {
-    EOlistIter *tmpiter = NULL;
-    
     if((NULL == list) || (NULL == li)) 
     {
         return;    
     }
 
     // extra safety
-    if(eobool_false == eo_list_IsIterInside(list, li)) 
+    if(eobool_false == s_eo_list_iter_isinside(list, li))
     {
          return;
     }
     
     // ok, the iter li exists in the list, thus i can safely remove it.
+    s_eo_list_unlink(list, li);
 
-    // get the first iter of list, the head
-    tmpiter = s_eo_list_front(list);
-
-    if(NULL != tmpiter) 
-    {
-        // i have a valid head and a valid list iter li, thus i can i remove it
-        //list->head = s_eo_list_rem_iter(list->head, li);
-        s_eo_list_rem_any(list, li);
-
-        // release it
-        s_eo_list_iterator_release(list, li);
+    // release it
+    s_eo_list_iterator_release(list, li);
 
-        // finally, i decrement size of list
-        list->size --;
-
-        // if there are no more elements in the list, set the tail to NULL
-        if(0 == list->size) 
-        {
-             list->tail = NULL;
-        }
-    }
+    // finally, i decrement size of list
+    list->size --;
     
     return;
 }
@@ -743,25 +720,11 @@ extern void eo_list_Delete(EOlist *list)
     
     eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_Delete(): only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
   
-    // destroy every item. in case of eo_listcapacity_dynamic, each internal listiter is properly deleted and freeiters is NULL
+    // destroy every item.
     eo_list_Clear(list);
     
-    // destroy freeiters list and its items (not needed)
-    //eo_mempool_Delete(eo_mempool_GetHandle(), list->freeiters);
-    if(NULL != list->freeiters) 
-    {   // aka we dont use dymanic mode: we must destroy each element inside freeiters
-        uint16_t i;
-        for(i=0; i<list->capacity; i++) 
-        {
-            EOlistIter *li =  list->freeiters;
-            if(NULL == li)
-            {
-                break;
-            }
-            list->freeiters = s_eo_list_rem_front(list->freeiters);
-            s_eo_list_iterator_destroy(list, li);             
-        }         
-    }
+    // destroy the free iterators and their items
+    s_eo_list_storage_deinit(list);
     
     // reset all things inside vector
     memset(list, 0, sizeof(EOlist));
@@ -783,276 +746,490 @@ extern void eo_list_Delete(EOlist *list)
 // --------------------------------------------------------------------------------------------------------------------
 
 
-// returns the head
-static EOlistIter * s_eo_list_push_front(EOlistIter *head, EOlistIter *li) 
+static void s_eo_list_copy_item_into_iterator(EOlist *list, EOlistIter *li, void *p)
 {
-    EOlistIter *oldhead = head;
-    
-    li->prev = NULL;
-    li->next = head;
-    
-    head = li;
-    
-    if(NULL != oldhead) 
+    void* data = s_eo_list_get_data(list, li);
+
+    if(NULL != list->item_copy_fn)
     {
-        oldhead->prev = head;
+        list->item_copy_fn(data, p);
     }
-    
-    return(head);
+    else
+    {
+        s_eo_list_default_copy(data, p, list);
+    }
+
 }
 
 
-// returns teh tail
-static EOlistIter * s_eo_list_push_back(EOlistIter *tail, EOlistIter *li) 
+static void s_eo_list_clean_iterator(EOlist *list, EOlistIter *li)
 {
-    EOlistIter *oldtail = tail;
-    
-    li->prev = tail;
-    li->next = NULL;
-    
-    tail = li;
-    
-    if(NULL != oldtail) 
+    void* data = s_eo_list_get_data(list, li);
+
+    // call its destructor
+    if(NULL != list->item_clear_fn)
     {
-        oldtail->next = tail;
+        list->item_clear_fn(data);
     }
-    
-    return(tail);
+    else
+    {
+        s_eo_list_default_clear(data, list);
+    }
+
 }
 
 
-// returns the head
-static EOlistIter * s_eo_list_insert_before(EOlistIter *head, EOlistIter *iter, EOlistIter *li) 
+static void s_eo_list_init_item(EOlist *list, void *data)
 {
-    
-    if(iter == head)
+    if(NULL != list->item_init_fn)
     {
-        return(s_eo_list_push_front(head, li));
+        list->item_init_fn(data, list->item_init_par);
     }
     else
     {
-        // iter is not null, if iter is not the head, then ... also iter->prev is not NULL
-        // pre is teh node before iter
-        EOlistIter *pre = iter->prev;
+        s_eo_list_default_init(data, list);
+    }
+}
+
+
+#if     defined(EOLIST_USE_INDEXED_STORAGE)
 
-        // fix the links of li
-        li->prev = pre;
-        li->next = iter;
+// the iterators are nodes of a single array: the links are 16-bit indices and the items are inside the nodes,
+// so that a walk of the list stays inside one block of memory.
 
-        // fix the link of pre
-        pre->next = li;
+static void s_eo_list_storage_init(EOlist *list)
+{
+    uint32_t stride = sizeof(EOlistIter) + ((list->item_size + 3) & ~3);
+
+    eo_errman_Assert(eo_errman_GetHandle(), (stride <= EOK_uint16dummy), "eo_list_New(): item_size too big", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), ((eo_listcapacity_dynamic == list->capacity) || (list->capacity < EOLIST_INDEX_FREE)), "eo_list_New(): capacity too big", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
 
-        // fix the link of iter
-        iter->prev = li;
+    list->nodes         = NULL;
+    list->head          = EOLIST_INDEX_NONE;
+    list->tail          = EOLIST_INDEX_NONE;
+    list->freeiters     = EOLIST_INDEX_NONE;
+    list->allocated     = 0;
+    list->stride        = (uint16_t)stride;
 
-        // the head remains the same
-        return(head);
+    if(eo_listcapacity_dynamic != list->capacity)
+    {   // a single allocation for all the iterators
+        s_eo_list_nodes_add(list, list->capacity);
     }
+}
 
+
+static void s_eo_list_storage_deinit(EOlist *list)
+{
+    if(NULL != list->nodes)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), list->nodes);
+    }
+    list->nodes     = NULL;
+    list->allocated = 0;
+    list->freeiters = EOLIST_INDEX_NONE;
 }
 
- 
-// returns the head
-static EOlistIter * s_eo_list_rem_front(EOlistIter *head) 
+
+static uint32_t s_eo_list_storage_footprint(EOlist *list)
 {
-    EOlistIter *oldhead = head;
-    
-    if(NULL == oldhead) 
+    return((uint32_t)list->allocated * list->stride);
+}
+
+
+static void s_eo_list_link_front(EOlist *list, EOlistIter *li)
+{
+    uint16_t i = s_eo_list_index(list, li);
+
+    li->prev = EOLIST_INDEX_NONE;
+    li->next = list->head;
+
+    if(EOLIST_INDEX_NONE != list->head)
     {
-        return(NULL);    
+        s_eo_list_node(list, list->head)->prev = i;
     }
-    
-    if(NULL == oldhead->next) 
+    else
     {
-        // only one element in current list
-        return(NULL);
-    } 
-    else 
+        list->tail = i;
+    }
+
+    list->head = i;
+}
+
+
+static void s_eo_list_link_back(EOlist *list, EOlistIter *li)
+{
+    uint16_t i = s_eo_list_index(list, li);
+
+    li->prev = list->tail;
+    li->next = EOLIST_INDEX_NONE;
+
+    if(EOLIST_INDEX_NONE != list->tail)
     {
-        // at least two elements
-        head = oldhead->next;
-        head->prev = NULL;
+        s_eo_list_node(list, list->tail)->next = i;
+    }
+    else
+    {
+        list->head = i;
     }
-    
 
-    return(head);
+    list->tail = i;
 }
 
 
-// returns the tail
-static EOlistIter * s_eo_list_rem_back(EOlistIter *tail) 
+static void s_eo_list_link_before(EOlist *list, EOlistIter *iter, EOlistIter *li)
 {
-    EOlistIter *oldtail = tail;
-    
-    if(NULL == oldtail) 
+    uint16_t i = 0;
+
+    if(EOLIST_INDEX_NONE == iter->prev)
+    {   // iter is the head
+        s_eo_list_link_front(list, li);
+        return;
+    }
+
+    i = s_eo_list_index(list, li);
+
+    li->prev = iter->prev;
+    li->next = s_eo_list_index(list, iter);
+
+    s_eo_list_node(list, iter->prev)->next = i;
+    iter->prev = i;
+}
+
+
+static void s_eo_list_unlink(EOlist *list, EOlistIter *li)
+{
+    if(EOLIST_INDEX_NONE != li->prev)
     {
-        return(NULL);    
+        s_eo_list_node(list, li->prev)->next = li->next;
     }
-    
-    if(NULL == oldtail->prev) 
+    else
     {
-        // only one element in current list
-        return(NULL);
-    } 
-    else 
+        list->head = li->next;
+    }
+
+    if(EOLIST_INDEX_NONE != li->next)
     {
-        // at least two elements
-        tail = oldtail->prev;
-        tail->next = NULL;
+        s_eo_list_node(list, li->next)->prev = li->prev;
     }
-    
+    else
+    {
+        list->tail = li->prev;
+    }
+}
+
 
-    return(tail);
+static EOlistIter * s_eo_list_front(EOlist *list)
+{
+    return(s_eo_list_node(list, list->head));
 }
 
 
+static EOlistIter * s_eo_list_back(EOlist *list)
+{
+    return(s_eo_list_node(list, list->tail));
+}
 
-// returns the head
-//static EOlistIter * s_eo_list_rem_iter(EOlistIter *head, EOlistIter *li) 
-//{
-//    EOlistIter *newhead = head;
-//    
-//    if(NULL == head) 
-//    {
-//        return(NULL);    
-//    }
-//
-//    if(NULL == li) 
-//    {
-//         return(newhead);
-//    }
-//
-//    // head and li are not NULL
-//    if(li == head) 
-//    {
-//         // li is the head, thus remove li from the front.
-//        newhead = s_eo_list_rem_front(head);
-//    }
-//    else if(NULL == li->next) 
-//    {
-//        // li is the tail, thus ...
-//        li->prev->next = NULL;
-//    }
-//    else 
-//    {
-//         // li is in the middle
-//        li->prev->next = li->next;
-//        li->next->prev = li->prev;
-//    }
-//
-//
-//    return(newhead);
-//}
+
+static EOlistIter * s_eo_list_iter_next(EOlist *list, EOlistIter *li)
+{
+    if(NULL == li)
+    {
+         return(NULL);
+    }
+
+    return(s_eo_list_node(list, li->next));
+}
 
 
-static void s_eo_list_rem_any(EOlist *list, EOlistIter *li) 
+static EOlistIter * s_eo_list_iter_prev(EOlist *list, EOlistIter *li)
 {
-    EOlistIter *head = list->head;
-//    EOlistIter *newhead = list->head;
-    
-    if(NULL == list->head) 
+    if((NULL == li) || (EOLIST_INDEX_FREE == li->prev))
     {
-        return;    
+         return(NULL);
     }
 
-    if(NULL == li) 
+    return(s_eo_list_node(list, li->prev));
+}
+
+
+static eObool_t s_eo_list_iter_isinside(EOlist *list, EOlistIter *li)
+{   // the check does not need a walk: li must be a node of the array which is not free
+    uint32_t offset = 0;
+
+    if((NULL == list->nodes) || ((uint8_t*)li < list->nodes))
     {
-         return;
+        return(eobool_false);
     }
 
-    // head and li are not NULL
-    if(li == list->head) 
+    offset = (uint32_t)((uint8_t*)li - list->nodes);
+
+    if((offset >= (uint32_t)list->allocated*list->stride) || (0 != (offset % list->stride)))
     {
-         // li is the head, thus remove li from the front.
-        list->head = s_eo_list_rem_front(head);
+        return(eobool_false);
     }
-    else if(li == list->tail) 
+
+    return((EOLIST_INDEX_FREE == li->prev) ? (eobool_false) : (eobool_true));
+}
+
+
+static void s_eo_list_nodes_add(EOlist* list, uint16_t number)
+{
+    EOlistIter *li = NULL;
+    uint16_t first = list->allocated;
+    uint16_t i = 0;
+
+    if(NULL == list->nodes)
     {
-        // li is the tail, thus ...
-        list->tail = s_eo_list_rem_back(list->tail);
+        list->nodes = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, list->stride, number);
+    }
+    else
+    {   // only with eo_listcapacity_dynamic: the iterators are moved, thus the ones held by the user are not valid anymore
+        list->nodes = eo_mempool_Realloc(eo_mempool_GetHandle(), list->nodes, (uint32_t)list->stride*(first+number));
     }
-    else 
+
+    list->allocated = first + number;
+
+    // the new iterators go in the free list so that the lower indices are used first
+    for(i=list->allocated; i>first; i--)
     {
-         // li is in the middle
-        li->prev->next = li->next;
-        li->next->prev = li->prev;
+        li = s_eo_list_node(list, i-1);
+        s_eo_list_init_item(list, s_eo_list_get_data(list, li));
+        li->prev = EOLIST_INDEX_FREE;
+        li->next = list->freeiters;
+        list->freeiters = i-1;
     }
+}
+
 
+static EOlistIter* s_eo_list_iterator_get(EOlist* list)
+{
+    EOlistIter* li = NULL;
+    uint32_t number = 0;
+
+    if((EOLIST_INDEX_NONE == list->freeiters) && (eo_listcapacity_dynamic == list->capacity))
+    {   // the array grows by doubling, up to the max index
+        number = (0 == list->allocated) ? (4) : (list->allocated);
+        if((list->allocated + number) > EOLIST_INDEX_FREE)
+        {
+            number = EOLIST_INDEX_FREE - list->allocated;
+        }
+        if(0 != number)
+        {
+            s_eo_list_nodes_add(list, (uint16_t)number);
+        }
+    }
+
+    li = s_eo_list_node(list, list->freeiters);
+
+    if(NULL != li)
+    {   // i remove it from front of the free list
+        list->freeiters = li->next;
+        li->prev = EOLIST_INDEX_NONE;
+        li->next = EOLIST_INDEX_NONE;
+    }
+
+    return(li);
 }
 
 
-static EOlistIter * s_eo_list_front(EOlist *list) 
+static void s_eo_list_iterator_release(EOlist* list, EOlistIter* li)
 {
-    return(list->head);
+    // i clean it
+    s_eo_list_clean_iterator(list, li);
+
+    // and put it back into the free iters. also with eo_listcapacity_dynamic the array does not shrink
+    li->prev = EOLIST_INDEX_FREE;
+    li->next = list->freeiters;
+    list->freeiters = s_eo_list_index(list, li);
 }
 
 
-static EOlistIter * s_eo_list_back(EOlist *list) 
+#else
+
+
+static void s_eo_list_storage_init(EOlist *list)
 {
-    return(list->tail);
+    eOsizecntnr_t i = 0;
+    EOlistIter *li = NULL;
+
+    list->head          = NULL;
+    list->tail          = NULL;
+    list->freeiters     = NULL;
+
+    if(eo_listcapacity_dynamic != list->capacity)
+    {
+        for(i=0; i<list->capacity; i++)
+        {
+            li = s_eo_list_iterator_create(list);
+            li->next = list->freeiters;
+            list->freeiters = li;
+        }
+    }
 }
 
 
-static EOlistIter * s_eo_list_iter_next(EOlistIter *li) 
+static void s_eo_list_storage_deinit(EOlist *list)
 {
-    if(NULL == li) 
+    EOlistIter *li = NULL;
+
+    // in case of eo_listcapacity_dynamic, each internal listiter is deleted at release and freeiters is NULL
+    while(NULL != list->freeiters)
     {
-         return(NULL);
+        li = list->freeiters;
+        list->freeiters = li->next;
+        s_eo_list_iterator_destroy(list, li);
     }
+}
 
-    return(li->next);
-}  
 
+static uint32_t s_eo_list_storage_footprint(EOlist *list)
+{
+    uint32_t numberofiters = 0;
+    uint32_t sizeofiter = 0;
 
-static EOlistIter * s_eo_list_iter_prev(EOlistIter *li) 
+    // in static mode all the iterators are created by eo_list_New(). the items not bigger than a pointer stay inside .data
+    numberofiters = (eo_listcapacity_dynamic == list->capacity) ? (list->size) : (list->capacity);
+    sizeofiter = sizeof(EOlistIter) + ((list->item_size > sizeof(void*)) ? (list->item_size) : (0));
+
+    return(numberofiters*sizeofiter);
+}
+
+
+static void s_eo_list_link_front(EOlist *list, EOlistIter *li)
 {
-    if(NULL == li) 
+    li->prev = NULL;
+    li->next = list->head;
+
+    if(NULL != list->head)
     {
-         return(NULL);
+        list->head->prev = li;
+    }
+    else
+    {
+        list->tail = li;
     }
 
-    return(li->prev);
-}  
+    list->head = li;
+}
 
 
-static void s_eo_list_copy_item_into_iterator(EOlist *list, EOlistIter *li, void *p)
+static void s_eo_list_link_back(EOlist *list, EOlistIter *li)
 {
-    void* data = s_eo_list_get_data(list, li);
+    li->prev = list->tail;
+    li->next = NULL;
 
-    if(NULL != list->item_copy_fn)
+    if(NULL != list->tail)
     {
-        list->item_copy_fn(data, p);
+        list->tail->next = li;
     }
     else
     {
-        s_eo_list_default_copy(data, p, list);
+        list->head = li;
     }
 
+    list->tail = li;
 }
 
 
-static void s_eo_list_clean_iterator(EOlist *list, EOlistIter *li)
+static void s_eo_list_link_before(EOlist *list, EOlistIter *iter, EOlistIter *li)
 {
-    void* data = s_eo_list_get_data(list, li);
+    // pre is the node before iter
+    EOlistIter *pre = iter->prev;
 
-    // call its destructor
-    if(NULL != list->item_clear_fn)
+    if(iter == list->head)
     {
-        list->item_clear_fn(data);
+        s_eo_list_link_front(list, li);
+        return;
+    }
+
+    // iter is not the head, thus pre is not NULL. fix the links of li, pre and iter
+    li->prev = pre;
+    li->next = iter;
+    pre->next = li;
+    iter->prev = li;
+}
+
+
+static void s_eo_list_unlink(EOlist *list, EOlistIter *li)
+{
+    if(NULL != li->prev)
+    {
+        li->prev->next = li->next;
     }
     else
     {
-        s_eo_list_default_clear(data, list);
+        list->head = li->next;
+    }
+
+    if(NULL != li->next)
+    {
+        li->next->prev = li->prev;
+    }
+    else
+    {
+        list->tail = li->prev;
     }
+}
+
+
+static EOlistIter * s_eo_list_front(EOlist *list)
+{
+    return(list->head);
+}
 
+
+static EOlistIter * s_eo_list_back(EOlist *list)
+{
+    return(list->tail);
+}
+
+
+static EOlistIter * s_eo_list_iter_next(EOlist *list, EOlistIter *li)
+{
+    (void)list;
+    
+    if(NULL == li)
+    {
+         return(NULL);
+    }
+
+    return(li->next);
+}
+
+
+static EOlistIter * s_eo_list_iter_prev(EOlist *list, EOlistIter *li)
+{
+    (void)list;
+    
+    if(NULL == li)
+    {
+         return(NULL);
+    }
+
+    return(li->prev);
+}
+
+
+static eObool_t s_eo_list_iter_isinside(EOlist *list, EOlistIter *li)
+{
+    EOlistIter *tmpiter = NULL;
+
+    // i navigate from beginning to end until we find li pointer or we return
+    for(tmpiter = list->head; NULL != tmpiter; tmpiter = tmpiter->next)
+    {
+        if(li == tmpiter)
+        {
+            return(eobool_true);
+        }
+    }
+
+    return(eobool_false);
 }
 
 
 static EOlistIter* s_eo_list_iterator_create(EOlist* list)
 {
-//    #warning --> prima allocavo errato e troppo: una sizeof(EOlist)
     EOlistIter *li = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOlistIter), 1);
-    //eo_mempool_New(eo_mempool_GetHandle(), sizeof(EOlist));
     
     // now we allocate memory for storing the items with size item_size. 
     // however, if item_size is smaller/equal to the size of a void* (<=4 in 32-bit arch), then we use the value of data to 
@@ -1060,63 +1237,21 @@ static EOlistIter* s_eo_list_iterator_create(EOlist* list)
     if(list->item_size > sizeof(void*))
     {   // normal mode: the .data field contains a pointer to the actual data
         li->data = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, list->item_size, 1);
-        //eo_mempool_New(eo_mempool_GetHandle(), list->item_size);
-        
-        if(NULL != list->item_init_fn)
-        {
-            list->item_init_fn(li->data, list->item_init_par);
-        }
-        else
-        {
-//            #warning --> verifica
-            s_eo_list_default_init(li->data, list);
-        }
-    }
-    else
-    {   // compact mode: the bytes of the .data field contain the data itself. 
-        if(NULL != list->item_init_fn)
-        {   // thus, item_init() accepts the pointer to .data
-            list->item_init_fn(&(li->data), list->item_init_par);
-        }
-        else
-        {
-//            #warning --> verifica
-            s_eo_list_default_init(&(li->data), list);
-        }
     }
+        
+    // in compact mode the bytes of the .data field contain the data itself, thus item_init() accepts the pointer to .data
+    s_eo_list_init_item(list, s_eo_list_get_data(list, li));
     
     return(li);
 }
 
+
 static void s_eo_list_iterator_destroy(EOlist* list, EOlistIter* li)
 {
     if(list->item_size > sizeof(void*))
     {   // normal mode: the .data field contains a pointer to the actual data
-        
-//        if(NULL != list->item_clear_fn)
-//        {
-//            list->item_clear_fn(li->data);
-//        }
-//        else
-//        {
-//            #warning --> verifica
-//            s_eo_list_default_clear(li->data, list);
-//        }
-        
         eo_mempool_Delete(eo_mempool_GetHandle(), li->data);   
     }
-    else
-    {   // compact mode: the bytes of the .data field contain the data itself. 
-//        if(NULL != list->item_clear_fn)
-//        {   // thus, item_init() accepts the pointer to .data
-//            list->item_clear_fn(&(li->data));
-//        }
-//        else
-//        {
-//            #warning --> verifica
-//            s_eo_list_default_clear(&(li->data), list);
-//        }
-    }
     
     memset(li, 0, sizeof(EOlistIter));
     eo_mempool_Delete(eo_mempool_GetHandle(), li);  
@@ -1132,15 +1267,18 @@ static EOlistIter* s_eo_list_iterator_get(EOlist* list)
         li = s_eo_list_iterator_create(list);
     }
     else
-    {   // get the first free iter
+    {   // get the first free iter and remove it from front of the free list
         li = list->freeiters;
-        // and i remove it from front of the free list. the following s_eo_list_rem_front() does nothing is argument is NULL.
-        list->freeiters = s_eo_list_rem_front(list->freeiters);
+        if(NULL != li)
+        {
+            list->freeiters = li->next;
+        }
     }
     
     return(li);
 }
 
+
 static void s_eo_list_iterator_release(EOlist* list, EOlistIter* li)
 {
     // i clean it 
@@ -1152,13 +1290,14 @@ static void s_eo_list_iterator_release(EOlist* list, EOlistIter* li)
     }
     else
     {   // i put li back into the free iters
-        list->freeiters = s_eo_list_push_front(list->freeiters, li);
+        li->prev = NULL;
+        li->next = list->freeiters;
+        list->freeiters = li;
     }
 }
 
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
-
-
-
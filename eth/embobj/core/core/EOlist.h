@@ -112,6 +112,15 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 extern eOsizecntnr_t eo_list_Capacity(EOlist *list);
 
 
+/** @fn         extern uint32_t eo_list_Footprint(EOlist *list)
+    @brief      Returns the bytes of memory used by the EOlist: the object and its iterators with the storage of their 
+                items, which are capacity or only the current ones if the capacity is eo_listcapacity_dynamic.
+    @param      list           Pointer to the EOlist object.
+    @return     Number of bytes, or 0 if list is NULL.
+ **/
+extern uint32_t eo_list_Footprint(EOlist *list);
+
+
 /** @fn         extern eOsizecntnr_t eo_list_Size(EOlist *list)
     @brief      Returns the number of item objects that are currently stored in the EOlist.
     @param      list            Pointer to the EOlist object. 
@@ -41,11 +41,54 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
+
+// if defined in the build, the iterators of a list are kept in a single array and linked by 16-bit indices
+// #define EOLIST_USE_INDEXED_STORAGE
+
+#if     defined(EOLIST_USE_INDEXED_STORAGE)
+#define EOLIST_INDEX_NONE       0xffff      // the end of a chain
+#define EOLIST_INDEX_FREE       0xfffe      // the prev of an iterator which is not in the list
+#endif
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+#if     defined(EOLIST_USE_INDEXED_STORAGE)
+
+/* @struct     EOlistIter_hid
+    @brief      hidden definition. in indexed storage the iterator is a node of the array of the list and the item 
+                follows it inside the node, aligned to 4 bytes.
+ **/ 
+struct EOlistIter_hid 
+{
+    uint16_t    prev;               /*< index of previous list iterator, EOLIST_INDEX_NONE or EOLIST_INDEX_FREE    */
+    uint16_t    next;               /*< index of next list iterator or EOLIST_INDEX_NONE                           */
+};
+
+
+/* @struct     EOlist_hid
+    @brief      hidden definition. implements private data used only internally by the 
+                public or private (static) functions of the list object
+ **/ 
+struct EOlist_hid 
+{
+    uint8_t                     *nodes;                 /*< the array of the iterators, each of stride bytes */
+    uint16_t                    head;                   /*< index of first list iterator                   */
+    uint16_t                    tail;                   /*< index of last list iterator                    */
+    uint16_t                    freeiters;              /*< index of the first free iterator               */
+    uint16_t                    allocated;              /*< number of iterators in nodes                   */
+    uint16_t                    stride;                 /*< size of an iterator with its item              */
+    eOsizecntnr_t               size;                   /*< current number of list iterators in the list   */
+    eOsizecntnr_t               capacity;               /*< max number of list iterators in the list       */
+    eOsizeitem_t                item_size;              /*< size of item contained in the EOlistIter       */ 
+    eOres_fp_voidp_uint32_t     item_init_fn;
+    uint32_t                    item_init_par;        
+    eOres_fp_voidp_voidp_t      item_copy_fn;           /*< copy constructor used on inserted data         */ 
+    eOres_fp_voidp_t            item_clear_fn;          /*< destructor used on removed data                */ 
+};
+
+#else
+
 /* @struct     EOlistIter_hid
     @brief      hidden definition. implements private data used only internally by the 
                 public or private (static) functions of EOlistIter object and protectde data
@@ -77,6 +120,8 @@ struct EOlist_hid
     EOlistIter                  *freeiters;             /*< pool of free iterators for the list            */
 };
 
+#endif
+
  
 
 #ifdef __cplusplus
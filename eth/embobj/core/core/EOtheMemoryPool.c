@@ -26,6 +26,11 @@
 #include "EoCommon.h"
 #include "EOtheErrorManager.h"
 #include "EOVmutex.h"
+#include "EOVtheSystem.h"
+
+#if     defined(EO_TAILOR_CODE_FOR_LINUX) || defined(__APPLE__)
+#include <pthread.h>
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -41,11 +46,30 @@
 
 #include "EOtheMemoryPool_hid.h"
 
+// in here the functions are defined, not called with the owner
+#if     defined(EOMEMPOOL_USE_TRACE)
+#undef  eo_mempool_GetMemory
+#undef  eo_mempool_New
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the slab mode carves pages into blocks of 16, 32, ..., 2048 bytes. the block keeps a header before the user memory
+#define EOMEMPOOL_SLAB_PAGESIZE         4096
+#define EOMEMPOOL_SLAB_MINBLOCK         16
+#define EOMEMPOOL_SLAB_LARGE            0xff
+#define EOMEMPOOL_SLAB_REFILL           (EOMEMPOOL_SLAB_CACHESIZE / 2)
+
+// the caches of the threads are used only where there are thread-local storage and pthread keys, whose destructor gives
+// back the blocks of a thread which exits. elsewhere (windows included) a single cache is used under the mutex
+#if     defined(EO_TAILOR_CODE_FOR_LINUX) || defined(__APPLE__)
+#define EOMEMPOOL_SLAB_USE_THREADCACHE
+#endif
+
+#define EOMEMPOOL_TRACE_NOOWNER         EOMEMPOOL_TRACE_OWNERS
 
  // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
@@ -62,7 +86,14 @@ const eOmempool_cfg_t eom_mempool_DefaultCfg =
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// it is 8 bytes so that the user memory keeps the alignment of the block
+typedef struct
+{
+    uint32_t                        size;       // the requested bytes
+    uint8_t                         cls;        // the size class or EOMEMPOOL_SLAB_LARGE
+    uint8_t                         filler[3];
+} eOmempool_slab_header_t;
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -71,6 +102,44 @@ const eOmempool_cfg_t eom_mempool_DefaultCfg =
 
 static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, uint32_t* usedbytes);
 
+static void * s_eo_mempool_slab_get(uint32_t size);
+
+static void s_eo_mempool_slab_put(void *m);
+
+static void * s_eo_mempool_slab_realloc(void *m, uint32_t size);
+
+static void * s_eo_mempool_slab_global_get(uint8_t cls);
+
+static void s_eo_mempool_slab_global_put(uint8_t cls, void *block);
+
+static eOmempool_slab_cache_t * s_eo_mempool_slab_cache_get(void);
+
+#if     defined(EOMEMPOOL_SLAB_USE_THREADCACHE)
+static void s_eo_mempool_slab_cache_release(void *arg);
+#endif
+
+static void s_eo_mempool_lock(void);
+
+#if     defined(EOMEMPOOL_USE_TRACE)
+static void s_eo_mempool_trace_add(eOmempool_trace_op_t op, const char *owner, void *ptr, uint32_t size);
+
+static void s_eo_mempool_trace_remove(void *ptr);
+
+static void s_eo_mempool_trace_realloc(void *old, void *ptr, uint32_t size);
+
+static uint16_t s_eo_mempool_trace_owner_get(const char *owner);
+
+static void s_eo_mempool_trace_log(eOmempool_trace_op_t op, const char *owner, void *ptr, uint32_t size);
+
+static uint32_t s_eo_mempool_trace_hash(void *ptr);
+
+static eObool_t s_eo_mempool_trace_live_insert(void *ptr, uint32_t size, uint16_t owner);
+
+static eOmempool_trace_live_t * s_eo_mempool_trace_live_find(void *ptr);
+
+static void s_eo_mempool_trace_live_erase(eOmempool_trace_live_t *item);
+#endif
+
 static void * s_memallocator(uint32_t s);
 
 static void s_memfree(void *p);
@@ -87,6 +156,14 @@ static void * s_memrealloc(void *p, uint32_t s);
 
 static const char s_eobj_ownname[] = "EOtheMemoryPool";
 
+#if     defined(EOMEMPOOL_SLAB_USE_THREADCACHE)
+static EO_threadlocal eOmempool_slab_cache_t *s_eo_mempool_slab_thecache = NULL;
+// its value is the cache of the thread, so that its destructor is called when the thread exits
+static pthread_key_t s_eo_mempool_slab_threadkey;
+#else
+static eOmempool_slab_cache_t s_eo_mempool_slab_thecache;
+#endif
+
 
 static EOtheMemoryPool s_the_mempool = 
 { 
@@ -124,6 +201,18 @@ static EOtheMemoryPool s_the_mempool =
             EO_INIT(.uint64index)   0      
         }
     },
+    EO_INIT(.theslab)
+    {
+        EO_INIT(.config)
+        {
+            EO_INIT(.size)          0,
+            EO_INIT(.data)          NULL
+        },
+        EO_INIT(.arenaindex)    0,
+        EO_INIT(.largebytes)    0,
+        EO_INIT(.classes)       {{0}},
+        EO_INIT(.caches)        NULL
+    },
     EO_INIT(.mutex)         NULL, 
     EO_INIT(.tout)          0, 
     EO_INIT(.stats)     
@@ -131,6 +220,22 @@ static EOtheMemoryPool s_the_mempool =
         EO_INIT(.usedbytesheap)     0,
         EO_INIT(.usedbytespool)     0
     }
+#if     defined(EOMEMPOOL_USE_TRACE)
+    ,
+    EO_INIT(.thetrace)
+    {
+        EO_INIT(.owners)        {{0}},
+        EO_INIT(.log)           {{0}},
+        EO_INIT(.live)          {{0}},
+        EO_INIT(.logged)        0,
+        EO_INIT(.lost)          0,
+        EO_INIT(.untracked)     0,
+        EO_INIT(.livenumber)    0,
+        EO_INIT(.totalbytes)    0,
+        EO_INIT(.maxtotalbytes) 0,
+        EO_INIT(.numowners)     0
+    }
+#endif
 };
 
 
@@ -223,6 +328,22 @@ extern EOtheMemoryPool * eo_mempool_Initialise(const eOmempool_cfg_t *cfg)
                        
         } break;
         
+        case eo_mempool_alloc_slab:
+        {   // without an arena the pages come from the heap
+            if(NULL != cfg->conf)
+            {
+                memcpy(&s_the_mempool.theslab.config, &cfg->conf->slab, sizeof(eOmempool_slab_config_t));
+            }
+#if     defined(EOMEMPOOL_SLAB_USE_THREADCACHE)
+            if(0 != pthread_key_create(&s_eo_mempool_slab_threadkey, s_eo_mempool_slab_cache_release))
+            {
+                eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Initialise(): no key for the slab caches", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            }
+#else
+            s_the_mempool.theslab.caches = &s_eo_mempool_slab_thecache;
+#endif
+        } break;
+        
         default:
         {
             
@@ -259,6 +380,8 @@ extern EOtheMemoryPool* eo_mempool_GetHandle(void)
 
 extern eOresult_t eo_mempool_SetMutex(EOtheMemoryPool *p, EOVmutexDerived *mutex, eOreltime_t tout) 
 { 
+    (void)p;
+    
     // avoid assigning more than one mutex to the mempool
     if(NULL != s_the_mempool.mutex) 
     {
@@ -334,6 +457,11 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
             //size = s_align_size(alignmode, size);  // alignment is internal to s_eo_mempool_get_static()
             ret = s_eo_mempool_get_static(alignmode, size, number, &usedbytespool);
         } break;
+        
+        case eo_mempool_alloc_slab:
+        {   // the blocks are aligned to 8 bytes. the used bytes are counted by pages inside
+            ret = s_eo_mempool_slab_get(number*size);
+        } break;
     
     }
     
@@ -356,18 +484,32 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
 
 extern uint32_t eo_mempool_SizeOfAllocated(EOtheMemoryPool *p)
 {
+    (void)p;
     return(s_the_mempool.stats.usedbytespool+s_the_mempool.stats.usedbytesheap);
 }
 
 extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p)
 {   
+    (void)p;
     return(s_the_mempool.config.mode);
 }
 
 
 extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
 {
-    void *ret = s_the_mempool.theheap.allocate(size);
+    void *ret = NULL;
+    
+    (void)p;
+    
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {
+        ret = s_eo_mempool_slab_get(size);
+    }
+    else
+    {
+        ret = s_the_mempool.theheap.allocate(size);
+        s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);
+    }
 
     if(NULL == ret)
     {   // manage the fatal error in case memory could not be achieved
@@ -378,8 +520,6 @@ extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
         errdes.sourceaddress    = 0; 
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_New() no more memory", s_eobj_ownname, &errdes);
     }
-    
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);      
 
     return(ret);   
 }
@@ -394,6 +534,18 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
         return(NULL);
     }
     
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {
+        ret = s_eo_mempool_slab_realloc(m, size);
+        if(NULL == ret)
+        {
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() no more memory", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+        }
+#if     defined(EOMEMPOOL_USE_TRACE)
+        s_eo_mempool_trace_realloc(m, ret, size);
+#endif
+        return(ret);
+    }
     
     if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
     {
@@ -425,6 +577,10 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
     }
     
     s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);  
+
+#if     defined(EOMEMPOOL_USE_TRACE)
+    s_eo_mempool_trace_realloc(m, ret, size);
+#endif
     
     return(ret);   
 }
@@ -432,16 +588,32 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
 
 extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
 {
+    (void)p;
+    
     if(NULL == m)
     {
         return;
     }
     
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {
+#if     defined(EOMEMPOOL_USE_TRACE)
+        s_eo_mempool_trace_remove(m);
+#endif
+        s_eo_mempool_slab_put(m);
+        return;
+    }
+    
     if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
     {        
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_Delete(): only w/ eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);       
         return;
     }        
+
+#if     defined(EOMEMPOOL_USE_TRACE)
+    // before the release, so that the same address cannot be given meanwhile to another thread
+    s_eo_mempool_trace_remove(m);
+#endif
         
     s_the_mempool.stats.usedbytesheap -= eo_common_msize(m); 
 
@@ -449,6 +621,209 @@ extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
 }
 
 
+extern eOresult_t eo_mempool_SlabStats_Get(EOtheMemoryPool *p, eOmempool_slabstats_t *stats)
+{
+    eOmempool_slab_cache_t *c = NULL;
+    uint32_t inuse = 0;
+    uint8_t cls = 0;
+    
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(eo_mempool_alloc_slab != s_the_mempool.config.mode)
+    {
+        return(eores_NOK_unsupported);
+    }
+    
+    memset(stats, 0, sizeof(eOmempool_slabstats_t));
+    
+    s_eo_mempool_lock();
+    
+    for(cls=0; cls<EOMEMPOOL_SLAB_CLASSES; cls++)
+    {
+        // the blocks in use are the sum of what the threads have taken minus what they have given back
+        inuse = 0;
+        for(c=s_the_mempool.theslab.caches; NULL != c; c=c->next)
+        {
+            inuse += (c->allocs[cls] - c->frees[cls]);
+        }
+        
+        stats->classes[cls].blocksize   = (EOMEMPOOL_SLAB_MINBLOCK << cls);
+        stats->classes[cls].pages       = s_the_mempool.theslab.classes[cls].pages;
+        stats->classes[cls].inuse       = inuse;
+        stats->classes[cls].free        = s_the_mempool.theslab.classes[cls].carved - inuse;
+        
+        stats->pagebytes   += stats->classes[cls].pages * EOMEMPOOL_SLAB_PAGESIZE;
+        stats->inusebytes  += inuse * stats->classes[cls].blocksize;
+    }
+    
+    for(c=s_the_mempool.theslab.caches; NULL != c; c=c->next)
+    {
+        stats->requestedbytes += c->requested;
+    }
+    
+    stats->largebytes = s_the_mempool.theslab.largebytes;
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(eores_OK);
+}
+
+
+extern void * eo_mempool_GetMemoryTraced(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, const char *owner)
+{
+    void *ret = eo_mempool_GetMemory(p, alignmode, size, number);
+    
+    (void)owner;
+    
+#if     defined(EOMEMPOOL_USE_TRACE)
+    if(NULL != ret)
+    {
+        s_eo_mempool_trace_add(eo_mempool_trace_getmemory, owner, ret, (uint32_t)size*number);
+    }
+#endif
+    
+    return(ret);
+}
+
+
+extern void * eo_mempool_NewTraced(EOtheMemoryPool *p, uint32_t size, const char *owner)
+{
+    void *ret = eo_mempool_New(p, size);
+    
+    (void)owner;
+    
+#if     defined(EOMEMPOOL_USE_TRACE)
+    if(NULL != ret)
+    {
+        s_eo_mempool_trace_add(eo_mempool_trace_new, owner, ret, size);
+    }
+#endif
+    
+    return(ret);
+}
+
+
+extern eOresult_t eo_mempool_Trace_Stats_Get(EOtheMemoryPool *p, eOmempool_trace_stats_t *stats)
+{
+#if     defined(EOMEMPOOL_USE_TRACE)
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    s_eo_mempool_lock();
+    stats->totalbytes       = s_the_mempool.thetrace.totalbytes;
+    stats->maxtotalbytes    = s_the_mempool.thetrace.maxtotalbytes;
+    stats->logged           = s_the_mempool.thetrace.logged;
+    stats->lost             = s_the_mempool.thetrace.lost;
+    stats->untracked        = s_the_mempool.thetrace.untracked;
+    stats->owners           = s_the_mempool.thetrace.numowners;
+    stats->filler           = 0;
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(eores_OK);
+#else
+    (void)p;
+    (void)stats;
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern eOresult_t eo_mempool_Trace_Owners_Get(EOtheMemoryPool *p, eOmempool_trace_owner_t *owners, uint16_t capacity, uint16_t *number)
+{
+#if     defined(EOMEMPOOL_USE_TRACE)
+    uint16_t n = 0;
+    
+    if((NULL == p) || (NULL == owners) || (NULL == number))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    s_eo_mempool_lock();
+    n = (s_the_mempool.thetrace.numowners < capacity) ? (s_the_mempool.thetrace.numowners) : (capacity);
+    memcpy(owners, s_the_mempool.thetrace.owners, n*sizeof(eOmempool_trace_owner_t));
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    *number = n;
+    
+    return(eores_OK);
+#else
+    (void)p;
+    (void)owners;
+    (void)capacity;
+    (void)number;
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern eOresult_t eo_mempool_Trace_Dump(EOtheMemoryPool *p, eOmempool_trace_dump_fn_t dump, void *arg)
+{
+#if     defined(EOMEMPOOL_USE_TRACE)
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    uint32_t i = 0;
+    
+    if((NULL == p) || (NULL == dump))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    s_eo_mempool_lock();
+    
+    // the log keeps only the last EOMEMPOOL_TRACE_LOGSIZE entries
+    i = (trace->logged > EOMEMPOOL_TRACE_LOGSIZE) ? (trace->logged - EOMEMPOOL_TRACE_LOGSIZE) : (0);
+    for(; i<trace->logged; i++)
+    {
+        dump(&trace->log[i % EOMEMPOOL_TRACE_LOGSIZE], arg);
+    }
+    trace->logged = 0;
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(eores_OK);
+#else
+    (void)p;
+    (void)dump;
+    (void)arg;
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern eOresult_t eo_mempool_Trace_Reset(EOtheMemoryPool *p)
+{
+#if     defined(EOMEMPOOL_USE_TRACE)
+    uint16_t i = 0;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    s_eo_mempool_lock();
+    
+    for(i=0; i<s_the_mempool.thetrace.numowners; i++)
+    {
+        s_the_mempool.thetrace.owners[i].maxbytes = s_the_mempool.thetrace.owners[i].bytes;
+    }
+    s_the_mempool.thetrace.maxtotalbytes    = s_the_mempool.thetrace.totalbytes;
+    s_the_mempool.thetrace.logged           = 0;
+    s_the_mempool.thetrace.lost             = 0;
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(eores_OK);
+#else
+    (void)p;
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -551,6 +926,550 @@ static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t
     return(ret);
 }
 
+static void * s_eo_mempool_slab_get(uint32_t size)
+{
+    eOmempool_slab_header_t *h = NULL;
+    eOmempool_slab_cache_t *c = NULL;
+    uint32_t total = size + sizeof(eOmempool_slab_header_t);
+    uint8_t cls = 0;
+    
+    while((cls < EOMEMPOOL_SLAB_CLASSES) && (((uint32_t)EOMEMPOOL_SLAB_MINBLOCK << cls) < total))
+    {
+        cls++;
+    }
+    
+    if(EOMEMPOOL_SLAB_CLASSES == cls)
+    {   // beyond the biggest class: it is taken from the heap
+        h = (eOmempool_slab_header_t*) s_the_mempool.theheap.allocate(total);
+        if(NULL == h)
+        {
+            return(NULL);
+        }
+        s_eo_mempool_lock();
+        s_the_mempool.theslab.largebytes += size;
+        s_the_mempool.stats.usedbytesheap += size;
+        eov_mutex_Release(s_the_mempool.mutex);
+        memset(h, 0, total);
+        h->size = size;
+        h->cls  = EOMEMPOOL_SLAB_LARGE;
+        return(h + 1);
+    }
+
+#if     defined(EOMEMPOOL_SLAB_USE_THREADCACHE)    
+    c = s_eo_mempool_slab_cache_get();
+    
+    if(0 == c->count[cls])
+    {   // the mutex is taken only to refill half of the cache
+        s_eo_mempool_lock();
+        while(c->count[cls] < EOMEMPOOL_SLAB_REFILL)
+        {
+            if(NULL == (h = s_eo_mempool_slab_global_get(cls)))
+            {
+                break;
+            }
+            c->blocks[cls][c->count[cls]++] = h;
+        }
+        eov_mutex_Release(s_the_mempool.mutex);
+        
+        if(0 == c->count[cls])
+        {
+            return(NULL);
+        }
+    }
+    
+    h = (eOmempool_slab_header_t*) c->blocks[cls][--c->count[cls]];
+    c->allocs[cls] ++;
+    c->requested += size;
+#else
+    c = &s_eo_mempool_slab_thecache;
+    
+    s_eo_mempool_lock();
+    h = (eOmempool_slab_header_t*) s_eo_mempool_slab_global_get(cls);
+    if(NULL != h)
+    {
+        c->allocs[cls] ++;
+        c->requested += size;
+    }
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    if(NULL == h)
+    {
+        return(NULL);
+    }
+#endif
+    
+    // the memory is zeroed as the one of the heap
+    memset(h, 0, total);
+    h->size = size;
+    h->cls  = cls;
+    
+    return(h + 1);
+}
+
+
+static void s_eo_mempool_slab_put(void *m)
+{
+    eOmempool_slab_header_t *h = ((eOmempool_slab_header_t*)m) - 1;
+    eOmempool_slab_cache_t *c = NULL;
+    uint8_t cls = h->cls;
+    
+    if(EOMEMPOOL_SLAB_LARGE == cls)
+    {
+        s_eo_mempool_lock();
+        s_the_mempool.theslab.largebytes -= h->size;
+        s_the_mempool.stats.usedbytesheap -= h->size;
+        eov_mutex_Release(s_the_mempool.mutex);
+        s_the_mempool.theheap.release(h);
+        return;
+    }
+    
+    if(cls >= EOMEMPOOL_SLAB_CLASSES)
+    {
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Delete(): not a block of the slabs", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+        return;
+    }
+
+#if     defined(EOMEMPOOL_SLAB_USE_THREADCACHE)
+    c = s_eo_mempool_slab_cache_get();
+    
+    if(EOMEMPOOL_SLAB_CACHESIZE == c->count[cls])
+    {   // the mutex is taken only to flush half of the cache
+        s_eo_mempool_lock();
+        while(c->count[cls] > EOMEMPOOL_SLAB_REFILL)
+        {
+            s_eo_mempool_slab_global_put(cls, c->blocks[cls][--c->count[cls]]);
+        }
+        eov_mutex_Release(s_the_mempool.mutex);
+    }
+    
+    c->blocks[cls][c->count[cls]++] = h;
+    c->frees[cls] ++;
+    c->requested -= h->size;
+#else
+    c = &s_eo_mempool_slab_thecache;
+    
+    s_eo_mempool_lock();
+    c->frees[cls] ++;
+    c->requested -= h->size;
+    s_eo_mempool_slab_global_put(cls, h);
+    eov_mutex_Release(s_the_mempool.mutex);
+#endif
+}
+
+
+static void * s_eo_mempool_slab_realloc(void *m, uint32_t size)
+{
+    eOmempool_slab_header_t *h = NULL;
+    void *ret = NULL;
+    
+    ret = s_eo_mempool_slab_get(size);
+    
+    if((NULL == m) || (NULL == ret))
+    {
+        return(ret);
+    }
+    
+    h = ((eOmempool_slab_header_t*)m) - 1;
+    memcpy(ret, m, (h->size < size) ? (h->size) : (size));
+    s_eo_mempool_slab_put(m);
+    
+    return(ret);
+}
+
+
+// it is called under the mutex
+static void * s_eo_mempool_slab_global_get(uint8_t cls)
+{
+    eOmempool_the_slab_t *slab = &s_the_mempool.theslab;
+    eOmempool_slab_class_t *cl = &slab->classes[cls];
+    uint32_t blocksize = (EOMEMPOOL_SLAB_MINBLOCK << cls);
+    uint8_t *page = NULL;
+    void *block = NULL;
+    
+    if(NULL != cl->freelist)
+    {
+        block = cl->freelist;
+        cl->freelist = *((void**)block);
+        return(block);
+    }
+    
+    if(0 == cl->left)
+    {   // a new page, from the arena if any, else from the heap
+        if(NULL != slab->config.data)
+        {
+            if((slab->arenaindex + EOMEMPOOL_SLAB_PAGESIZE) <= slab->config.size)
+            {
+                page = ((uint8_t*)slab->config.data) + slab->arenaindex;
+                slab->arenaindex += EOMEMPOOL_SLAB_PAGESIZE;
+            }
+        }
+        else
+        {
+            page = (uint8_t*) s_the_mempool.theheap.allocate(EOMEMPOOL_SLAB_PAGESIZE);
+        }
+        
+        if(NULL == page)
+        {
+            return(NULL);
+        }
+        
+        cl->page = page;
+        cl->left = EOMEMPOOL_SLAB_PAGESIZE / blocksize;
+        cl->pages ++;
+        s_the_mempool.stats.usedbytespool += EOMEMPOOL_SLAB_PAGESIZE;
+    }
+    
+    // the page is carved one block at a time, so that the cost stays constant
+    block = cl->page;
+    cl->page += blocksize;
+    cl->left --;
+    cl->carved ++;
+    
+    return(block);
+}
+
+
+// it is called under the mutex
+static void s_eo_mempool_slab_global_put(uint8_t cls, void *block)
+{
+    *((void**)block) = s_the_mempool.theslab.classes[cls].freelist;
+    s_the_mempool.theslab.classes[cls].freelist = block;
+}
+
+
+static eOmempool_slab_cache_t * s_eo_mempool_slab_cache_get(void)
+{
+#if     defined(EOMEMPOOL_SLAB_USE_THREADCACHE)
+    eOmempool_slab_cache_t *c = s_eo_mempool_slab_thecache;
+    
+    if(NULL == c)
+    {   // the first use by the thread: it takes the cache left by a thread which has exited, else a new one. the caches 
+        // stay in the list of the caches for the statistics
+        s_eo_mempool_lock();
+        for(c=s_the_mempool.theslab.caches; (NULL != c) && (eobool_true == c->owned); c=c->next);
+        if(NULL == c)
+        {
+            c = (eOmempool_slab_cache_t*) s_the_mempool.theheap.allocate(sizeof(eOmempool_slab_cache_t));
+            if(NULL == c)
+            {
+                eov_mutex_Release(s_the_mempool.mutex);
+                eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool: no memory for a slab cache", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+                return(NULL);
+            }
+            memset(c, 0, sizeof(eOmempool_slab_cache_t));
+            c->next = s_the_mempool.theslab.caches;
+            s_the_mempool.theslab.caches = c;
+        }
+        c->owned = eobool_true;
+        eov_mutex_Release(s_the_mempool.mutex);
+        
+        s_eo_mempool_slab_thecache = c;
+        pthread_setspecific(s_eo_mempool_slab_threadkey, c);
+    }
+    
+    return(c);
+#else
+    return(&s_eo_mempool_slab_thecache);
+#endif
+}
+
+
+#if     defined(EOMEMPOOL_SLAB_USE_THREADCACHE)
+// the destructor of the key: the thread exits, thus the blocks of its cache go back to the classes
+static void s_eo_mempool_slab_cache_release(void *arg)
+{
+    eOmempool_slab_cache_t *c = (eOmempool_slab_cache_t*) arg;
+    uint8_t cls = 0;
+    
+    s_eo_mempool_lock();
+    for(cls=0; cls<EOMEMPOOL_SLAB_CLASSES; cls++)
+    {
+        while(c->count[cls] > 0)
+        {
+            s_eo_mempool_slab_global_put(cls, c->blocks[cls][--c->count[cls]]);
+        }
+    }
+    c->owned = eobool_false;
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    s_eo_mempool_slab_thecache = NULL;
+}
+#endif
+
+
+static void s_eo_mempool_lock(void)
+{
+    // attempt to lock mutex if it is null it will return nok_nullpointer, else ok or nok_timeout.
+    if(eores_NOK_timeout == eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout))
+    {
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_mutex_timeout;
+        errdes.par16            = s_the_mempool.tout / 1000;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "s_eo_mempool_lock(): mutex_take() tout", s_eobj_ownname, &errdes);
+    }
+}
+
+
+#if     defined(EOMEMPOOL_USE_TRACE)
+
+static void s_eo_mempool_trace_add(eOmempool_trace_op_t op, const char *owner, void *ptr, uint32_t size)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    eOmempool_trace_owner_t *o = NULL;
+    uint16_t i = 0;
+    
+    s_eo_mempool_lock();
+    
+    i = s_eo_mempool_trace_owner_get(owner);
+    
+    if(EOMEMPOOL_TRACE_NOOWNER == i)
+    {
+        trace->untracked ++;
+    }
+    else
+    {
+        o = &trace->owners[i];
+        o->allocs ++;
+        o->bytes += size;
+        if(o->bytes > o->maxbytes)
+        {
+            o->maxbytes = o->bytes;
+        }
+        
+        trace->totalbytes += size;
+        if(trace->totalbytes > trace->maxtotalbytes)
+        {
+            trace->maxtotalbytes = trace->totalbytes;
+        }
+        
+        // only in dynamic and slab mode the memory can be released, thus only there the pointer is followed
+        if((eo_mempool_alloc_dynamic == s_the_mempool.config.mode) || (eo_mempool_alloc_slab == s_the_mempool.config.mode))
+        {
+            if(eobool_false == s_eo_mempool_trace_live_insert(ptr, size, i))
+            {
+                trace->untracked ++;
+            }
+        }
+    }
+    
+    s_eo_mempool_trace_log(op, owner, ptr, size);
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+}
+
+
+static void s_eo_mempool_trace_remove(void *ptr)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    eOmempool_trace_live_t *item = NULL;
+    eOmempool_trace_owner_t *o = NULL;
+    
+    s_eo_mempool_lock();
+    
+    item = s_eo_mempool_trace_live_find(ptr);
+    
+    if(NULL == item)
+    {
+        trace->untracked ++;
+        s_eo_mempool_trace_log(eo_mempool_trace_delete, NULL, ptr, 0);
+    }
+    else
+    {
+        o = &trace->owners[item->owner];
+        o->frees ++;
+        o->bytes -= item->size;
+        trace->totalbytes -= item->size;
+        s_eo_mempool_trace_log(eo_mempool_trace_delete, o->owner, ptr, item->size);
+        s_eo_mempool_trace_live_erase(item);
+    }
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+}
+
+
+static void s_eo_mempool_trace_realloc(void *old, void *ptr, uint32_t size)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    eOmempool_trace_live_t *item = NULL;
+    eOmempool_trace_owner_t *o = NULL;
+    uint16_t i = 0;
+    
+    if(NULL == ptr)
+    {
+        return;
+    }
+    
+    s_eo_mempool_lock();
+    
+    item = (NULL == old) ? (NULL) : (s_eo_mempool_trace_live_find(old));
+    
+    if(NULL == item)
+    {   // the owner is unknown
+        trace->untracked ++;
+        s_eo_mempool_trace_log(eo_mempool_trace_realloc, NULL, ptr, size);
+    }
+    else
+    {   // the memory stays with the owner of the old pointer
+        i = item->owner;
+        o = &trace->owners[i];
+        o->bytes = o->bytes - item->size + size;
+        if(o->bytes > o->maxbytes)
+        {
+            o->maxbytes = o->bytes;
+        }
+        
+        trace->totalbytes = trace->totalbytes - item->size + size;
+        if(trace->totalbytes > trace->maxtotalbytes)
+        {
+            trace->maxtotalbytes = trace->totalbytes;
+        }
+        
+        s_eo_mempool_trace_live_erase(item);
+        s_eo_mempool_trace_live_insert(ptr, size, i);
+        s_eo_mempool_trace_log(eo_mempool_trace_realloc, o->owner, ptr, size);
+    }
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+}
+
+
+static uint16_t s_eo_mempool_trace_owner_get(const char *owner)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    uint16_t i = 0;
+    
+    if(NULL == owner)
+    {
+        return(EOMEMPOOL_TRACE_NOOWNER);
+    }
+    
+    // every file has its own s_eobj_ownname, thus the pointers are compared
+    for(i=0; i<trace->numowners; i++)
+    {
+        if(owner == trace->owners[i].owner)
+        {
+            return(i);
+        }
+    }
+    
+    if(EOMEMPOOL_TRACE_OWNERS == trace->numowners)
+    {
+        return(EOMEMPOOL_TRACE_NOOWNER);
+    }
+    
+    memset(&trace->owners[i], 0, sizeof(eOmempool_trace_owner_t));
+    trace->owners[i].owner = owner;
+    trace->numowners ++;
+    
+    return(i);
+}
+
+
+static void s_eo_mempool_trace_log(eOmempool_trace_op_t op, const char *owner, void *ptr, uint32_t size)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    eOmempool_trace_entry_t *entry = &trace->log[trace->logged % EOMEMPOOL_TRACE_LOGSIZE];
+    
+    if(trace->logged >= EOMEMPOOL_TRACE_LOGSIZE)
+    {
+        trace->lost ++;
+    }
+    
+    entry->time         = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    entry->owner        = owner;
+    entry->ptr          = ptr;
+    entry->size         = size;
+    entry->totalbytes   = trace->totalbytes;
+    entry->op           = (uint8_t)op;
+    
+    trace->logged ++;
+}
+
+
+static uint32_t s_eo_mempool_trace_hash(void *ptr)
+{
+    return(((uint32_t)(((uintptr_t)ptr) >> 3) * 2654435761u) & (EOMEMPOOL_TRACE_LIVE - 1));
+}
+
+
+static eObool_t s_eo_mempool_trace_live_insert(void *ptr, uint32_t size, uint16_t owner)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    uint32_t i = s_eo_mempool_trace_hash(ptr);
+    
+    // the table is kept at most 3/4 full so that the probes stay short
+    if(trace->livenumber >= (3*EOMEMPOOL_TRACE_LIVE/4))
+    {
+        return(eobool_false);
+    }
+    
+    while(NULL != trace->live[i].ptr)
+    {
+        i = (i + 1) & (EOMEMPOOL_TRACE_LIVE - 1);
+    }
+    
+    trace->live[i].ptr      = ptr;
+    trace->live[i].size     = size;
+    trace->live[i].owner    = owner;
+    trace->livenumber ++;
+    
+    return(eobool_true);
+}
+
+
+static eOmempool_trace_live_t * s_eo_mempool_trace_live_find(void *ptr)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    uint32_t i = s_eo_mempool_trace_hash(ptr);
+    
+    while(NULL != trace->live[i].ptr)
+    {
+        if(ptr == trace->live[i].ptr)
+        {
+            return(&trace->live[i]);
+        }
+        i = (i + 1) & (EOMEMPOOL_TRACE_LIVE - 1);
+    }
+    
+    return(NULL);
+}
+
+
+static void s_eo_mempool_trace_live_erase(eOmempool_trace_live_t *item)
+{
+    eOmempool_the_trace_t *trace = &s_the_mempool.thetrace;
+    uint32_t i = item - trace->live;
+    uint32_t j = i;
+    uint32_t k = 0;
+    
+    // the items which follow in the same cluster are moved back unless they are already between their hash and the hole
+    for(;;)
+    {
+        j = (j + 1) & (EOMEMPOOL_TRACE_LIVE - 1);
+        if(NULL == trace->live[j].ptr)
+        {
+            break;
+        }
+        
+        k = s_eo_mempool_trace_hash(trace->live[j].ptr);
+        if((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j)))
+        {
+            continue;
+        }
+        
+        trace->live[i] = trace->live[j];
+        i = j;
+    }
+    
+    trace->live[i].ptr = NULL;
+    trace->livenumber --;
+}
+
+#endif
+
+
 static void * s_memallocator(uint32_t s)
 {
     return(calloc(s, 1));
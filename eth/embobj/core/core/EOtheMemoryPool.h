@@ -41,6 +41,15 @@ extern "C" {
     If initialised to work in static mode, the user must pass to the singleton some memory pools where to get memory. If it is
     defined the mixed mode, the singleton shall get memory from the heap if the pool is not defined.
     In static and mixed mode it is possible to allocate memory but not to reallocate and release it.
+    In slab mode the memory is given in blocks of a few size classes, which are carved from pages taken from a user
+    arena or from the heap. The released blocks are kept in a free list per size class, so that allocation and
+    release have constant cost and memory is reused without fragmentation of the heap. On linux and macos, each
+    thread keeps a small cache of blocks per class and takes the mutex only to refill or flush it. When a thread ends
+    its blocks go back to the free lists and its cache is given to the next thread.
+    If the code is compiled with EOMEMPOOL_USE_TRACE defined, every call of eo_mempool_GetMemory() and eo_mempool_New()
+    is tagged with the s_eobj_ownname of the calling file, so that the singleton keeps for each owner the number
+    of allocations and releases, the bytes in use and their high-water mark, and a log of the last operations
+    which can be dumped for offline analysis.
         
     It is responsibility of the object EOVtheSystem (via its derived object) to initialise the EOtheMemoryPool. 
 
@@ -59,7 +68,21 @@ extern "C" {
 
 
 // - public #define  --------------------------------------------------------------------------------------------------
-// empty-section
+
+#define EOMEMPOOL_SLAB_CLASSES          8
+
+// the sizes of the tables of the trace, used only with EOMEMPOOL_USE_TRACE. they can be redefined in the build
+#if     !defined(EOMEMPOOL_TRACE_OWNERS)
+#define EOMEMPOOL_TRACE_OWNERS          48
+#endif
+
+#if     !defined(EOMEMPOOL_TRACE_LOGSIZE)
+#define EOMEMPOOL_TRACE_LOGSIZE         256
+#endif
+
+#if     !defined(EOMEMPOOL_TRACE_LIVE)
+#define EOMEMPOOL_TRACE_LIVE            1024    /**< the pointers which can be released that are followed. a power of 2 */
+#endif
   
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
@@ -80,7 +103,8 @@ typedef enum
 {
     eo_mempool_alloc_dynamic    = 0,
     eo_mempool_alloc_static     = 1,
-    eo_mempool_alloc_mixed      = 2
+    eo_mempool_alloc_mixed      = 2,
+    eo_mempool_alloc_slab       = 3
 } eOmempool_alloc_mode_t;
 
 typedef struct 
@@ -103,10 +127,17 @@ typedef struct
     uint64_t*                   data64;    
 } eOmempool_pool_config_t;
 
+typedef struct 
+{
+    uint32_t                    size;       /**< the size of the arena in bytes */
+    uint64_t*                   data;       /**< the arena where to take the pages from. if NULL they come from the heap */
+} eOmempool_slab_config_t;
+
 typedef union
 {
     eOmempool_pool_config_t     pool;
     eOmempool_heap_config_t     heap;
+    eOmempool_slab_config_t     slab;
 } eOmempool_alloc_config_t;
 
 
@@ -120,6 +151,32 @@ typedef struct
 } eOmempool_cfg_t;
 
 
+/**	@typedef    typedef struct eOmempool_slabclass_stats_t 
+ 	@brief      Contains the statistics of a size class of the eo_mempool_alloc_slab mode. 
+ **/ 
+typedef struct
+{
+    uint32_t                    blocksize;  /**< the size of the blocks of the class, header included */
+    uint32_t                    pages;      /**< the pages carved into blocks of the class */
+    uint32_t                    inuse;      /**< the blocks given to the user */
+    uint32_t                    free;       /**< the blocks ready to be given, in the free list or in the thread caches */
+} eOmempool_slabclass_stats_t;
+
+
+/**	@typedef    typedef struct eOmempool_slabstats_t 
+ 	@brief      Contains the statistics of the eo_mempool_alloc_slab mode. The internal fragmentation is the difference
+                between inusebytes and requestedbytes, the external one is given by the free blocks of each class.
+ **/ 
+typedef struct
+{
+    eOmempool_slabclass_stats_t classes[EOMEMPOOL_SLAB_CLASSES];
+    uint32_t                    pagebytes;      /**< the bytes of all the pages */
+    uint32_t                    inusebytes;     /**< the bytes of the blocks in use */
+    uint32_t                    requestedbytes; /**< the bytes requested for the blocks in use */
+    uint32_t                    largebytes;     /**< the bytes requested beyond the biggest class, which are taken from the heap */
+} eOmempool_slabstats_t;
+
+
 /**	@typedef    typedef enum eOmempool_alignment_t 
  	@brief      Contains the alignment types for the memory. it is relevant only to non-heap allocation (eo_mempool_alloc_static or 
                 eo_mempool_alloc_mixed modes). in eo_mempool_alloc_dynamic mode the singleton always use eo_mempool_align_auto. 
@@ -132,6 +189,68 @@ typedef enum
     eo_mempool_align_32bit  = 4,    /**< used with eo_mempool_alloc_static or eo_mempool_alloc_mixed to force 4-bytes alignment */
     eo_mempool_align_64bit  = 8     /**< used with eo_mempool_alloc_static or eo_mempool_alloc_mixed to force 8-bytes alignment */
 } eOmempool_alignment_t;
+
+
+/**	@typedef    typedef enum eOmempool_trace_op_t 
+ 	@brief      The operation recorded in an entry of the log of the trace. 
+ **/ 
+typedef enum
+{
+    eo_mempool_trace_getmemory  = 0,
+    eo_mempool_trace_new        = 1,
+    eo_mempool_trace_realloc    = 2,
+    eo_mempool_trace_delete     = 3
+} eOmempool_trace_op_t;
+
+
+/**	@typedef    typedef struct eOmempool_trace_owner_t 
+ 	@brief      Contains the statistics of an owner of memory, that is of a file which has called eo_mempool_GetMemory()
+                or eo_mempool_New(). 
+ **/ 
+typedef struct
+{
+    const char*                 owner;      /**< the s_eobj_ownname of the file */
+    uint32_t                    allocs;
+    uint32_t                    frees;
+    uint32_t                    bytes;      /**< the requested bytes still in use */
+    uint32_t                    maxbytes;   /**< the high-water mark of bytes */
+} eOmempool_trace_owner_t;
+
+
+/**	@typedef    typedef struct eOmempool_trace_entry_t 
+ 	@brief      An entry of the log of the trace. 
+ **/ 
+typedef struct
+{
+    eOabstime_t                 time;       /**< the lifetime of the system, or 0 if it is not started yet */
+    const char*                 owner;      /**< NULL for a release of a pointer which the trace does not follow */
+    void*                       ptr;
+    uint32_t                    size;       /**< the requested bytes, or the released ones */
+    uint32_t                    totalbytes; /**< the requested bytes in use by all the owners after the operation */
+    uint8_t                     op;         /**< use eOmempool_trace_op_t */
+    uint8_t                     filler[7];
+} eOmempool_trace_entry_t;
+
+
+/**	@typedef    typedef struct eOmempool_trace_stats_t 
+ 	@brief      Contains the global statistics of the trace. 
+ **/ 
+typedef struct
+{
+    uint32_t                    totalbytes;     /**< the requested bytes in use by all the owners */
+    uint32_t                    maxtotalbytes;  /**< the high-water mark of totalbytes */
+    uint32_t                    logged;         /**< the entries written in the log since the last reset */
+    uint32_t                    lost;           /**< the entries overwritten before being dumped */
+    uint32_t                    untracked;      /**< the operations not accounted for lack of room in the tables */
+    uint16_t                    owners;         /**< the number of owners */
+    uint16_t                    filler;
+} eOmempool_trace_stats_t;
+
+
+/**	@typedef    typedef void (*eOmempool_trace_dump_fn_t)(const eOmempool_trace_entry_t *entry, void *arg) 
+ 	@brief      The function called by eo_mempool_Trace_Dump() for each entry of the log. 
+ **/ 
+typedef void (*eOmempool_trace_dump_fn_t)(const eOmempool_trace_entry_t *entry, void *arg);
    
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
@@ -156,6 +275,8 @@ extern const eOmempool_cfg_t eom_mempool_DefaultCfg; // = {eo_mempool_alloc_dyna
                                 pointer or zero size.
                                 In case of eo_mempool_alloc_dynamic the memory is assigned
                                 only from the heap. 
+                                In case of eo_mempool_alloc_slab the memory is assigned in blocks of size classes
+                                taken from the arena in conf->slab or, if conf is NULL or its data is NULL, from the heap.
                                 A NULL value for cfg is a shortcut for the mode eo_mempool_alloc_dynamic.
     @return     Pointer to the required EOtheMemoryPool singleton (or NULL upon un-initialised singleton).
  **/
@@ -226,6 +347,7 @@ extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p);
     @return     The required memory if available. NULL if the requested memory was zero but with a warning given
                 to the EOtheErrorManager. Issues a fatal error to the EOtheErrorManager if there was not memory anymore. 
     @warning    This can be used also if the singleton is in static/mixed mode. It uses heap, however.
+                In eo_mempool_alloc_slab mode it uses the slabs.
  **/ 
 extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size);
 
@@ -241,6 +363,7 @@ extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size);
                 to the EOtheErrorManager. Issues a fatal error to the EOtheErrorManager if there was not memory anymore. 
     @warning    This can be used also if the singleton is in static/mixed mode. It uses heap, however. 
                 VERY IMPORTANT: it cannot be used with pointers coming from static allocation. The user MUST pay attention to use it properly.
+                In eo_mempool_alloc_slab mode it uses the slabs.
  **/ 
 extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size);
  
@@ -254,10 +377,87 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size);
     @warning    This can be used also if the singleton is in static/mixed mode. It deletes heap, however. 
                 VERY IMPORTANT: it cannot be used with pointers coming from static allocation. The user MUST pay attention 
                 to use it properly.
+                In eo_mempool_alloc_slab mode it releases every memory given by the singleton.
  **/  
 extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m);
 
 
+/** @fn         extern eOresult_t eo_mempool_SlabStats_Get(EOtheMemoryPool *p, eOmempool_slabstats_t *stats)
+    @brief      Gives the statistics of occupation and fragmentation of the eo_mempool_alloc_slab mode. The counters
+                of the threads are read without locks, thus they are exact only if no thread is allocating.
+    @param      p               The mempool singleton   
+    @param      stats           Filled with the statistics.
+    @return     eores_OK, eores_NOK_nullpointer, or eores_NOK_unsupported if the mode is not eo_mempool_alloc_slab.
+ **/  
+extern eOresult_t eo_mempool_SlabStats_Get(EOtheMemoryPool *p, eOmempool_slabstats_t *stats);
+
+
+/** @fn         extern void * eo_mempool_GetMemoryTraced(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, 
+                                                         uint16_t size, uint16_t number, const char *owner)
+    @brief      As eo_mempool_GetMemory() but the memory is accounted to @e owner. With EOMEMPOOL_USE_TRACE the
+                macro eo_mempool_GetMemory() calls it with the s_eobj_ownname of the calling file. Without it the
+                owner is ignored.
+    @param      owner           The owner of the memory. It must be a string which lives forever.
+ **/ 
+extern void * eo_mempool_GetMemoryTraced(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, const char *owner);
+
+
+/** @fn         extern void * eo_mempool_NewTraced(EOtheMemoryPool *p, uint32_t size, const char *owner)
+    @brief      As eo_mempool_New() but the memory is accounted to @e owner. With EOMEMPOOL_USE_TRACE the macro 
+                eo_mempool_New() calls it with the s_eobj_ownname of the calling file. Without it the owner is ignored.
+    @param      owner           The owner of the memory. It must be a string which lives forever.
+ **/ 
+extern void * eo_mempool_NewTraced(EOtheMemoryPool *p, uint32_t size, const char *owner);
+
+
+/** @fn         extern eOresult_t eo_mempool_Trace_Stats_Get(EOtheMemoryPool *p, eOmempool_trace_stats_t *stats)
+    @brief      Gives the global statistics of the trace.
+    @param      p               The mempool singleton   
+    @param      stats           Filled with the statistics.
+    @return     eores_OK, eores_NOK_nullpointer, or eores_NOK_unsupported if EOMEMPOOL_USE_TRACE is not defined.
+ **/  
+extern eOresult_t eo_mempool_Trace_Stats_Get(EOtheMemoryPool *p, eOmempool_trace_stats_t *stats);
+
+
+/** @fn         extern eOresult_t eo_mempool_Trace_Owners_Get(EOtheMemoryPool *p, eOmempool_trace_owner_t *owners,
+                                                              uint16_t capacity, uint16_t *number)
+    @brief      Copies the statistics of the owners in the order of their first allocation.
+    @param      p               The mempool singleton   
+    @param      owners          Filled with at most @e capacity owners.
+    @param      capacity        The capacity of @e owners.
+    @param      number          Filled with the number of copied owners.
+    @return     eores_OK, eores_NOK_nullpointer, or eores_NOK_unsupported if EOMEMPOOL_USE_TRACE is not defined.
+ **/  
+extern eOresult_t eo_mempool_Trace_Owners_Get(EOtheMemoryPool *p, eOmempool_trace_owner_t *owners, uint16_t capacity, uint16_t *number);
+
+
+/** @fn         extern eOresult_t eo_mempool_Trace_Dump(EOtheMemoryPool *p, eOmempool_trace_dump_fn_t dump, void *arg)
+    @brief      Calls @e dump for each entry in the log, from the oldest to the newest, and empties the log.
+    @param      p               The mempool singleton   
+    @param      dump            The function which receives the entries. It is called with the mutex of the 
+                                singleton taken, thus it must not allocate or release memory with it.
+    @param      arg             The argument of @e dump.
+    @return     eores_OK, eores_NOK_nullpointer, or eores_NOK_unsupported if EOMEMPOOL_USE_TRACE is not defined.
+ **/  
+extern eOresult_t eo_mempool_Trace_Dump(EOtheMemoryPool *p, eOmempool_trace_dump_fn_t dump, void *arg);
+
+
+/** @fn         extern eOresult_t eo_mempool_Trace_Reset(EOtheMemoryPool *p)
+    @brief      Empties the log and brings the high-water marks to the bytes in use, so that the growth of memory
+                in a phase of the application (e.g. a reconfiguration) can be measured.
+    @param      p               The mempool singleton   
+    @return     eores_OK, eores_NOK_nullpointer, or eores_NOK_unsupported if EOMEMPOOL_USE_TRACE is not defined.
+ **/  
+extern eOresult_t eo_mempool_Trace_Reset(EOtheMemoryPool *p);
+
+
+// with the trace the allocations are tagged with the s_eobj_ownname that every file of embobj defines
+#if     defined(EOMEMPOOL_USE_TRACE)
+#define eo_mempool_GetMemory(p, alignmode, size, number)    eo_mempool_GetMemoryTraced((p), (alignmode), (size), (number), s_eobj_ownname)
+#define eo_mempool_New(p, size)                             eo_mempool_NewTraced((p), (size), s_eobj_ownname)
+#endif
+
+
 
 /** @}            
     end of group eo_thememorypool  
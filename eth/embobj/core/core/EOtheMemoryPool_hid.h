@@ -56,6 +56,69 @@ typedef struct
     uint32_t    usedbytespool;
 } eOmempool_stats_t;
 
+#define EOMEMPOOL_SLAB_CACHESIZE    32
+
+// a size class of the slab mode. it is used under the mutex
+typedef struct
+{
+    void                            *freelist;  // linked through the first word of the blocks
+    uint8_t                         *page;      // the page which is being carved
+    uint32_t                        left;       // the blocks still to be carved from page
+    uint32_t                        pages;
+    uint32_t                        carved;
+} eOmempool_slab_class_t;
+
+// the cache of a thread. only its thread uses it, apart from the reading of the counters. when the thread exits its 
+// blocks go back to the classes and the cache is kept, with its counters, for the next thread
+typedef struct eOmempool_slab_cache_hid eOmempool_slab_cache_t;
+struct eOmempool_slab_cache_hid
+{
+    eOmempool_slab_cache_t          *next;
+    eObool_t                        owned;      // a thread uses it. it is changed under the mutex
+    uint16_t                        count[EOMEMPOOL_SLAB_CLASSES];
+    void                            *blocks[EOMEMPOOL_SLAB_CLASSES][EOMEMPOOL_SLAB_CACHESIZE];
+    uint32_t                        allocs[EOMEMPOOL_SLAB_CLASSES];
+    uint32_t                        frees[EOMEMPOOL_SLAB_CLASSES];
+    uint32_t                        requested;  // can wrap if this thread frees what others allocate: the sum is right
+};
+
+typedef struct
+{
+    eOmempool_slab_config_t         config;
+    uint32_t                        arenaindex;
+    uint32_t                        largebytes;
+    eOmempool_slab_class_t          classes[EOMEMPOOL_SLAB_CLASSES];
+    eOmempool_slab_cache_t          *caches;    // the list of the caches of all the threads
+} eOmempool_the_slab_t;
+
+#if     defined(EOMEMPOOL_USE_TRACE)
+
+// a pointer which can be released, with the owner and the size it was given
+typedef struct
+{
+    void                            *ptr;
+    uint32_t                        size;
+    uint16_t                        owner;      // index in owners[]
+    uint16_t                        filler;
+} eOmempool_trace_live_t;
+
+// it is used under the mutex
+typedef struct
+{
+    eOmempool_trace_owner_t         owners[EOMEMPOOL_TRACE_OWNERS];
+    eOmempool_trace_entry_t         log[EOMEMPOOL_TRACE_LOGSIZE];       // circular: the newest is at (logged-1)
+    eOmempool_trace_live_t          live[EOMEMPOOL_TRACE_LIVE];         // open addressing with linear probing
+    uint32_t                        logged;
+    uint32_t                        lost;
+    uint32_t                        untracked;
+    uint32_t                        livenumber;
+    uint32_t                        totalbytes;
+    uint32_t                        maxtotalbytes;
+    uint16_t                        numowners;
+} eOmempool_the_trace_t;
+
+#endif
+
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 struct EOtheMemoryPool_hid 
@@ -64,9 +127,13 @@ struct EOtheMemoryPool_hid
     eOmempool_cfg_t                 config;
     eOmempool_heap_config_t         theheap;
     eOmempool_the_pool_t            thepool;
+    eOmempool_the_slab_t            theslab;
     EOVmutex                        *mutex;
     eOreltime_t                     tout;
     eOmempool_stats_t               stats;
+#if     defined(EOMEMPOOL_USE_TRACE)
+    eOmempool_the_trace_t           thetrace;   // the last field, so that it is initialised only with the trace
+#endif
 }; 
 
 
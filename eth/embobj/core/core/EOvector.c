@@ -42,6 +42,16 @@
 #include "EOvector_hid.h" 
 
 
+// the keys of 32 bits are compared four at a time where there is a SIMD unit
+#if     defined(__SSE2__)
+#define EOVECTOR_USE_SSE2
+#include <emmintrin.h>
+#elif   defined(__ARM_NEON) && defined(__aarch64__)
+#define EOVECTOR_USE_NEON
+#include <arm_neon.h>
+#endif
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
@@ -69,6 +79,9 @@
 
 static eOresult_t s_eo_vector_default_matching_rule(EOvector * vector, void *item, void *param);
 
+static eOsizecntnr_t s_eo_vector_lowerbound32(EOvector * vector, uint32_t key);
+static eOsizecntnr_t s_eo_vector_scan32(EOvector * vector, uint32_t key);
+
 
 
 EO_static_inline void s_eo_vector_default_clear(void *item, EOvector* vector)
@@ -89,6 +102,14 @@ EO_static_inline void s_eo_vector_default_init(void* item,  EOvector* vector)
     memset(item, 0, vector->item_size);
 }
 
+EO_static_inline uint32_t s_eo_vector_key32(EOvector* vector, const uint8_t *item)
+{
+    uint32_t key = 0;
+    // memcpy() because the key may be not aligned. it becomes a single load
+    memcpy(&key, &item[vector->keyoffset], sizeof(uint32_t));
+    return(key);
+}
+
 //EO_static_inline void s_eo_vector_default_initall(EOvector* vector)
 //{
 //    memset(vector->stored_items, 0, vector->capacity*vector->item_size);
@@ -129,6 +150,8 @@ extern EOvector * eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 
     retptr->item_size           = item_size;
     retptr->dummy               = 0;
+    retptr->keyoffset           = 0;
+    retptr->keymode             = EOVECTOR_KEY32_NONE;
     retptr->capacity            = capacity;
     retptr->functions           = NULL;
     if((NULL != item_init) || (NULL != item_copy) || (NULL != item_clear))
@@ -451,6 +474,24 @@ extern eOsizecntnr_t eo_vector_Size(EOvector * vector)
 }
 
 
+extern uint32_t eo_vector_Footprint(EOvector * vector) 
+{
+    uint32_t bytes = 0;
+    
+    if(NULL == vector) 
+    {    // invalid vector
+        return(0);    
+    }
+    
+    bytes = sizeof(EOvector);
+    bytes += (NULL == vector->functions) ? (0) : (sizeof(EOcontainer_functions_t));
+    // in dynamic mode the stored_items are reallocated to hold just the current items
+    bytes += (uint32_t)vector->item_size * ((eo_vectorcapacity_dynamic == vector->capacity) ? (vector->size) : (vector->capacity));
+    
+    return(bytes);        
+}
+
+
 extern void eo_vector_Clear(EOvector * vector) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
@@ -792,6 +833,153 @@ extern eObool_t eo_vector_Find(EOvector * vector, eOresult_t (matching_rule)(voi
 }
 
 
+extern void eo_vector_Key32_Set(EOvector * vector, uint8_t keyoffset, eObool_t sorted)
+{
+    if(NULL == vector) 
+    {
+        return;
+    }
+    
+    eo_errman_Assert(eo_errman_GetHandle(), (((uint32_t)keyoffset + sizeof(uint32_t)) <= vector->item_size), "eo_vector_Key32_Set(): key beyond the item", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), ((eobool_false == sorted) || (0 == vector->size)), "eo_vector_Key32_Set(): cannot sort a non empty vector", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    
+    vector->keyoffset   = keyoffset;
+    vector->keymode     = (eobool_true == sorted) ? (EOVECTOR_KEY32_SORTED) : (EOVECTOR_KEY32_UNSORTED);
+}
+
+
+extern eObool_t eo_vector_FindKey32(EOvector * vector, uint32_t key, eOsizecntnr_t *position)
+{
+    eOsizecntnr_t pos = 0;
+    
+    if((NULL == vector) || (EOVECTOR_KEY32_NONE == vector->keymode) || (0 == vector->size)) 
+    {   // invalid vector or nothing to search
+        return(eobool_false);    
+    }
+    
+    if(EOVECTOR_KEY32_SORTED == vector->keymode)
+    {
+        pos = s_eo_vector_lowerbound32(vector, key);
+        if((pos == vector->size) || (key != s_eo_vector_key32(vector, &((uint8_t*)vector->stored_items)[(uint32_t)pos * vector->item_size])))
+        {
+            return(eobool_false);
+        }
+    }
+    else
+    {
+        pos = s_eo_vector_scan32(vector, key);
+        if(pos == vector->size)
+        {
+            return(eobool_false);
+        }
+    }
+    
+    if(NULL != position)
+    {
+        *position = pos;
+    }
+    
+    return(eobool_true);
+}
+
+
+extern eOresult_t eo_vector_InsertSorted(EOvector * vector, void *p, eOsizecntnr_t *position)
+{
+    // here we require uint8_t to access stored_items because we work with bytes.
+    uint8_t *start = NULL;
+    uint8_t *item = NULL;
+    eOsizecntnr_t pos = 0;
+    
+    if((NULL == vector) || (NULL == p)) 
+    {   // invalid data
+        return(eores_NOK_nullpointer);    
+    }
+    
+    if(EOVECTOR_KEY32_SORTED != vector->keymode)
+    {
+        return(eores_NOK_unsupported);
+    }
+    
+    if(vector->capacity == vector->size) 
+    {   // vector is full
+        return(eores_NOK_busy);
+    }
+    
+    if(eo_vectorcapacity_dynamic == vector->capacity)
+    {   // in here i dont make any control because in _New() we have already verified that mempool is dynamic 
+        vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size+1) * vector->item_size);
+    }
+    
+    pos = s_eo_vector_lowerbound32(vector, s_eo_vector_key32(vector, (const uint8_t*)p));
+    
+    start = (uint8_t*) (vector->stored_items);
+    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
+    item = &start[(uint32_t)pos * vector->item_size]; 
+    
+    // the items from pos move one position ahead
+    memmove(item + vector->item_size, item, (uint32_t)(vector->size - pos) * vector->item_size); 
+    
+    if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn))
+    {
+        vector->functions->item_copy_fn(item, p);
+    }
+    else
+    {
+        s_eo_vector_default_copy(item, p, vector);
+    }
+    
+    vector->size ++;
+    
+    if(NULL != position)
+    {
+        *position = pos;
+    }
+    
+    return(eores_OK); 
+}
+
+
+extern void eo_vector_Erase(EOvector * vector, eOsizecntnr_t pos)
+{
+    // here we require uint8_t to access stored_items because we work with bytes.
+    uint8_t *start = NULL;
+    uint8_t *item = NULL;
+    
+    if(NULL == vector) 
+    {   // invalid vector
+        return;    
+    }
+    
+    if(pos >= vector->size) 
+    {   // vector does not have any element in pos
+        return;     
+    }
+    
+    start = (uint8_t*) (vector->stored_items);
+    item = &start[(uint32_t)pos * vector->item_size];
+    
+    if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
+    {
+        vector->functions->item_clear_fn(item);
+    } 
+    else 
+    { 
+        s_eo_vector_default_clear(item, vector);
+    }
+    
+    vector->size --;
+    
+    // the items after pos move one position back
+    memmove(item, item + vector->item_size, (uint32_t)(vector->size - pos) * vector->item_size); 
+    
+    // if size is zero, eo_mempool_Realloc() calls eo_mempool_Free() and returns NULL. that is correct.
+    if(eo_vectorcapacity_dynamic == vector->capacity)
+    {   // in here i dont make any control because in _New() we have already verified that mempool is dynamic 
+        vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size) * vector->item_size);
+    }
+}
+
+
 extern void eo_vector_Execute(EOvector *vector, void (execute)(void *item, void *param), void *param)
 {
     eOsizecntnr_t i = 0;
@@ -861,6 +1049,87 @@ static eOresult_t s_eo_vector_default_matching_rule(EOvector * vector, void *ite
 }
 
 
+// the position of the first item whose key is not less than key, or size if there is none
+static eOsizecntnr_t s_eo_vector_lowerbound32(EOvector * vector, uint32_t key)
+{
+    const uint8_t *start = (const uint8_t*) (vector->stored_items);
+    uint32_t first = 0;
+    uint32_t count = vector->size;
+    uint32_t half = 0;
+    
+    while(count > 0)
+    {
+        half = count / 2;
+        if(s_eo_vector_key32(vector, &start[(first + half) * vector->item_size]) < key)
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+    
+    return((eOsizecntnr_t)first);
+}
+
+
+// the position of the first item with key, or size if there is none
+static eOsizecntnr_t s_eo_vector_scan32(EOvector * vector, uint32_t key)
+{
+    const uint8_t *item = (const uint8_t*) (vector->stored_items);
+    uint32_t n = vector->size;
+    uint32_t i = 0;
+    
+#if defined(EOVECTOR_USE_SSE2) || defined(EOVECTOR_USE_NEON)    
+    if(sizeof(uint32_t) == vector->item_size)
+    {   // the items are the keys, thus they are contiguous
+        const uint32_t *keys = (const uint32_t*)item;
+#if defined(EOVECTOR_USE_SSE2)        
+        __m128i k = _mm_set1_epi32((int)key);
+        int mask = 0;
+        for(i=0; (i+4) <= n; i+=4)
+        {
+            mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)&keys[i]), k)));
+            if(0 != mask)
+            {
+                return((eOsizecntnr_t)(i + __builtin_ctz(mask)));
+            }
+        }
+#else
+        uint32x4_t k = vdupq_n_u32(key);
+        for(i=0; (i+4) <= n; i+=4)
+        {
+            if(0 != vmaxvq_u32(vceqq_u32(vld1q_u32(&keys[i]), k)))
+            {   // the loop below tells which one
+                break;
+            }
+        }
+#endif        
+        for(; i<n; i++)
+        {
+            if(key == keys[i])
+            {
+                return((eOsizecntnr_t)i);
+            }
+        }
+        return((eOsizecntnr_t)n);
+    }
+#endif
+    
+    for(i=0; i<n; i++, item += vector->item_size)
+    {
+        if(key == s_eo_vector_key32(vector, item))
+        {
+            return((eOsizecntnr_t)i);
+        }
+    }
+    
+    return((eOsizecntnr_t)n);
+}
+
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -40,6 +40,9 @@ extern "C" {
     it returns a pointer to an internal item object. If the EOvector is requested to remove the item object, the 
     optional user-defined remove function is called or the default remove which set memory to zero.
     The EOvector is a base object and is used to derive a new object to manipulate specific items. 
+    If the items contain a uint32_t key (for instance an id32), the EOvector can search it directly with 
+    eo_vector_FindKey32(), without calling a matching rule for every item. Optionally, it can keep the items sorted
+    by key, so that the search is a binary search.
     
     @{		
  **/
@@ -127,6 +130,15 @@ extern eOsizecntnr_t eo_vector_ItemSize(EOvector * vector);
 extern eOsizecntnr_t eo_vector_Size(EOvector * vector);
 
 
+/** @fn         extern uint32_t eo_vector_Footprint(EOvector * vector)
+    @brief      Returns the bytes of memory used by the EOvector: the object, its functions and the storage of the items,
+                which holds capacity items or only the current ones if the capacity is eo_vectorcapacity_dynamic.
+    @param      vector           Pointer to the EOvector object. 
+    @return     Number of bytes, or 0 if vector is NULL.
+ **/
+extern uint32_t eo_vector_Footprint(EOvector * vector);
+
+
 /**  @fn        extern void eo_vector_PushBack(EOvector * vector, void *p)
      @brief     Copies the item object pointed by @e p at the back of the EOvector and calls its constructor 
                 @e item_ctor(p) if passed not NULL in eo_vector_New().
@@ -260,6 +272,52 @@ extern eObool_t eo_vector_Empty(EOvector * vector);
 extern eObool_t eo_vector_Find(EOvector * vector, eOresult_t (matching_rule)(void *item, void *param), void *param, eOsizecntnr_t *position);
 
 
+/** @fn         extern void eo_vector_Key32_Set(EOvector * vector, uint8_t keyoffset, eObool_t sorted)
+    @brief      Tells that the items of the vector contain a uint32_t key at byte offset @e keyoffset, so that they 
+                can be searched with eo_vector_FindKey32(). If @e sorted is eobool_true, the vector keeps its items
+                sorted by increasing key: in such a case it must be empty, its items must be added only with 
+                eo_vector_InsertSorted() and their keys must not be changed in place.
+    @param      vector          Pointer to the EOvector object. 
+    @param      keyoffset       The offset of the key inside the item. The key must fit inside the item.
+    @param      sorted          eobool_true to keep the items sorted by key.
+ **/
+extern void eo_vector_Key32_Set(EOvector * vector, uint8_t keyoffset, eObool_t sorted);
+
+
+/** @fn         extern eObool_t eo_vector_FindKey32(EOvector * vector, uint32_t key, eOsizecntnr_t *position)
+    @brief      Tells if an item with a given key is inside the vector. If the vector is sorted it uses a binary search,
+                otherwise it compares the keys of all items (four at a time with SIMD instructions when the items are 
+                the keys themselves).
+    @param      vector          Pointer to the EOvector object. It must have a key set with eo_vector_Key32_Set().
+    @param      key             The key to find
+    @param      position        if function returns eobool_true and position is not NULL, it contains the index of 
+                                the first item with the key, so that eo_vector_At(vector, position) is the wanted item.
+    @return     eobool_true or eobool_false.
+ **/
+extern eObool_t eo_vector_FindKey32(EOvector * vector, uint32_t key, eOsizecntnr_t *position);
+
+
+/** @fn         extern eOresult_t eo_vector_InsertSorted(EOvector * vector, void *p, eOsizecntnr_t *position)
+    @brief      Copies the item pointed by @e p inside a sorted vector, at the position given by its key and before 
+                the items with the same key.
+    @param      vector          Pointer to the EOvector object. 
+    @param      p               Pointer to the item to be copied.
+    @param      position        if not NULL, it contains the index of the inserted item.
+    @return     eores_OK upon success, eores_NOK_busy if the vector is full, eores_NOK_nullpointer if vector or p
+                are NULL, eores_NOK_unsupported if the vector is not sorted.
+ **/
+extern eOresult_t eo_vector_InsertSorted(EOvector * vector, void *p, eOsizecntnr_t *position);
+
+
+/** @fn         extern void eo_vector_Erase(EOvector * vector, eOsizecntnr_t pos)
+    @brief      Removes the item in position @e pos and moves the following ones back by one position, so that 
+                their order is kept.
+    @param      vector          Pointer to the EOvector object. 
+    @param      pos             The position of the item to remove.
+ **/
+extern void eo_vector_Erase(EOvector * vector, eOsizecntnr_t pos);
+
+
 extern void eo_vector_Execute(EOvector *vector, void (execute)(void *item, void *param), void *param);
 
 
@@ -41,7 +41,10 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
+
+#define EOVECTOR_KEY32_NONE         0       // no key: only eo_vector_Find() with its matching rule
+#define EOVECTOR_KEY32_UNSORTED     1       // a uint32_t key at keyoffset, searched with a linear scan
+#define EOVECTOR_KEY32_SORTED       2       // a uint32_t key at keyoffset, items sorted by increasing key
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
@@ -68,6 +71,9 @@ struct EOvector_hid
     uint16_t                    dummy;              
     void                        *stored_items;      /**< array of item object. */   
     EOcontainer_functions_t     *functions;
+    // the key fields come last so that the static EOconstvector initialisers which stop at functions stay valid
+    uint8_t                     keyoffset;          /**< byte offset of the uint32_t key inside the item. */
+    uint8_t                     keymode;            /**< EOVECTOR_KEY32_NONE, EOVECTOR_KEY32_UNSORTED or EOVECTOR_KEY32_SORTED */
 };
 
 
@@ -63,6 +63,8 @@ extern "C" {
     #define float32_t       float
     #define EO_TAILOR_CODE_FOR_ARM    
     #define EO_READ_PREV_WORD_OF_MALLOC_FOR_SIZEOF_ALLOCATION
+    // armcc has no thread local storage: the default objects are shared by all the tasks
+    #define EO_threadlocal
 #elif defined(_MSC_VER)
     // msc does not support c99, thus inline must be redefined as __inline
     #define EO_extern_inline       extern __inline
@@ -76,6 +78,7 @@ extern "C" {
     #define float32_t       float
     #define __weak	
     #define EO_TAILOR_CODE_FOR_WINDOWS
+    #define EO_threadlocal  __declspec(thread)
     #define EO_WARNING(a)   __pragma(message("EOWARNING-> "##a))
     #define OVERRIDE_eo_receiver_callback_incaseoferror_in_sequencenumberReceived
 //#pragma message(a)
@@ -90,6 +93,7 @@ extern "C" {
     #define float32_t       float
     #define EO_weak          __attribute__((weak))
     #define EO_TAILOR_CODE_FOR_LINUX
+    #define EO_threadlocal  __thread
     #define EO_WARNING(a)   _Pragma(message("EOWARNING-> "##a))
     #define OVERRIDE_eo_receiver_callback_incaseoferror_in_sequencenumberReceived
     #define _PEDANT_WARNING_ON_COMPILATION_CALLBACK_
@@ -105,6 +109,7 @@ extern "C" {
     //#define snprintf        snprintf   
     //#define stdint    dspic_stdint
     #define EO_TAILOR_CODE_FOR_DSPIC
+    #define EO_threadlocal
     #define __weak      __attribute__((__weak__))
 #elif defined(__APPLE__)
     #define EO_extern_inline       static inline
@@ -114,6 +119,7 @@ extern "C" {
     #define snprintf        snprintf
     #define float32_t       float
     #define EO_weak         __attribute__((weak))
+    #define EO_threadlocal  __thread
 #else
     #error architecture not defined 
 #endif
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVmutex_hid.h"
+
+#include <time.h>
+#include <errno.h>
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPmutex.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPmutex_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// virtual
+static eOresult_t s_eop_mutex_take(void *p, eOreltime_t tout);
+// virtual
+static eOresult_t s_eop_mutex_release(void *p);
+// virtual
+static eOresult_t s_eop_mutex_delete(void *p);
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOPmutex";
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOPmutex* eop_mutex_New(void)
+{
+    EOPmutex *retptr = NULL;
+    pthread_mutexattr_t attr;
+    int r = 0;
+
+    // i get the memory for the pthread mutex object
+    retptr = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(EOPmutex), 1);
+
+    // i get the base mutex
+    retptr->mutex = eov_mutex_hid_New();
+
+    // init its vtable
+    eov_mutex_hid_SetVTABLE(retptr->mutex, s_eop_mutex_take, s_eop_mutex_release, s_eop_mutex_delete);
+
+    // i get a new pthread mutex. it is recursive as the mutexes of the other execution environments
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    r = pthread_mutex_init(&retptr->pmutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 == r), "eop_mutex_New(): pthread cannot give a mutex", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+
+    return(retptr);
+}
+
+
+extern void eop_mutex_Delete(EOPmutex *m)
+{
+    if(NULL == m)
+    {
+        return;
+    }
+
+    if(NULL == m->mutex)
+    {
+        return;
+    }
+
+    pthread_mutex_destroy(&m->pmutex);
+
+    eov_mutex_hid_Delete(m->mutex);
+
+    memset(m, 0, sizeof(EOPmutex));
+
+    eo_mempool_Delete(eo_mempool_GetHandle(), m);
+    return;
+}
+
+
+extern eOresult_t eop_mutex_Take(EOPmutex *m, eOreltime_t tout)
+{
+    if(NULL == m)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(s_eop_mutex_take(m, tout));
+}
+
+
+extern eOresult_t eop_mutex_Release(EOPmutex *m)
+{
+    if(NULL == m)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(s_eop_mutex_release(m));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern void eop_mutex_hid_abstimeout(clockid_t clk, eOreltime_t tout, struct timespec *abstime)
+{
+    clock_gettime(clk, abstime);
+
+    abstime->tv_sec  += tout / 1000000;
+    abstime->tv_nsec += (long)(tout % 1000000) * 1000;
+    if(abstime->tv_nsec >= 1000000000)
+    {
+        abstime->tv_sec  += 1;
+        abstime->tv_nsec -= 1000000000;
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static eOresult_t s_eop_mutex_take(void *p, eOreltime_t tout)
+{
+    EOPmutex *m = (EOPmutex *)p;
+    struct timespec abstime;
+    int r = 0;
+
+    // p it is never NULL because the base function calls checks it before calling this function
+    if(eok_reltimeINFINITE == tout)
+    {
+        r = pthread_mutex_lock(&m->pmutex);
+    }
+    else if(eok_reltimeZERO == tout)
+    {
+        r = pthread_mutex_trylock(&m->pmutex);
+    }
+    else
+    {   // pthread_mutex_timedlock() wants an absolute time of the realtime clock
+        eop_mutex_hid_abstimeout(CLOCK_REALTIME, tout, &abstime);
+        r = pthread_mutex_timedlock(&m->pmutex, &abstime);
+    }
+
+    return((0 == r) ? (eores_OK) : (eores_NOK_timeout));
+}
+
+
+static eOresult_t s_eop_mutex_release(void *p)
+{
+    EOPmutex *m = (EOPmutex *)p;
+
+    return((0 == pthread_mutex_unlock(&m->pmutex)) ? (eores_OK) : (eores_NOK_generic));
+}
+
+static eOresult_t s_eop_mutex_delete(void *p)
+{
+    EOPmutex *m = (EOPmutex *)p;
+
+    eop_mutex_Delete(m);
+    return(eores_OK);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
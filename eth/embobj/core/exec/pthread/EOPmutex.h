@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPMUTEX_H_
+#define _EOPMUTEX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOPmutex.h
+    @brief      This header file implements public interface to a mutex for the pthread execution environment.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+/** @defgroup eop_mutex Object EOPmutex
+    The EOPmutex is derived from abstract object EOVmutex to give to embOBJ a mutex in the pthread execution
+    environment (PEE). It is a recursive pthread mutex, thus it can be taken more times by the same thread.
+
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct EOPmutex_hid EOPmutex
+    @brief      EOPmutex is an opaque struct. It is used to implement data abstraction for the pthread
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOPmutex_hid EOPmutex;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+
+/** @fn         extern EOPmutex * eop_mutex_New(void)
+    @brief      Creates a new EOPmutex object by derivation from an abstract object EOVmutex. This mutex is to be used
+                in the pthread environment. The underlying mechanism is a recursive pthread_mutex_t.
+    @return     The pointer to the required EOPmutex. Never NULL.
+ **/
+extern EOPmutex * eop_mutex_New(void);
+
+
+
+/** @fn         extern void eop_mutex_Delete(EOPmutex *m)
+    @brief      Deletes a given EOPmutex object
+    @param      m               The mutex
+ **/
+extern void eop_mutex_Delete(EOPmutex *m);
+
+
+/** @fn         extern eOresult_t eop_mutex_Take(EOPmutex *m, eOreltime_t tout)
+    @brief      It takes a pthread mutex with a given timeout. If the mutex is already taken by another thread,
+                the function waits its release according to the value of @e tout.
+    @param      m               The mutex
+    @param      tout            The required timeout in micro-seconds. If eok_reltimeZERO the mutex does not wait
+                                and if another thread has already taken it, it returns immediately with a failure.
+                                If eok_reltimeINFINITE the mutex waits indefinitely until the mutex is released.
+    @return     eores_OK in case of success. eores_NOK_timeout upon failure to take the mutex, or
+                or eores_NOK_nullpointer if mutex is NULL.
+ **/
+extern eOresult_t eop_mutex_Take(EOPmutex *m, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eop_mutex_Release(EOPmutex *m)
+    @brief      It releases a pthread mutex previously taken by the same thread.
+    @param      m               The mutex
+    @return     eores_OK in case of success. eores_NOK_generic upon failure to release the mutex, or
+                or eores_NOK_nullpointer if mutex is NULL.
+ **/
+extern eOresult_t eop_mutex_Release(EOPmutex *m);
+
+
+
+
+
+/** @}
+    end of group eop_mutex
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPMUTEX_HID_H_
+#define _EOPMUTEX_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOPmutex_hid.h
+    @brief      This header file gives hidden interface to the pthread mutex object.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVmutex.h"
+#include <pthread.h>
+
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOPmutex.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+
+/** @struct     EOPmutex_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOPmutex_hid
+{
+    // - base object
+    EOVmutex                *mutex;
+
+    // - other stuff
+    pthread_mutex_t         pmutex;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+
+// it converts a relative timeout in micro-seconds into the absolute time of clock clk which pthread needs
+extern void eop_mutex_hid_abstimeout(clockid_t clk, eOreltime_t tout, struct timespec *abstime);
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
@@ -0,0 +1,583 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOPmutex_hid.h"
+
+#include <limits.h>
+#include <errno.h>
+#include <time.h>
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtask.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtask_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void * s_eop_task_thread(void *p);
+
+static void s_eop_task_loop_events(EOPtask *t);
+static void s_eop_task_loop_messages(EOPtask *t);
+static void s_eop_task_loop_callbacks(EOPtask *t);
+static void s_eop_task_loop_periodic(EOPtask *t);
+static void s_eop_task_loop_userdefined(EOPtask *t);
+
+static int s_eop_task_wait(pthread_cond_t *cnd, pthread_mutex_t *mtx, eOreltime_t tout, const struct timespec *deadline);
+static eOresult_t s_eop_task_put(EOPtask *t, eOcallback_t cbk, void *arg, eOmessage_t msg, eOreltime_t tout);
+
+// virtual
+static eOresult_t s_eop_task_isr_set_evt(void *t, eOevent_t evt);
+static eOresult_t s_eop_task_tsk_set_evt(void *t, eOevent_t evt);
+static eOresult_t s_eop_task_isr_send_msg(void *t, eOmessage_t msg);
+static eOresult_t s_eop_task_tsk_send_msg(void *t, eOmessage_t msg, eOreltime_t tout);
+static eOresult_t s_eop_task_isr_exec_cbk(void *t, eOcallback_t cbk, void *arg);
+static eOresult_t s_eop_task_tsk_exec_cbk(void *t, eOcallback_t cbk, void *arg, eOreltime_t tout);
+static eOid08_t s_eop_task_get_id(void *t);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOPtask";
+
+// the task which executes the calling thread
+static EO_threadlocal EOPtask * s_eop_task_running = NULL;
+
+static uint8_t s_eop_task_lastid = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOPtask * eop_task_New(eOptask_type_t type, uint32_t stacksize,
+                              void (*startup_fn)(EOPtask *, uint32_t), void (*run_fn)(EOPtask *, uint32_t),
+                              uint16_t queuesize, eOreltime_t timeoutorperiod, void *extdata, const char *name)
+{
+    EOPtask *retptr = NULL;
+    pthread_condattr_t cndattr;
+    pthread_attr_t attr;
+    int r = 0;
+
+    eo_errman_Assert(eo_errman_GetHandle(), (type <= eop_tsk_UserDefined), "eop_task_New(): wrong type", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), ((NULL != run_fn) || (eop_tsk_CallbackDriven == type)), "eop_task_New(): NULL run_fn", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), ((0 != queuesize) || ((eop_tsk_MessageDriven != type) && (eop_tsk_CallbackDriven != type))), "eop_task_New(): zero queuesize", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), ((eop_tsk_Periodic != type) || ((0 != timeoutorperiod) && (eok_reltimeINFINITE != timeoutorperiod))), "eop_task_New(): wrong period", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    // i get the memory for the pthread task object
+    retptr = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(EOPtask), 1);
+
+    // i get the base task and i init its vtable. the startup and run functions are called by the base object
+    retptr->tsk = eov_task_hid_New();
+    eov_task_hid_SetVTABLE(retptr->tsk,
+                           (eOvoid_fp_voidp_uint32_t)startup_fn, (eOvoid_fp_voidp_uint32_t)run_fn,
+                           s_eop_task_isr_set_evt, s_eop_task_tsk_set_evt,
+                           s_eop_task_isr_send_msg, s_eop_task_tsk_send_msg,
+                           s_eop_task_isr_exec_cbk, s_eop_task_tsk_exec_cbk,
+                           s_eop_task_get_id
+                          );
+
+    retptr->type            = type;
+    retptr->timeoutorperiod = timeoutorperiod;
+    retptr->startup_fn      = startup_fn;
+    retptr->run_fn          = run_fn;
+    retptr->extdata         = extdata;
+    retptr->events          = 0;
+    retptr->queue           = NULL;
+    retptr->capacity        = 0;
+    retptr->size            = 0;
+    retptr->head            = 0;
+    retptr->id              = __sync_add_and_fetch(&s_eop_task_lastid, 1);
+    retptr->stop            = 0;
+    memset(retptr->name, 0, sizeof(retptr->name));
+    if(NULL != name)
+    {
+        strncpy(retptr->name, name, sizeof(retptr->name)-1);
+    }
+
+    if((eop_tsk_MessageDriven == type) || (eop_tsk_CallbackDriven == type))
+    {
+        retptr->capacity    = queuesize;
+        retptr->queue       = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOptask_item_t), queuesize);
+    }
+
+    // the waits with a timeout use the monotonic clock, so that they dont depend on changes of the date
+    pthread_mutex_init(&retptr->mtx, NULL);
+    pthread_condattr_init(&cndattr);
+    pthread_condattr_setclock(&cndattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&retptr->cnd_data, &cndattr);
+    pthread_cond_init(&retptr->cnd_space, &cndattr);
+    pthread_condattr_destroy(&cndattr);
+
+    pthread_attr_init(&attr);
+    if(0 != stacksize)
+    {
+        pthread_attr_setstacksize(&attr, (stacksize < PTHREAD_STACK_MIN) ? (PTHREAD_STACK_MIN) : (stacksize));
+    }
+    r = pthread_create(&retptr->thread, &attr, s_eop_task_thread, retptr);
+    pthread_attr_destroy(&attr);
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 == r), "eop_task_New(): pthread cannot give a thread", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+
+#if defined(_GNU_SOURCE)
+    if(NULL != name)
+    {
+        pthread_setname_np(retptr->thread, retptr->name);
+    }
+#endif
+
+    return(retptr);
+}
+
+
+extern void eop_task_Delete(EOPtask *t)
+{
+    if((NULL == t) || (t == s_eop_task_running))
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&t->mtx);
+    t->stop = 1;
+    pthread_cond_broadcast(&t->cnd_data);
+    pthread_cond_broadcast(&t->cnd_space);
+    pthread_mutex_unlock(&t->mtx);
+
+    pthread_join(t->thread, NULL);
+
+    pthread_cond_destroy(&t->cnd_data);
+    pthread_cond_destroy(&t->cnd_space);
+    pthread_mutex_destroy(&t->mtx);
+
+    if(NULL != t->queue)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), t->queue);
+    }
+
+    eo_mempool_Delete(eo_mempool_GetHandle(), t->tsk);
+
+    memset(t, 0, sizeof(EOPtask));
+    eo_mempool_Delete(eo_mempool_GetHandle(), t);
+}
+
+
+extern eOresult_t eop_task_SetEvent(EOPtask *t, eOevent_t evt)
+{
+    return(s_eop_task_tsk_set_evt(t, evt));
+}
+
+
+extern eOresult_t eop_task_SendMessage(EOPtask *t, eOmessage_t msg, eOreltime_t tout)
+{
+    return(s_eop_task_tsk_send_msg(t, msg, tout));
+}
+
+
+extern eOresult_t eop_task_ExecCallback(EOPtask *t, eOcallback_t cbk, void *arg, eOreltime_t tout)
+{
+    return(s_eop_task_tsk_exec_cbk(t, cbk, arg, tout));
+}
+
+
+extern void * eop_task_GetExternalData(EOPtask *t)
+{
+    if(NULL == t)
+    {
+        return(NULL);
+    }
+
+    return(t->extdata);
+}
+
+
+extern EOPtask * eop_task_GetRunning(void)
+{
+    return(s_eop_task_running);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static void * s_eop_task_thread(void *p)
+{
+    EOPtask *t = (EOPtask *)p;
+
+    s_eop_task_running = t;
+
+    eov_task_hid_StartUp(t, 0);
+
+    switch(t->type)
+    {
+        case eop_tsk_EventDriven:       s_eop_task_loop_events(t);          break;
+        case eop_tsk_MessageDriven:     s_eop_task_loop_messages(t);        break;
+        case eop_tsk_CallbackDriven:    s_eop_task_loop_callbacks(t);       break;
+        case eop_tsk_Periodic:          s_eop_task_loop_periodic(t);        break;
+        default:                        s_eop_task_loop_userdefined(t);     break;
+    }
+
+    return(NULL);
+}
+
+
+static void s_eop_task_loop_events(EOPtask *t)
+{
+    struct timespec deadline;
+    eOevent_t events = 0;
+
+    pthread_mutex_lock(&t->mtx);
+    while(0 == t->stop)
+    {
+        eop_mutex_hid_abstimeout(CLOCK_MONOTONIC, t->timeoutorperiod, &deadline);
+        while((0 == t->events) && (0 == t->stop))
+        {
+            if(ETIMEDOUT == s_eop_task_wait(&t->cnd_data, &t->mtx, t->timeoutorperiod, &deadline))
+            {
+                break;
+            }
+        }
+
+        if(0 != t->stop)
+        {
+            break;
+        }
+
+        // on timeout the run function gets zero events
+        events = t->events;
+        t->events = 0;
+
+        pthread_mutex_unlock(&t->mtx);
+        eov_task_hid_Run(t, events);
+        pthread_mutex_lock(&t->mtx);
+    }
+    pthread_mutex_unlock(&t->mtx);
+}
+
+
+static void s_eop_task_loop_messages(EOPtask *t)
+{
+    struct timespec deadline;
+    eOmessage_t msg = 0;
+
+    pthread_mutex_lock(&t->mtx);
+    while(0 == t->stop)
+    {
+        eop_mutex_hid_abstimeout(CLOCK_MONOTONIC, t->timeoutorperiod, &deadline);
+        while((0 == t->size) && (0 == t->stop))
+        {
+            if(ETIMEDOUT == s_eop_task_wait(&t->cnd_data, &t->mtx, t->timeoutorperiod, &deadline))
+            {
+                break;
+            }
+        }
+
+        if(0 != t->stop)
+        {
+            break;
+        }
+
+        // on timeout the run function gets a zero message
+        msg = 0;
+        if(0 != t->size)
+        {
+            msg = t->queue[t->head].msg;
+            t->head = (t->head + 1) % t->capacity;
+            t->size --;
+            pthread_cond_signal(&t->cnd_space);
+        }
+
+        pthread_mutex_unlock(&t->mtx);
+        eov_task_hid_Run(t, msg);
+        pthread_mutex_lock(&t->mtx);
+    }
+    pthread_mutex_unlock(&t->mtx);
+}
+
+
+static void s_eop_task_loop_callbacks(EOPtask *t)
+{
+    eOptask_item_t item;
+
+    pthread_mutex_lock(&t->mtx);
+    while(0 == t->stop)
+    {
+        while((0 == t->size) && (0 == t->stop))
+        {
+            pthread_cond_wait(&t->cnd_data, &t->mtx);
+        }
+
+        if(0 != t->stop)
+        {
+            break;
+        }
+
+        item = t->queue[t->head];
+        t->head = (t->head + 1) % t->capacity;
+        t->size --;
+        pthread_cond_signal(&t->cnd_space);
+
+        pthread_mutex_unlock(&t->mtx);
+        item.cbk(item.arg);
+        if(NULL != t->run_fn)
+        {   // the EOVtask calls its run function without checking it
+            eov_task_hid_Run(t, 0);
+        }
+        pthread_mutex_lock(&t->mtx);
+    }
+    pthread_mutex_unlock(&t->mtx);
+}
+
+
+static void s_eop_task_loop_periodic(EOPtask *t)
+{
+    struct timespec next;
+
+    // the activations are at fixed times, so that the duration of the run function does not accumulate
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&t->mtx);
+    while(0 == t->stop)
+    {
+        pthread_mutex_unlock(&t->mtx);
+        eov_task_hid_Run(t, 0);
+        pthread_mutex_lock(&t->mtx);
+
+        next.tv_sec  += t->timeoutorperiod / 1000000;
+        next.tv_nsec += (long)(t->timeoutorperiod % 1000000) * 1000;
+        if(next.tv_nsec >= 1000000000)
+        {
+            next.tv_sec  += 1;
+            next.tv_nsec -= 1000000000;
+        }
+
+        while((0 == t->stop) && (ETIMEDOUT != pthread_cond_timedwait(&t->cnd_data, &t->mtx, &next)))
+        {
+            ;
+        }
+    }
+    pthread_mutex_unlock(&t->mtx);
+}
+
+
+static void s_eop_task_loop_userdefined(EOPtask *t)
+{
+    for(;;)
+    {
+        pthread_mutex_lock(&t->mtx);
+        if(0 != t->stop)
+        {
+            pthread_mutex_unlock(&t->mtx);
+            break;
+        }
+        pthread_mutex_unlock(&t->mtx);
+
+        eov_task_hid_Run(t, 0);
+    }
+}
+
+
+static int s_eop_task_wait(pthread_cond_t *cnd, pthread_mutex_t *mtx, eOreltime_t tout, const struct timespec *deadline)
+{
+    if(eok_reltimeINFINITE == tout)
+    {
+        return(pthread_cond_wait(cnd, mtx));
+    }
+
+    return(pthread_cond_timedwait(cnd, mtx, deadline));
+}
+
+
+static eOresult_t s_eop_task_put(EOPtask *t, eOcallback_t cbk, void *arg, eOmessage_t msg, eOreltime_t tout)
+{
+    struct timespec deadline;
+    uint16_t tail = 0;
+
+    eop_mutex_hid_abstimeout(CLOCK_MONOTONIC, tout, &deadline);
+
+    pthread_mutex_lock(&t->mtx);
+
+    while((t->size == t->capacity) && (0 == t->stop))
+    {
+        if((eok_reltimeZERO == tout) || (ETIMEDOUT == s_eop_task_wait(&t->cnd_space, &t->mtx, tout, &deadline)))
+        {
+            pthread_mutex_unlock(&t->mtx);
+            return(eores_NOK_timeout);
+        }
+    }
+
+    if(0 != t->stop)
+    {
+        pthread_mutex_unlock(&t->mtx);
+        return(eores_NOK_generic);
+    }
+
+    tail = (t->head + t->size) % t->capacity;
+    t->queue[tail].cbk = cbk;
+    t->queue[tail].arg = arg;
+    t->queue[tail].msg = msg;
+    t->size ++;
+
+    pthread_cond_signal(&t->cnd_data);
+    pthread_mutex_unlock(&t->mtx);
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eop_task_isr_set_evt(void *t, eOevent_t evt)
+{
+    // on linux there are no isr: the isr functions are those of the tasks which do not wait
+    return(s_eop_task_tsk_set_evt(t, evt));
+}
+
+
+static eOresult_t s_eop_task_tsk_set_evt(void *t, eOevent_t evt)
+{
+    EOPtask *tsk = (EOPtask *)t;
+
+    if(NULL == tsk)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eop_tsk_EventDriven != tsk->type)
+    {
+        return(eores_NOK_generic);
+    }
+
+    pthread_mutex_lock(&tsk->mtx);
+    tsk->events |= evt;
+    pthread_cond_signal(&tsk->cnd_data);
+    pthread_mutex_unlock(&tsk->mtx);
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eop_task_isr_send_msg(void *t, eOmessage_t msg)
+{
+    return(s_eop_task_tsk_send_msg(t, msg, eok_reltimeZERO));
+}
+
+
+static eOresult_t s_eop_task_tsk_send_msg(void *t, eOmessage_t msg, eOreltime_t tout)
+{
+    EOPtask *tsk = (EOPtask *)t;
+
+    if(NULL == tsk)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eop_tsk_MessageDriven != tsk->type)
+    {
+        return(eores_NOK_generic);
+    }
+
+    return(s_eop_task_put(tsk, NULL, NULL, msg, tout));
+}
+
+
+static eOresult_t s_eop_task_isr_exec_cbk(void *t, eOcallback_t cbk, void *arg)
+{
+    return(s_eop_task_tsk_exec_cbk(t, cbk, arg, eok_reltimeZERO));
+}
+
+
+static eOresult_t s_eop_task_tsk_exec_cbk(void *t, eOcallback_t cbk, void *arg, eOreltime_t tout)
+{
+    EOPtask *tsk = (EOPtask *)t;
+
+    if((NULL == tsk) || (NULL == cbk))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eop_tsk_CallbackDriven != tsk->type)
+    {
+        return(eores_NOK_generic);
+    }
+
+    return(s_eop_task_put(tsk, cbk, arg, 0, tout));
+}
+
+
+static eOid08_t s_eop_task_get_id(void *t)
+{
+    EOPtask *tsk = (EOPtask *)t;
+
+    return((NULL == tsk) ? (0) : (tsk->id));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPTASK_H_
+#define _EOPTASK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOPtask.h
+    @brief      This header file implements public interface to a task for the pthread execution environment.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+/** @defgroup eop_task Object EOPtask
+    The EOPtask is derived from abstract object EOVtask to give to embOBJ a task in the pthread execution
+    environment (PEE). Every EOPtask is a pthread which executes a loop whose kind depends on the type of the task:
+    it waits for events, for messages or for callbacks, or it is periodic, or it just calls the run function
+    forever. Events, messages and callbacks can be sent to a task by any other thread with the functions of the
+    EOVtask (e.g., eov_task_tskSetEvent()) or with those of this object.
+
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVtask.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef enum eOptask_type_t
+    @brief      It contains the types of an EOPtask.
+ **/
+typedef enum
+{
+    eop_tsk_EventDriven         = 0,    /**< run_fn(t, events) is called when any event arrives or, with events 0, after timeoutorperiod */
+    eop_tsk_MessageDriven       = 1,    /**< run_fn(t, msg) is called for every message or, with msg 0, after timeoutorperiod */
+    eop_tsk_CallbackDriven      = 2,    /**< every callback is executed and then run_fn(t, 0) is called, if not NULL */
+    eop_tsk_Periodic            = 3,    /**< run_fn(t, 0) is called every timeoutorperiod micro-seconds */
+    eop_tsk_UserDefined         = 4     /**< run_fn(t, 0) is called in a loop without any wait */
+} eOptask_type_t;
+
+
+/** @typedef    typedef struct EOPtask_hid EOPtask
+    @brief      EOPtask is an opaque struct. It is used to implement data abstraction for the pthread
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOPtask_hid EOPtask;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOPtask * eop_task_New(eOptask_type_t type, uint32_t stacksize,
+                                  void (*startup_fn)(EOPtask *, uint32_t), void (*run_fn)(EOPtask *, uint32_t),
+                                  uint16_t queuesize, eOreltime_t timeoutorperiod, void *extdata, const char *name)
+    @brief      Creates a new EOPtask and starts its pthread, which calls startup_fn(t, 0) and then enters the loop
+                of its type.
+    @param      type            The type of the task.
+    @param      stacksize       The size of the stack in bytes. If 0 it is used the default of the pthread library.
+    @param      startup_fn      Executed once at the start of the pthread. It can be NULL.
+    @param      run_fn          Executed inside the loop of the task. It can be NULL only for eop_tsk_CallbackDriven.
+    @param      queuesize       The capacity of the queue of messages or callbacks. Not used by the other types.
+    @param      timeoutorperiod The period for eop_tsk_Periodic or the timeout of the wait for the event- and
+                                message-driven tasks. It can be eok_reltimeINFINITE for them.
+    @param      extdata         Data given to the task, which it can retrieve with eop_task_GetExternalData().
+    @param      name            The name of the pthread. It can be NULL.
+    @return     The pointer to the required EOPtask. Never NULL.
+ **/
+extern EOPtask * eop_task_New(eOptask_type_t type, uint32_t stacksize,
+                              void (*startup_fn)(EOPtask *, uint32_t), void (*run_fn)(EOPtask *, uint32_t),
+                              uint16_t queuesize, eOreltime_t timeoutorperiod, void *extdata, const char *name);
+
+
+/** @fn         extern void eop_task_Delete(EOPtask *t)
+    @brief      Stops the loop of the task, waits for the end of its pthread and deletes the object. It must not
+                be called by the task itself. A run_fn which never returns prevents the deletion.
+    @param      t               The task
+ **/
+extern void eop_task_Delete(EOPtask *t);
+
+
+/** @fn         extern eOresult_t eop_task_SetEvent(EOPtask *t, eOevent_t evt)
+    @brief      Sets the events in evt to a eop_tsk_EventDriven task.
+    @param      t               The task
+    @param      evt             The event mask
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the task is not event-driven.
+ **/
+extern eOresult_t eop_task_SetEvent(EOPtask *t, eOevent_t evt);
+
+
+/** @fn         extern eOresult_t eop_task_SendMessage(EOPtask *t, eOmessage_t msg, eOreltime_t tout)
+    @brief      Sends a message to a eop_tsk_MessageDriven task. If the queue is full it waits up to tout.
+    @param      t               The task
+    @param      msg             The message
+    @param      tout            The timeout. eok_reltimeZERO does not wait.
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_timeout or eores_NOK_generic if the task is not
+                message-driven.
+ **/
+extern eOresult_t eop_task_SendMessage(EOPtask *t, eOmessage_t msg, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eop_task_ExecCallback(EOPtask *t, eOcallback_t cbk, void *arg, eOreltime_t tout)
+    @brief      Requests a eop_tsk_CallbackDriven task to execute cbk(arg). If the queue is full it waits up to tout.
+    @param      t               The task
+    @param      cbk             The callback
+    @param      arg             Its argument
+    @param      tout            The timeout. eok_reltimeZERO does not wait.
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_timeout or eores_NOK_generic if the task is not
+                callback-driven.
+ **/
+extern eOresult_t eop_task_ExecCallback(EOPtask *t, eOcallback_t cbk, void *arg, eOreltime_t tout);
+
+
+/** @fn         extern void * eop_task_GetExternalData(EOPtask *t)
+    @brief      Returns the extdata given to eop_task_New().
+    @param      t               The task
+    @return     The extdata or NULL
+ **/
+extern void * eop_task_GetExternalData(EOPtask *t);
+
+
+/** @fn         extern EOPtask * eop_task_GetRunning(void)
+    @brief      Returns the EOPtask which executes the calling thread.
+    @return     The task or NULL if the thread is not an EOPtask
+ **/
+extern EOPtask * eop_task_GetRunning(void);
+
+
+
+
+/** @}
+    end of group eop_task
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
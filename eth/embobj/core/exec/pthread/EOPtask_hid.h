@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPTASK_HID_H_
+#define _EOPTASK_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOPtask_hid.h
+    @brief      This header file implements hidden interface to the pthread task object.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVtask_hid.h"
+#include <pthread.h>
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOPtask.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+// an item of the queue of a message-driven or callback-driven task
+typedef struct
+{
+    eOcallback_t            cbk;
+    void                    *arg;
+    eOmessage_t             msg;
+} eOptask_item_t;
+
+
+/** @struct     EOPtask_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOPtask_hid
+{
+    // - base object
+    EOVtask                 *tsk;
+
+    // - other stuff
+    pthread_t               thread;
+    pthread_mutex_t         mtx;            // protects events, the queue and stop
+    pthread_cond_t          cnd_data;       // signalled when events or items arrive or on stop. it uses the monotonic clock
+    pthread_cond_t          cnd_space;      // signalled when an item leaves a full queue or on stop
+    eOptask_type_t          type;
+    eOreltime_t             timeoutorperiod;
+    void                    (*startup_fn)(EOPtask *, uint32_t);
+    void                    (*run_fn)(EOPtask *, uint32_t);
+    void                    *extdata;
+    eOevent_t               events;
+    eOptask_item_t          *queue;
+    uint16_t                capacity;
+    uint16_t                size;
+    uint16_t                head;
+    uint8_t                 id;
+    uint8_t                 stop;
+    char                    name[16];
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheCallbackManager_hid.h"
+#include "EOPtask.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtheCallbackManager.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtheCallbackManager_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOpcallbackman_cfg_t eop_callbackman_DefaultCfg =
+{
+    EO_INIT(.queuesize)     8,
+    EO_INIT(.filler)        0,
+    EO_INIT(.stacksize)     0
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eop_callbackman_execute(EOVtheCallbackManager *v, eOcallback_t cbk, void *arg, uint32_t tout);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOPtheCallbackManager";
+
+static EOPtheCallbackManager s_eop_thecallbackmanager =
+{
+    EO_INIT(.vcm)       NULL,
+    EO_INIT(.tsk)       NULL
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOPtheCallbackManager * eop_callbackman_Initialise(const eOpcallbackman_cfg_t *cfg)
+{
+    if(NULL != s_eop_thecallbackmanager.vcm)
+    {
+        // already initialised
+        return(&s_eop_thecallbackmanager);
+    }
+
+    if(NULL == cfg)
+    {
+        cfg = &eop_callbackman_DefaultCfg;
+    }
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != cfg->queuesize), "eop_callbackman_Initialise(): zero queuesize", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    // a callback-driven task executes the received callbacks and does nothing else
+    s_eop_thecallbackmanager.tsk = eop_task_New(eop_tsk_CallbackDriven, cfg->stacksize, NULL, NULL,
+                                                cfg->queuesize, eok_reltimeINFINITE, &s_eop_thecallbackmanager, "cbkman");
+
+    s_eop_thecallbackmanager.vcm = eov_callbackman_hid_Initialise(s_eop_callbackman_execute, s_eop_thecallbackmanager.tsk);
+
+    return(&s_eop_thecallbackmanager);
+}
+
+
+extern EOPtheCallbackManager* eop_callbackman_GetHandle(void)
+{
+    if(NULL == s_eop_thecallbackmanager.vcm)
+    {
+        return(NULL);
+    }
+
+    return(&s_eop_thecallbackmanager);
+}
+
+
+extern eOresult_t eop_callbackman_Execute(EOPtheCallbackManager *p, eOcallback_t cbk, void *arg, eOreltime_t tout)
+{
+    if((NULL == p) || (NULL == cbk))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eop_task_ExecCallback(p->tsk, cbk, arg, tout));
+}
+
+
+extern EOPtask * eop_callbackman_GetTask(EOPtheCallbackManager *p)
+{
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    return(p->tsk);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static eOresult_t s_eop_callbackman_execute(EOVtheCallbackManager *v, eOcallback_t cbk, void *arg, uint32_t tout)
+{
+    (void)v;    // it is always the singleton
+    return(eop_callbackman_Execute(&s_eop_thecallbackmanager, cbk, arg, tout));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPTHECALLBACKMANAGER_H_
+#define _EOPTHECALLBACKMANAGER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOPtheCallbackManager.h
+    @brief      This header file implements public interface to the callback manager singleton for the pthread
+                execution environment.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+/** @defgroup eop_thecallbackmanager Object EOPtheCallbackManager
+    The EOPtheCallbackManager is derived from the abstract object EOVtheCallbackManager and executes the callbacks
+    requested by eov_callbackman_Execute() or by the expiry of timers in a callback-driven EOPtask.
+
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOPtask.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct eOpcallbackman_cfg_t
+    @brief      eOpcallbackman_cfg_t contains the configuration of the EOPtheCallbackManager
+ **/
+typedef struct
+{
+    uint16_t        queuesize;      /**< the maximum number of callbacks waiting to be executed */
+    uint16_t        filler;
+    uint32_t        stacksize;      /**< the stack of the pthread. if 0 it is the default of the pthread library */
+} eOpcallbackman_cfg_t;
+
+
+/** @typedef    typedef struct EOPtheCallbackManager_hid EOPtheCallbackManager
+    @brief      EOPtheCallbackManager is an opaque struct. It is used to implement data abstraction for the pthread
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOPtheCallbackManager_hid EOPtheCallbackManager;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOpcallbackman_cfg_t eop_callbackman_DefaultCfg; // = {8, 0, 0};
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+
+/** @fn         extern EOPtheCallbackManager * eop_callbackman_Initialise(const eOpcallbackman_cfg_t *cfg)
+    @brief      Initialises the singleton EOPtheCallbackManager and starts its task. It is called by eop_sys_Start().
+    @param      cfg             The configuration. If NULL it is used eop_callbackman_DefaultCfg.
+    @return     The handle to the callback manager.
+ **/
+extern EOPtheCallbackManager * eop_callbackman_Initialise(const eOpcallbackman_cfg_t *cfg);
+
+
+/** @fn         extern EOPtheCallbackManager* eop_callbackman_GetHandle(void)
+    @brief      Returns an handle to the singleton EOPtheCallbackManager. The singleton must have been initialised
+                with eop_callbackman_Initialise(), otherwise this function will return NULL.
+    @return     The handle to the callback manager or NULL.
+ **/
+extern EOPtheCallbackManager* eop_callbackman_GetHandle(void);
+
+
+/** @fn         extern eOresult_t eop_callbackman_Execute(EOPtheCallbackManager *p, eOcallback_t cbk, void *arg, eOreltime_t tout)
+    @brief      Queues the callback @e cbk to be executed by the task of the manager.
+    @param      p               The handle to the callback manager.
+    @param      cbk             The callback.
+    @param      arg             Its argument.
+    @param      tout            The time to wait for space in the queue.
+    @return     eores_OK, eores_NOK_nullpointer, or eores_NOK_timeout if the queue stays full.
+ **/
+extern eOresult_t eop_callbackman_Execute(EOPtheCallbackManager *p, eOcallback_t cbk, void *arg, eOreltime_t tout);
+
+
+/** @fn         extern EOPtask * eop_callbackman_GetTask(EOPtheCallbackManager *p)
+    @brief      Returns the task which executes the callbacks.
+    @param      p               The handle to the callback manager.
+    @return     The task or NULL.
+ **/
+extern EOPtask * eop_callbackman_GetTask(EOPtheCallbackManager *p);
+
+
+
+/** @}
+    end of group eop_thecallbackmanager
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
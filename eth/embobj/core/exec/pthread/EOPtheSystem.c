@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheSystem_hid.h"
+#include "EOPmutex.h"
+#include "EOPtask.h"
+#include "EOPtheTimerManager.h"
+#include "EOPtheCallbackManager.h"
+
+#include <time.h>
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtheSystem.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtheSystem_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOpsystem_cfg_t eop_sys_DefaultCfg =
+{
+    EO_INIT(.mempooltimeout)    0xffffffff      // eok_reltimeINFINITE
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eop_sys_start(eOvoid_fp_void_t userinit_fn);
+
+static EOVtaskDerived* s_eop_sys_gettask(void);
+
+static eOabstime_t s_eop_sys_abstime_get(void);
+static void s_eop_sys_abstime_set(eOabstime_t time);
+static eOnanotime_t s_eop_sys_nanotime_get(void);
+static void s_eop_sys_stop(void);
+
+static uint64_t s_eop_sys_monotonic_nanosec(void);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOPtheSystem";
+
+static EOPtheSystem s_eop_system =
+{
+    EO_INIT(.thevsys)       NULL,
+    EO_INIT(.cfg)           NULL,
+    EO_INIT(.tmrmancfg)     NULL,
+    EO_INIT(.cbkmancfg)     NULL,
+    EO_INIT(.user_init_fn)  NULL,
+    EO_INIT(.start)         0,
+    EO_INIT(.mtx)           PTHREAD_MUTEX_INITIALIZER,
+    EO_INIT(.cnd)           PTHREAD_COND_INITIALIZER,
+    EO_INIT(.stop)          0
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern EOPtheSystem * eop_sys_Initialise(const eOpsystem_cfg_t *syscfg,
+                                         const eOmempool_cfg_t *mpoolcfg,
+                                         const eOerrman_cfg_t *errmancfg,
+                                         const eOptimerman_cfg_t *tmrmancfg,
+                                         const eOpcallbackman_cfg_t *cbkmancfg)
+{
+    if(NULL != s_eop_system.thevsys)
+    {
+        // already initialised
+        return(&s_eop_system);
+    }
+
+    s_eop_system.cfg        = (NULL == syscfg) ? (&eop_sys_DefaultCfg) : (syscfg);
+    s_eop_system.tmrmancfg  = tmrmancfg;
+    s_eop_system.cbkmancfg  = cbkmancfg;
+
+    // the zero of the lifetime
+    s_eop_system.start      = s_eop_sys_monotonic_nanosec();
+
+    // mempool and error manager initialised inside here.
+    s_eop_system.thevsys = eov_sys_hid_Initialise(mpoolcfg,
+                                                  errmancfg,
+                                                  (eOres_fp_voidfpvoid_t)s_eop_sys_start, s_eop_sys_gettask,
+                                                  s_eop_sys_abstime_get, s_eop_sys_abstime_set,
+                                                  (eOuint64_fp_void_t)s_eop_sys_nanotime_get,
+                                                  s_eop_sys_stop);
+
+    return(&s_eop_system);
+}
+
+
+extern EOPtheSystem* eop_sys_GetHandle(void)
+{
+    if(NULL == s_eop_system.thevsys)
+    {
+        return(NULL);
+    }
+
+    return(&s_eop_system);
+}
+
+
+extern void eop_sys_Start(EOPtheSystem *p, eOvoid_fp_void_t userinit_fn)
+{
+    eo_errman_Assert(eo_errman_GetHandle(), (NULL != p), "eop_sys_Start(): NULL handle", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    s_eop_sys_start(userinit_fn);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eop_sys_start(eOvoid_fp_void_t userinit_fn)
+{
+    s_eop_system.user_init_fn = userinit_fn;
+
+    // the memory pool is used by more pthreads from now on
+    eo_mempool_SetMutex(eo_mempool_GetHandle(), eop_mutex_New(), s_eop_system.cfg->mempooltimeout);
+
+    eop_timerman_Initialise(s_eop_system.tmrmancfg);
+    eop_callbackman_Initialise(s_eop_system.cbkmancfg);
+
+    // run user defined initialisation ...
+    if(NULL != s_eop_system.user_init_fn)
+    {
+        s_eop_system.user_init_fn();
+    }
+
+    // the tasks now run in their pthreads. we wait for eov_sys_Stop()
+    pthread_mutex_lock(&s_eop_system.mtx);
+    while(0 == s_eop_system.stop)
+    {
+        pthread_cond_wait(&s_eop_system.cnd, &s_eop_system.mtx);
+    }
+    pthread_mutex_unlock(&s_eop_system.mtx);
+
+    eop_timerman_Deinitialise(eop_timerman_GetHandle());
+
+    return(eores_OK);
+}
+
+
+static EOVtaskDerived* s_eop_sys_gettask(void)
+{
+    // it is NULL if called by a pthread which is not an EOPtask, such as the one of the timer manager
+    return(eop_task_GetRunning());
+}
+
+
+static eOabstime_t s_eop_sys_abstime_get(void)
+{
+    return((s_eop_sys_monotonic_nanosec() - s_eop_system.start) / 1000);
+}
+
+
+static void s_eop_sys_abstime_set(eOabstime_t time)
+{
+    // we move the zero of the lifetime so that now it is equal to time
+    s_eop_system.start = s_eop_sys_monotonic_nanosec() - (1000 * time);
+}
+
+
+static eOnanotime_t s_eop_sys_nanotime_get(void)
+{
+    return(s_eop_sys_monotonic_nanosec() - s_eop_system.start);
+}
+
+
+static void s_eop_sys_stop(void)
+{
+    pthread_mutex_lock(&s_eop_system.mtx);
+    s_eop_system.stop = 1;
+    pthread_cond_broadcast(&s_eop_system.cnd);
+    pthread_mutex_unlock(&s_eop_system.mtx);
+}
+
+
+static uint64_t s_eop_sys_monotonic_nanosec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return(((uint64_t)ts.tv_sec * 1000000000) + (uint64_t)ts.tv_nsec);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
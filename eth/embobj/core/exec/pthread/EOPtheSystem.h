@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPTHESYSTEM_H_
+#define _EOPTHESYSTEM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOPtheSystem.h
+    @brief      This header file implements public interface to the system singleton for the pthread execution
+                environment.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+/** @defgroup eop_thesystem Object EOPtheSystem
+    The EOPtheSystem is derived from the abstract object EOVtheSystem and runs the embOBJ on pthreads (the pthread
+    execution environment, PEE). The time is taken from CLOCK_MONOTONIC, the tasks are EOPtask objects, the mutexes
+    are EOPmutex objects and the timers are managed by the EOPtheTimerManager.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOPtheTimerManager.h"
+#include "EOPtheCallbackManager.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct eOpsystem_cfg_t
+    @brief      eOpsystem_cfg_t contains the configuration of the EOPtheSystem
+ **/
+typedef struct
+{
+    eOreltime_t                 mempooltimeout;     /**< the timeout used by the memory pool to take its mutex */
+} eOpsystem_cfg_t;
+
+
+/** @typedef    typedef struct EOPtheSystem_hid EOPtheSystem
+    @brief      EOPtheSystem is an opaque struct. It is used to implement data abstraction for the system
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOPtheSystem_hid EOPtheSystem;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOpsystem_cfg_t eop_sys_DefaultCfg; // = {eok_reltimeINFINITE};
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOPtheSystem * eop_sys_Initialise(const eOpsystem_cfg_t *syscfg,
+                                         const eOmempool_cfg_t *mpoolcfg,
+                                         const eOerrman_cfg_t *errmancfg,
+                                         const eOptimerman_cfg_t *tmrmancfg,
+                                         const eOpcallbackman_cfg_t *cbkmancfg)
+    @brief      Initialise the singleton EOPtheSystem, the error manager and the memory pool. The EOPtheTimerManager
+                and EOPtheCallbackManager are initialised later by eop_sys_Start().
+    @param      syscfg          The configuration of the system. If NULL it is used eop_sys_DefaultCfg.
+    @param      mpoolcfg        The configuration of the EOtheMemoryPool. If NULL it is used the heap.
+    @param      errmancfg       The configuration of the EOtheErrorManager. If NULL it is used the default one.
+    @param      tmrmancfg       The configuration of the EOPtheTimerManager. If NULL it is used eop_timerman_DefaultCfg.
+    @param      cbkmancfg       The configuration of the EOPtheCallbackManager. If NULL it is used eop_callbackman_DefaultCfg.
+    @return     A not NULL handle to the singleton.
+ **/
+extern EOPtheSystem * eop_sys_Initialise(const eOpsystem_cfg_t *syscfg,
+                                         const eOmempool_cfg_t *mpoolcfg,
+                                         const eOerrman_cfg_t *errmancfg,
+                                         const eOptimerman_cfg_t *tmrmancfg,
+                                         const eOpcallbackman_cfg_t *cbkmancfg);
+
+
+/** @fn         extern EOPtheSystem* eop_sys_GetHandle(void)
+    @brief      Returns an handle to the singleton EOPtheSystem. The singleton must have been initialised otherwise
+                this function call will return NULL.
+    @return     The pointer to the required EOPtheSystem (or NULL upon in-initialised singleton).
+ **/
+extern EOPtheSystem* eop_sys_GetHandle(void);
+
+
+/** @fn         extern void eop_sys_Start(EOPtheSystem *p, eOvoid_fp_void_t userinit_fn)
+    @brief      It starts EOPtheSystem: it gives a mutex to the memory pool, initialises the EOPtheTimerManager and
+                the EOPtheCallbackManager and calls @e userinit_fn() which creates the EOPtask objects of the
+                application. Then it waits until eov_sys_Stop() is called, stops the timer manager and returns.
+    @param      p               The handler to the singleton.
+    @param      userinit_fn     The user-defined initialisation. It can be NULL.
+ **/
+extern void eop_sys_Start(EOPtheSystem *p, eOvoid_fp_void_t userinit_fn);
+
+
+
+/** @}
+    end of group eop_thesystem
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
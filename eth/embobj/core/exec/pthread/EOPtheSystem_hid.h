@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPTHESYSTEM_HID_H_
+#define _EOPTHESYSTEM_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOPtheSystem_hid.h
+    @brief      This header file implements hidden interface to the system singleton of the pthread execution environment.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVtheSystem.h"
+#include <pthread.h>
+#include <time.h>
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOPtheSystem.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+/* @struct     EOPtheSystem_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOPtheSystem_hid
+{
+    // base object
+    EOVtheSystem                *thevsys;
+
+    // other stuff
+    const eOpsystem_cfg_t       *cfg;
+    const eOptimerman_cfg_t     *tmrmancfg;
+    const eOpcallbackman_cfg_t  *cbkmancfg;
+    eOvoid_fp_void_t            user_init_fn;
+    uint64_t                    start;          // the CLOCK_MONOTONIC in nanosec which is the zero of the lifetime
+    pthread_mutex_t             mtx;
+    pthread_cond_t              cnd;
+    uint8_t                     stop;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
@@ -0,0 +1,665 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "string.h"
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheSystem.h"
+#include "EOVtheTimerManager_hid.h"
+#include "EOtimer_hid.h"
+#include "EOaction_hid.h"
+#include "EOPmutex.h"
+
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/eventfd.h>
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtheTimerManager.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOPtheTimerManager_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the max number of actions which are collected under the lock of the manager and then executed out of it
+#define EOPTIMERMAN_BATCH       16
+
+#define EOPTIMERMAN_SLOTMASK    (EOPTIMERMAN_SLOTS - 1)
+
+// the ticks covered by the wheel. the timers beyond it wait in the last level and are reinserted when it cascades
+#define EOPTIMERMAN_SPAN        (1ULL << (EOPTIMERMAN_LEVELS * EOPTIMERMAN_SLOTBITS))
+
+#define EOPTIMERMAN_NOTARMED    0xffffffffffffffffULL
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOptimerman_cfg_t eop_timerman_DefaultCfg =
+{
+    EO_INIT(.tickperiod)    1000,
+    EO_INIT(.stacksize)     0
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eop_timerman_OnNewTimer(EOVtheTimerManager* tm, EOtimer *t);
+
+static eOresult_t s_eop_timerman_OnDelTimer(EOVtheTimerManager* tm, EOtimer *t);
+
+static eOresult_t s_eop_timerman_AddTimer(EOVtheTimerManager* tm, EOtimer *t);
+
+static eOresult_t s_eop_timerman_RemTimer(EOVtheTimerManager* tm, EOtimer *t);
+
+static void * s_eop_timerman_thread(void *p);
+
+static uint16_t s_eop_timerman_expired_get(eOabstime_t now, EOaction *actions, uint16_t capacity);
+
+static void s_eop_timerman_advance(uint64_t target);
+
+static void s_eop_timerman_cascade(uint8_t level, uint8_t slot);
+
+static uint64_t s_eop_timerman_tick(uint64_t lifetime);
+
+static void s_eop_timerman_insert(eOptimerman_node_t *node);
+
+static void s_eop_timerman_append(eOptimerman_node_t *node, uint8_t level, uint8_t slot);
+
+static void s_eop_timerman_unlink(eOptimerman_node_t *node);
+
+static uint64_t s_eop_timerman_nexttick(void);
+
+static uint64_t s_eop_timerman_nextslot(uint64_t from);
+
+static void s_eop_timerman_arm(eOabstime_t now, uint64_t tick);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOPtheTimerManager";
+
+static EOPtheTimerManager s_eop_thetimermanager =
+{
+    EO_INIT(.tmrman)        NULL,
+    EO_INIT(.tickperiod)    0,
+    EO_INIT(.base)          0,
+    EO_INIT(.armedtick)     EOPTIMERMAN_NOTARMED,
+    EO_INIT(.running)       0,
+    EO_INIT(.occupied)      {0},
+    EO_INIT(.wheel)         {{{NULL, NULL}}},
+    EO_INIT(.due)           {NULL, NULL},
+    EO_INIT(.thread)        0,
+    EO_INIT(.epollfd)       -1,
+    EO_INIT(.timerfd)       -1,
+    EO_INIT(.stopfd)        -1
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOPtheTimerManager * eop_timerman_Initialise(const eOptimerman_cfg_t *cfg)
+{
+    struct epoll_event ev;
+    pthread_attr_t attr;
+    int r = 0;
+
+    if(NULL != s_eop_thetimermanager.tmrman)
+    {
+        // already initialised
+        return(&s_eop_thetimermanager);
+    }
+
+    if(NULL == cfg)
+    {
+        cfg = &eop_timerman_DefaultCfg;
+    }
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != cfg->tickperiod), "eop_timerman_Initialise(): zero tickperiod", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    s_eop_thetimermanager.tickperiod = cfg->tickperiod;
+    s_eop_thetimermanager.base = eov_sys_LifeTimeGet(eov_sys_GetHandle()) / cfg->tickperiod;
+
+    s_eop_thetimermanager.epollfd = epoll_create1(EPOLL_CLOEXEC);
+    s_eop_thetimermanager.timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    s_eop_thetimermanager.stopfd  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    eo_errman_Assert(eo_errman_GetHandle(), ((s_eop_thetimermanager.epollfd >= 0) && (s_eop_thetimermanager.timerfd >= 0) && (s_eop_thetimermanager.stopfd >= 0)),
+                     "eop_timerman_Initialise(): cannot get the file descriptors", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = s_eop_thetimermanager.timerfd;
+    epoll_ctl(s_eop_thetimermanager.epollfd, EPOLL_CTL_ADD, s_eop_thetimermanager.timerfd, &ev);
+    ev.data.fd = s_eop_thetimermanager.stopfd;
+    epoll_ctl(s_eop_thetimermanager.epollfd, EPOLL_CTL_ADD, s_eop_thetimermanager.stopfd, &ev);
+
+    // i get a basic timer manager with add and rem functions proper for the pthread execution environment and an EOPmutex
+    s_eop_thetimermanager.tmrman = eov_timerman_hid_Initialise(s_eop_timerman_OnNewTimer, s_eop_timerman_OnDelTimer,
+                                                               s_eop_timerman_AddTimer, s_eop_timerman_RemTimer,
+                                                               eop_mutex_New());
+
+    // i start the pthread which executes the actions associated to the expiry of the timers
+    pthread_attr_init(&attr);
+    if(0 != cfg->stacksize)
+    {
+        pthread_attr_setstacksize(&attr, cfg->stacksize);
+    }
+    r = pthread_create(&s_eop_thetimermanager.thread, &attr, s_eop_timerman_thread, &s_eop_thetimermanager);
+    pthread_attr_destroy(&attr);
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 == r), "eop_timerman_Initialise(): pthread cannot give a thread", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+
+    return(&s_eop_thetimermanager);
+}
+
+
+extern EOPtheTimerManager* eop_timerman_GetHandle(void)
+{
+    if(NULL == s_eop_thetimermanager.tmrman)
+    {
+        return(NULL);
+    }
+
+    return(&s_eop_thetimermanager);
+}
+
+
+extern void eop_timerman_Deinitialise(EOPtheTimerManager *p)
+{
+    uint64_t one = 1;
+
+    if((NULL == p) || (p->stopfd < 0))
+    {
+        return;
+    }
+
+    if(sizeof(one) == write(p->stopfd, &one, sizeof(one)))
+    {
+        pthread_join(p->thread, NULL);
+    }
+
+    close(p->epollfd);
+    close(p->timerfd);
+    close(p->stopfd);
+    p->epollfd = p->timerfd = p->stopfd = -1;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static eOresult_t s_eop_timerman_OnNewTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    eOptimerman_node_t *node = NULL;
+
+    (void)tm;   // it is always the singleton
+
+    // the node is allocated once, so that start and stop do not allocate
+    node = eo_mempool_New(eo_mempool_GetHandle(), sizeof(eOptimerman_node_t));
+    node->timer = t;
+    node->level = EOPTIMERMAN_LEVEL_NONE;
+
+    t->envir.other = node;
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eop_timerman_OnDelTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    (void)tm;   // it is always the singleton
+
+    // eo_timer_Delete() has already stopped the timer, thus the node is not in any list
+    eo_mempool_Delete(eo_mempool_GetHandle(), t->envir.other);
+    t->envir.other = NULL;
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eop_timerman_AddTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    eOptimerman_node_t *node = (eOptimerman_node_t*)t->envir.other;
+    eOabstime_t now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    eOabstime_t late = 0;
+    uint64_t tick = 0;
+
+    (void)tm;   // it is always the singleton
+
+    // we are called by eo_timer_Start() which holds the lock of the manager
+
+    if(NULL == node)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if((EOTIMER_MODE_FOREVER == t->mode) && (0 == t->expirytime))
+    {   // it would expire forever in the same instant
+        return(eores_NOK_generic);
+    }
+
+    node->expiry = (eok_abstimeNOW == t->startat) ? (now + t->expirytime) : (t->startat + t->expirytime);
+
+    if((EOTIMER_MODE_FOREVER == t->mode) && (node->expiry <= now))
+    {   // a periodic timer synchronised to the past starts from its next period in the future
+        late = now - node->expiry;
+        node->expiry += (late / t->expirytime + 1) * t->expirytime;
+    }
+
+    if((0 == s_eop_thetimermanager.running) && (now / s_eop_thetimermanager.tickperiod > s_eop_thetimermanager.base))
+    {   // the pthread does not advance an empty wheel, thus we move it to now
+        s_eop_thetimermanager.base = now / s_eop_thetimermanager.tickperiod;
+    }
+
+    s_eop_timerman_insert(node);
+    s_eop_thetimermanager.running ++;
+
+    t->status = EOTIMER_STATUS_RUNNING;
+
+    tick = s_eop_timerman_tick(node->expiry);
+    if(tick < s_eop_thetimermanager.base)
+    {
+        tick = s_eop_thetimermanager.base;
+    }
+
+    if(tick < s_eop_thetimermanager.armedtick)
+    {
+        s_eop_timerman_arm(now, tick);
+    }
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eop_timerman_RemTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    eOptimerman_node_t *node = (eOptimerman_node_t*)t->envir.other;
+
+    (void)tm;   // it is always the singleton
+
+    // we are called by eo_timer_Stop() which holds the lock of the manager
+
+    if((NULL != node) && (EOPTIMERMAN_LEVEL_NONE != node->level))
+    {
+        s_eop_timerman_unlink(node);
+        s_eop_thetimermanager.running --;
+        // we dont re-arm: an early wake-up of the pthread just finds no expired timer
+    }
+
+    eo_timer_hid_Reset_but_not_osaltime(t, eo_tmrstat_Idle);
+
+    return(eores_OK);
+}
+
+
+static void * s_eop_timerman_thread(void *p)
+{
+    EOPtheTimerManager *tm = (EOPtheTimerManager *)p;
+    struct epoll_event evs[2];
+    EOaction actions[EOPTIMERMAN_BATCH];
+    uint64_t expirations = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+    int num = 0;
+    int k = 0;
+
+    for(;;)
+    {
+        num = epoll_wait(tm->epollfd, evs, 2, -1);
+
+        for(k=0; k<num; k++)
+        {
+            if(tm->stopfd == evs[k].data.fd)
+            {
+                return(NULL);
+            }
+        }
+
+        if(num <= 0)
+        {   // EINTR
+            continue;
+        }
+
+        // the counter of the timerfd must be read to clear its readiness
+        if(sizeof(expirations) != read(tm->timerfd, &expirations, sizeof(expirations)))
+        {
+            continue;
+        }
+
+        do
+        {
+            eov_timerman_Take(tm->tmrman, eok_reltimeINFINITE);
+            n = s_eop_timerman_expired_get(eov_sys_LifeTimeGet(eov_sys_GetHandle()), actions, EOPTIMERMAN_BATCH);
+            eov_timerman_Release(tm->tmrman);
+
+            // the actions are executed out of the lock, so that they can start and stop timers. they cannot wait
+            // as an isr because they would delay the other timers
+            for(i=0; i<n; i++)
+            {
+                eo_action_Execute(&actions[i], eok_reltimeZERO);
+            }
+
+        } while(EOPTIMERMAN_BATCH == n);
+    }
+}
+
+
+static uint16_t s_eop_timerman_expired_get(eOabstime_t now, EOaction *actions, uint16_t capacity)
+{
+    eOptimerman_node_t *node = NULL;
+    EOtimer *t = NULL;
+    uint16_t n = 0;
+
+    // the timers of all the ticks up to now go into the due list
+    s_eop_timerman_advance(now / s_eop_thetimermanager.tickperiod);
+
+    while((n < capacity) && (NULL != s_eop_thetimermanager.due.head))
+    {
+        node = s_eop_thetimermanager.due.head;
+        t = node->timer;
+
+        s_eop_timerman_unlink(node);
+        memcpy(&actions[n], &t->onexpiry, sizeof(EOaction));
+        n++;
+
+        if(EOTIMER_MODE_FOREVER == t->mode)
+        {   // if the pthread was late by more periods, the lost expiries are skipped
+            node->expiry += t->expirytime;
+            if(node->expiry <= now)
+            {
+                node->expiry = now + t->expirytime;
+            }
+            s_eop_timerman_insert(node);
+        }
+        else
+        {
+            s_eop_thetimermanager.running --;
+            t->status = EOTIMER_STATUS_COMPLETED;
+        }
+    }
+
+    s_eop_timerman_arm(now, s_eop_timerman_nexttick());
+
+    return(n);
+}
+
+
+static void s_eop_timerman_advance(uint64_t target)
+{
+    EOPtheTimerManager *tm = &s_eop_thetimermanager;
+    eOptimerman_node_t *node = NULL;
+    uint8_t slot = 0;
+    uint8_t l = 0;
+    uint64_t next = 0;
+
+    while(tm->base <= target)
+    {
+        slot = tm->base & EOPTIMERMAN_SLOTMASK;
+
+        if(0 == slot)
+        {   // the first level has completed a turn: the next slot of each upper level which turns moves down
+            for(l=1; l<EOPTIMERMAN_LEVELS; l++)
+            {
+                slot = (tm->base >> (l * EOPTIMERMAN_SLOTBITS)) & EOPTIMERMAN_SLOTMASK;
+                s_eop_timerman_cascade(l, slot);
+                if(0 != slot)
+                {
+                    break;
+                }
+            }
+            slot = 0;
+        }
+
+        while(NULL != (node = tm->wheel[0][slot].head))
+        {
+            s_eop_timerman_unlink(node);
+            s_eop_timerman_append(node, EOPTIMERMAN_LEVEL_DUE, 0);
+        }
+
+        next = s_eop_timerman_nextslot(tm->base + 1);
+
+        tm->base = (next > target) ? (target + 1) : (next);
+    }
+}
+
+
+static void s_eop_timerman_cascade(uint8_t level, uint8_t slot)
+{
+    eOptimerman_node_t *node = NULL;
+
+    while(NULL != (node = s_eop_thetimermanager.wheel[level][slot].head))
+    {
+        s_eop_timerman_unlink(node);
+        s_eop_timerman_insert(node);
+    }
+}
+
+
+static uint64_t s_eop_timerman_tick(uint64_t lifetime)
+{
+    // the first tick not before lifetime, so that a timer never expires early
+    return((lifetime + s_eop_thetimermanager.tickperiod - 1) / s_eop_thetimermanager.tickperiod);
+}
+
+
+static void s_eop_timerman_insert(eOptimerman_node_t *node)
+{
+    uint64_t base = s_eop_thetimermanager.base;
+    uint64_t tick = s_eop_timerman_tick(node->expiry);
+    uint64_t delta = 0;
+    uint8_t l = 0;
+
+    if(tick < base)
+    {   // it is already expired: it goes in the slot processed next
+        s_eop_timerman_append(node, 0, base & EOPTIMERMAN_SLOTMASK);
+        return;
+    }
+
+    delta = tick - base;
+
+    if(delta >= EOPTIMERMAN_SPAN)
+    {   // beyond the wheel. the node keeps its expiry and is reinserted when the last level cascades
+        tick = base + EOPTIMERMAN_SPAN - 1;
+        delta = EOPTIMERMAN_SPAN - 1;
+    }
+
+    // level l keeps the ticks whose delta is lower than 64^(l+1)
+    for(l=0; l<EOPTIMERMAN_LEVELS-1; l++)
+    {
+        if(delta < (1ULL << ((l + 1) * EOPTIMERMAN_SLOTBITS)))
+        {
+            break;
+        }
+    }
+
+    s_eop_timerman_append(node, l, (tick >> (l * EOPTIMERMAN_SLOTBITS)) & EOPTIMERMAN_SLOTMASK);
+}
+
+
+static void s_eop_timerman_append(eOptimerman_node_t *node, uint8_t level, uint8_t slot)
+{
+    eOptimerman_list_t *list = (EOPTIMERMAN_LEVEL_DUE == level) ? (&s_eop_thetimermanager.due) : (&s_eop_thetimermanager.wheel[level][slot]);
+
+    node->level = level;
+    node->slot  = slot;
+    node->next  = NULL;
+    node->prev  = list->tail;
+
+    if(NULL == list->tail)
+    {
+        list->head = node;
+    }
+    else
+    {
+        list->tail->next = node;
+    }
+    list->tail = node;
+
+    if(EOPTIMERMAN_LEVEL_DUE != level)
+    {
+        s_eop_thetimermanager.occupied[level] |= (1ULL << slot);
+    }
+}
+
+
+static void s_eop_timerman_unlink(eOptimerman_node_t *node)
+{
+    eOptimerman_list_t *list = (EOPTIMERMAN_LEVEL_DUE == node->level) ? (&s_eop_thetimermanager.due) : (&s_eop_thetimermanager.wheel[node->level][node->slot]);
+
+    if(NULL == node->prev)
+    {
+        list->head = node->next;
+    }
+    else
+    {
+        node->prev->next = node->next;
+    }
+
+    if(NULL == node->next)
+    {
+        list->tail = node->prev;
+    }
+    else
+    {
+        node->next->prev = node->prev;
+    }
+
+    if((EOPTIMERMAN_LEVEL_DUE != node->level) && (NULL == list->head))
+    {
+        s_eop_thetimermanager.occupied[node->level] &= ~(1ULL << node->slot);
+    }
+
+    node->prev  = node->next = NULL;
+    node->level = EOPTIMERMAN_LEVEL_NONE;
+}
+
+
+static uint64_t s_eop_timerman_nexttick(void)
+{
+    EOPtheTimerManager *tm = &s_eop_thetimermanager;
+
+    if(NULL != tm->due.head)
+    {
+        return(tm->base);
+    }
+
+    if(0 == tm->running)
+    {
+        return(EOPTIMERMAN_NOTARMED);
+    }
+
+    return(s_eop_timerman_nextslot(tm->base));
+}
+
+
+// the first tick from the given one which s_eop_timerman_advance() must process: a non-empty slot of the first level in the
+// current turn, or the start of a turn where the upper levels cascade. the start of a turn is taken also when it is from 
+// itself, because the upper levels cascade only when it is processed: if we skipped it, its timers would wait a whole turn.
+static uint64_t s_eop_timerman_nextslot(uint64_t from)
+{
+    EOPtheTimerManager *tm = &s_eop_thetimermanager;
+    uint8_t slot = from & EOPTIMERMAN_SLOTMASK;
+    uint64_t bits = tm->occupied[0] >> slot;
+    uint8_t l = 0;
+
+    if(0 == slot)
+    {
+        for(l=1; l<EOPTIMERMAN_LEVELS; l++)
+        {
+            if(0 != tm->occupied[l])
+            {
+                return(from);
+            }
+        }
+    }
+
+    return((0 != bits) ? (from + __builtin_ctzll(bits)) : ((from | EOPTIMERMAN_SLOTMASK) + 1));
+}
+
+
+static void s_eop_timerman_arm(eOabstime_t now, uint64_t tick)
+{
+    struct itimerspec its;
+    uint64_t at = 0;
+    uint64_t delta = 0;
+
+    memset(&its, 0, sizeof(its));
+
+    if(EOPTIMERMAN_NOTARMED != tick)
+    {
+        at = tick * s_eop_thetimermanager.tickperiod;
+        delta = (at > now) ? (at - now) : (0);
+
+        // a zero it_value would disarm the timerfd
+        its.it_value.tv_sec  = delta / 1000000;
+        its.it_value.tv_nsec = (0 == delta) ? (1) : ((long)(delta % 1000000) * 1000);
+    }
+
+    s_eop_thetimermanager.armedtick = tick;
+    timerfd_settime(s_eop_thetimermanager.timerfd, 0, &its, NULL);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
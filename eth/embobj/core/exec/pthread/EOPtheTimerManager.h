@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPTHETIMERMANAGER_H_
+#define _EOPTHETIMERMANAGER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOPtheTimerManager.h
+    @brief      This header file implements public interface to the timer manager singleton for the pthread
+                execution environment.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+/** @defgroup eop_thetimermanager Object EOPtheTimerManager
+    The EOPtheTimerManager is derived from the abstract object EOVtheTimerManager and manages the EOtimer objects in
+    the pthread execution environment (PEE). It keeps the running timers in a hierarchical timing wheel of five
+    levels of 64 slots each, so that eo_timer_Start() and eo_timer_Stop() have constant cost whatever the number of
+    timers. The time of the wheel advances by ticks of configurable duration, and a timer expires at the first tick
+    not before its expiry time. A pthread waits with epoll on a timerfd armed at the next non-empty slot of the wheel
+    or, at most, at the end of the 64 ticks of the first level.
+    The actions of the expired timers are collected in batches under the lock of the manager and executed by the
+    pthread out of it: events and messages are sent to their task and callbacks are executed by their task or, if
+    it is NULL, directly by the pthread of the manager.
+
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct eOptimerman_cfg_t
+    @brief      eOptimerman_cfg_t contains the configuration of the EOPtheTimerManager
+ **/
+typedef struct
+{
+    eOreltime_t     tickperiod;     /**< the resolution of the timers in usec. the wheel covers 2^30 ticks */
+    uint32_t        stacksize;      /**< the stack of the pthread. if 0 it is the default of the pthread library */
+} eOptimerman_cfg_t;
+
+
+/** @typedef    typedef struct EOPtheTimerManager_hid EOPtheTimerManager
+    @brief      EOPtheTimerManager is an opaque struct. It is used to implement data abstraction for the pthread
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOPtheTimerManager_hid EOPtheTimerManager;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOptimerman_cfg_t eop_timerman_DefaultCfg; // = {1000, 0};
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+
+/** @fn         extern EOPtheTimerManager * eop_timerman_Initialise(const eOptimerman_cfg_t *cfg)
+    @brief      Initialises the singleton EOPtheTimerManager and starts its pthread. It is called by eop_sys_Start().
+    @param      cfg             The configuration. If NULL it is used eop_timerman_DefaultCfg.
+    @return     The handle to the timer manager.
+ **/
+extern EOPtheTimerManager * eop_timerman_Initialise(const eOptimerman_cfg_t *cfg);
+
+
+/** @fn         extern EOPtheTimerManager* eop_timerman_GetHandle(void)
+    @brief      Returns an handle to the singleton EOPtheTimerManager. The singleton must have been initialised
+                with eop_timerman_Initialise(), otherwise this function will return NULL.
+    @return     The handle to the timer manager or NULL.
+ **/
+extern EOPtheTimerManager* eop_timerman_GetHandle(void);
+
+
+/** @fn         extern void eop_timerman_Deinitialise(EOPtheTimerManager *p)
+    @brief      Stops the pthread of the manager and the running timers. It is called by eop_sys_Start() when the
+                system stops.
+    @param      p               The handle to the timer manager.
+ **/
+extern void eop_timerman_Deinitialise(EOPtheTimerManager *p);
+
+
+
+/** @}
+    end of group eop_thetimermanager
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
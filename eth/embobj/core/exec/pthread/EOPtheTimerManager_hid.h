@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPTHETIMERMANAGER_HID_H_
+#define _EOPTHETIMERMANAGER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOPtheTimerManager_hid.h
+    @brief      This header file implements hidden interface to the timer manager of the pthread execution environment.
+    @author     marco.accame@iit.it
+    @date       06/12/2013
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVtheTimerManager.h"
+#include "EOtimer.h"
+#include <pthread.h>
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOPtheTimerManager.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+#define EOPTIMERMAN_LEVELS          5
+#define EOPTIMERMAN_SLOTBITS        6
+#define EOPTIMERMAN_SLOTS           (1 << EOPTIMERMAN_SLOTBITS)
+#define EOPTIMERMAN_LEVEL_DUE       0xfe        // the node is in the list of the expired timers
+#define EOPTIMERMAN_LEVEL_NONE      0xff        // the node is not in any list
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct eOptimerman_node_hid eOptimerman_node_t;
+
+// a list of nodes. new nodes go to the tail, so that the timers with the same expiry keep the order of start
+typedef struct
+{
+    eOptimerman_node_t          *head;
+    eOptimerman_node_t          *tail;
+} eOptimerman_list_t;
+
+// the node which keeps a timer inside the wheel. it is allocated by eo_timer_New() and kept in envir.other
+struct eOptimerman_node_hid
+{
+    eOptimerman_node_t          *prev;
+    eOptimerman_node_t          *next;
+    EOtimer                     *timer;
+    uint64_t                    expiry;         // the lifetime of the next expiry in usec
+    uint8_t                     level;          // 0 ... EOPTIMERMAN_LEVELS-1, EOPTIMERMAN_LEVEL_DUE or EOPTIMERMAN_LEVEL_NONE
+    uint8_t                     slot;
+};
+
+
+/** @struct     EOPtheTimerManager_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOPtheTimerManager_hid
+{
+    // base object
+    EOVtheTimerManager          *tmrman;
+
+    // other stuff
+    eOreltime_t                 tickperiod;
+    uint64_t                    base;           // the first tick not yet processed
+    uint64_t                    armedtick;      // the tick at which the timerfd is armed or UINT64_MAX
+    uint32_t                    running;
+    uint64_t                    occupied[EOPTIMERMAN_LEVELS];   // bit i is 1 if wheel[level][i] is not empty
+    eOptimerman_list_t          wheel[EOPTIMERMAN_LEVELS][EOPTIMERMAN_SLOTS];
+    eOptimerman_list_t          due;            // the expired timers whose action is not yet collected
+    pthread_t                   thread;
+    int                         epollfd;
+    int                         timerfd;        // armed at armedtick
+    int                         stopfd;         // an eventfd which stops the pthread
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
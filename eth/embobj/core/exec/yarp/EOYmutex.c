@@ -28,8 +28,20 @@
 #include "EOtheErrorManager.h"
 #include "EOVmutex_hid.h"
 
-
+// on linux the mutex is a futex, elsewhere it is an ACE mutex. the ACE mutex can be forced on linux by defining
+// EOY_MUTEX_USE_ACE
+#if     defined(EO_TAILOR_CODE_FOR_LINUX) && !defined(EOY_MUTEX_USE_ACE)
+#define EOY_MUTEX_USE_FUTEX
+#endif
+
+#if     defined(EOY_MUTEX_USE_FUTEX)
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#else
 #include <FeatureInterface.h>   // to see the acemutex_* functions
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -49,12 +61,26 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#if     defined(EOY_MUTEX_USE_FUTEX)
+    #if defined(__i386__) || defined(__x86_64__)
+    #define EOY_MUTEX_CPU_RELAX()   __builtin_ia32_pause()
+    #else
+    #define EOY_MUTEX_CPU_RELAX()   __asm__ __volatile__("" ::: "memory")
+    #endif
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+const eOymutex_cfg_t eoy_mutex_DefaultCfg =
+{
+    EO_INIT(.recursive)     eobool_true,
+    EO_INIT(.filler)        {0},
+    EO_INIT(.maxspin)       100
+};
 
 
 
@@ -75,11 +101,25 @@ static eOresult_t s_eoy_mutex_release(void *p);
 // virtual
 static eOresult_t s_eoy_mutex_delete(void *p);
 
+#if     defined(EOY_MUTEX_USE_FUTEX)
+static eOresult_t s_eoy_mutex_futex_take(EOYmutex *m, eOreltime_t tout);
+static eOresult_t s_eoy_mutex_futex_wait(EOYmutex *m, eOreltime_t tout, uint64_t start);
+static eOresult_t s_eoy_mutex_futex_release(EOYmutex *m);
+static uint32_t s_eoy_mutex_threadid(void);
+static uint64_t s_eoy_mutex_nanosec(void);
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
+#if     !defined(EOY_MUTEX_USE_FUTEX)
 static const char s_eobj_ownname[] = "EOYmutex";
+#endif
+
+#if     defined(EOY_MUTEX_USE_FUTEX)
+static EO_threadlocal uint32_t s_eoy_mutex_tid = 0;
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -88,9 +128,20 @@ static const char s_eobj_ownname[] = "EOYmutex";
 
 
 extern EOYmutex* eoy_mutex_New(void) 
+{
+    return(eoy_mutex_NewExt(NULL));
+}
+
+
+extern EOYmutex* eoy_mutex_NewExt(const eOymutex_cfg_t *cfg) 
 {
     EOYmutex *retptr = NULL;    
 
+    if(NULL == cfg)
+    {
+        cfg = &eoy_mutex_DefaultCfg;
+    }
+
     // i get the memory for the yarp mutex object
     retptr = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOYmutex), 1);
     
@@ -99,12 +150,20 @@ extern EOYmutex* eoy_mutex_New(void)
 
     // init its vtable
     eov_mutex_hid_SetVTABLE(retptr->mutex, s_eoy_mutex_take, s_eoy_mutex_release, s_eoy_mutex_delete); 
-    
+
+#if     defined(EOY_MUTEX_USE_FUTEX)
+    // the memory of the mempool is zeroed, thus the futex is free and the stats are cleared
+    retptr->acemutex    = NULL;
+    retptr->recursive   = cfg->recursive;
+    retptr->maxspin     = cfg->maxspin;
+    retptr->spin        = cfg->maxspin / 2;
+#else    
     // i get a new yarp mutex
     retptr->acemutex = ace_mutex_new();
 
     // need to check because yarp may return NULL
     eo_errman_Assert(eo_errman_GetHandle(), (NULL != retptr->acemutex), s_eobj_ownname, "eoy_mutex_New(): ace cannot give a mutex", &eo_errman_DescrRuntimeErrorLocal);
+#endif
     
     return(retptr);    
 }
@@ -117,13 +176,16 @@ extern void eoy_mutex_Delete(EOYmutex *m)
         return;
     }
     
-    if(NULL == m->acemutex)
+    if(NULL == m->mutex)
     {
         return;
     }
     
-    //#warning -> marco.accame: must uncomment the following but only after ace_mutex_delete() is implemented
-    //ace_mutex_delete(m->acemutex);
+#if     defined(EOY_MUTEX_USE_FUTEX)
+    // the futex is just a word inside the object: there is nothing else to release
+#else
+    ace_mutex_delete(m->acemutex);
+#endif
     
     eov_mutex_hid_Delete(m->mutex);
     
@@ -156,6 +218,27 @@ extern eOresult_t eoy_mutex_Release(EOYmutex *m)
 }
 
 
+extern eOresult_t eoy_mutex_Stats_Get(EOYmutex *m, eOymutex_stats_t *stats, eObool_t reset)
+{
+    if((NULL == m) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+#if     defined(EOY_MUTEX_USE_FUTEX)
+    // the counters are written by the holder, apart from timeouts. a reading which is not atomic is enough for profiling
+    memcpy(stats, &m->stats, sizeof(eOymutex_stats_t));
+    if(eobool_true == reset)
+    {
+        memset(&m->stats, 0, sizeof(eOymutex_stats_t));
+    }
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -170,18 +253,26 @@ extern eOresult_t eoy_mutex_Release(EOYmutex *m)
 static eOresult_t s_eoy_mutex_take(void *p, eOreltime_t tout) 
 {
     EOYmutex *m = (EOYmutex *)p;
+#if     defined(EOY_MUTEX_USE_FUTEX)
+    return(s_eoy_mutex_futex_take(m, tout));
+#else
     // p it is never NULL because the base function calls checks it before calling this function, then ace will
     // check m->acemutex vs NULL
     return((eOresult_t)ace_mutex_take(m->acemutex, tout));
+#endif
 }
 
 
 static eOresult_t s_eoy_mutex_release(void *p) 
 {
     EOYmutex *m = (EOYmutex *)p;
+#if     defined(EOY_MUTEX_USE_FUTEX)
+    return(s_eoy_mutex_futex_release(m));
+#else
     // p it is never NULL because the base function calls checks it before calling this function, then ace will
     // check m->acemutex vs NULL
     return((eOresult_t)ace_mutex_release(m->acemutex));
+#endif
 }
 
 static eOresult_t s_eoy_mutex_delete(void *p) 
@@ -192,9 +283,186 @@ static eOresult_t s_eoy_mutex_delete(void *p)
     return(eores_OK);
 }
 
+
+#if     defined(EOY_MUTEX_USE_FUTEX)
+
+// the futex follows "futexes are tricky" by u. drepper: 0 is free, 1 is taken, 2 is taken and someone may sleep.
+// the holder which releases a 2 must wake a sleeper.
+
+static eOresult_t s_eoy_mutex_futex_take(EOYmutex *m, eOreltime_t tout)
+{
+    uint32_t self = s_eoy_mutex_threadid();
+    uint32_t holder = 0;
+    uint32_t spins = 0;
+    uint32_t i = 0;
+    uint64_t start = 0;
+    uint64_t waited = 0;
+    eOresult_t res = eores_OK;
+
+    // the fast path: a single compare and swap
+    if(__sync_bool_compare_and_swap(&m->state, 0, 1))
+    {
+        m->owner = self;
+        m->stats.takes ++;
+        return(eores_OK);
+    }
+
+    holder = m->owner;
+
+    if(self == holder)
+    {   // only the owner can see itself as the holder
+        if(eobool_false == m->recursive)
+        {   // it would wait forever
+            return(eores_NOK_generic);
+        }
+        m->recursion ++;
+        m->stats.takes ++;
+        return(eores_OK);
+    }
+
+    if(eok_reltimeZERO == tout)
+    {
+        __sync_fetch_and_add(&m->stats.timeouts, 1);
+        return(eores_NOK_timeout);
+    }
+
+    start = s_eoy_mutex_nanosec();
+
+    // a short critical section ends while we spin, so that we dont pay the system calls of sleep and wake-up.
+    // the spins adapt to the recent history of the mutex as in the adaptive mutexes of glibc
+    spins = 2 * m->spin + 10;
+    if(spins > m->maxspin)
+    {
+        spins = m->maxspin;
+    }
+
+    for(i=0; i<spins; i++)
+    {
+        if((0 == m->state) && __sync_bool_compare_and_swap(&m->state, 0, 1))
+        {
+            break;
+        }
+        EOY_MUTEX_CPU_RELAX();
+    }
+
+    if(i == spins)
+    {
+        res = s_eoy_mutex_futex_wait(m, tout, start);
+        if(eores_OK != res)
+        {
+            __sync_fetch_and_add(&m->stats.timeouts, 1);
+            return(res);
+        }
+        m->stats.sleeps ++;
+    }
+
+    // from now on we hold the mutex
+    m->owner = self;
+    m->spin = (int32_t)m->spin + ((int32_t)i - (int32_t)m->spin) / 8;
+
+    waited = s_eoy_mutex_nanosec() - start;
+    m->stats.takes ++;
+    m->stats.contentions ++;
+    m->stats.waittime += waited;
+    m->stats.lastholder = holder;
+    if(waited > m->stats.maxwaittime)
+    {
+        m->stats.maxwaittime = waited;
+    }
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eoy_mutex_futex_wait(EOYmutex *m, eOreltime_t tout, uint64_t start)
+{
+    struct timespec ts;
+    uint64_t left = 0;
+    int32_t c = 0;
+
+    // we mark the futex as contended, so that the holder will wake us
+    c = __sync_lock_test_and_set(&m->state, 2);
+
+    while(0 != c)
+    {
+        if(eok_reltimeINFINITE == tout)
+        {
+            syscall(SYS_futex, &m->state, FUTEX_WAIT_PRIVATE, 2, NULL, NULL, 0);
+        }
+        else
+        {
+            left = s_eoy_mutex_nanosec() - start;
+            if(left >= 1000ULL * tout)
+            {   // the futex stays at 2, thus the holder may do a useless wake-up
+                return(eores_NOK_timeout);
+            }
+            left = 1000ULL * tout - left;
+            ts.tv_sec  = left / 1000000000;
+            ts.tv_nsec = left % 1000000000;
+            syscall(SYS_futex, &m->state, FUTEX_WAIT_PRIVATE, 2, &ts, NULL, 0);
+        }
+
+        c = __sync_lock_test_and_set(&m->state, 2);
+    }
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eoy_mutex_futex_release(EOYmutex *m)
+{
+    if(s_eoy_mutex_threadid() != m->owner)
+    {
+        return(eores_NOK_generic);
+    }
+
+    if(0 != m->recursion)
+    {
+        m->recursion --;
+        return(eores_OK);
+    }
+
+    m->owner = 0;
+
+    // the fast path: 1 becomes 0 and nobody sleeps
+    if(1 != __sync_fetch_and_sub(&m->state, 1))
+    {
+        m->state = 0;
+        syscall(SYS_futex, &m->state, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+
+    return(eores_OK);
+}
+
+
+static uint32_t s_eoy_mutex_threadid(void)
+{
+    // the thread id is cached because gettid() is a system call
+    if(0 == s_eoy_mutex_tid)
+    {
+        s_eoy_mutex_tid = (uint32_t)syscall(SYS_gettid);
+    }
+
+    return(s_eoy_mutex_tid);
+}
+
+
+static uint64_t s_eoy_mutex_nanosec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return(((uint64_t)ts.tv_sec * 1000000000) + (uint64_t)ts.tv_nsec);
+}
+
+#endif//defined(EOY_MUTEX_USE_FUTEX)
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
 
 
 
+
@@ -34,6 +34,9 @@ extern "C" {
     The EOYmutex is an object for the YARP execution environment derived from the abstract object EOVmutex.
     It allows mutual exclusion in the YEE with priority inversion. The underlying mechanism
     is based on ... ADD_YARP_REF.  
+    On linux the mutex does not use ACE but a futex: it is taken and released with a single atomic instruction
+    when there is no contention, it spins for an adaptive number of cycles before sleeping in the kernel, it
+    supports real timeouts and it keeps statistics of its contention.
 
     @{        
  **/
@@ -52,6 +55,33 @@ extern "C" {
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
  
 
+/** @typedef    typedef struct eOymutex_cfg_t
+    @brief      eOymutex_cfg_t contains the configuration of a EOYmutex. It is used only on linux.
+ **/
+typedef struct
+{
+    eObool_t        recursive;      /**< if eobool_false the owner cannot take the mutex again, which then is cheaper */
+    uint8_t         filler[3];
+    uint32_t        maxspin;        /**< the max number of spins before sleeping. the mutex adapts them below it */
+} eOymutex_cfg_t;
+
+
+/** @typedef    typedef struct eOymutex_stats_t
+    @brief      eOymutex_stats_t contains the statistics of contention of a EOYmutex. They are kept only on linux.
+ **/
+typedef struct
+{
+    uint32_t        takes;          /**< the successful takes, recursive ones included */
+    uint32_t        contentions;    /**< the takes which have found the mutex already taken by another thread */
+    uint32_t        sleeps;         /**< the contentions which were not solved by spinning */
+    uint32_t        timeouts;       /**< the takes which have failed */
+    uint64_t        waittime;       /**< the total time in nanosec spent waiting for the mutex */
+    uint64_t        maxwaittime;    /**< the longest wait in nanosec */
+    uint32_t        lastholder;     /**< the thread id of the holder found by the last contention */
+    uint32_t        filler;
+} eOymutex_stats_t;
+
+
 /** @typedef    typedef struct EOYmutex_hid EOYmutex
     @brief      EOYmutex is an opaque struct. It is used to implement data abstraction for the YARP 
                 object so that the user cannot see its private fields and he/she is forced to manipulate the
@@ -62,7 +92,8 @@ typedef struct EOYmutex_hid EOYmutex;
 
    
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
-// empty-section
+
+extern const eOymutex_cfg_t eoy_mutex_DefaultCfg; // = {eobool_true, {0}, 100};
 
 
 // - declaration of extern public functions ---------------------------------------------------------------------------
@@ -77,6 +108,15 @@ typedef struct EOYmutex_hid EOYmutex;
 extern EOYmutex * eoy_mutex_New(void);
 
 
+/** @fn         extern EOYmutex * eoy_mutex_NewExt(const eOymutex_cfg_t *cfg)
+    @brief      Creates a new EOYmutex object as eoy_mutex_New() does but with a given configuration.
+    @param      cfg             The configuration. If NULL it is used eoy_mutex_DefaultCfg, as eoy_mutex_New() does.
+                                It is ignored if the mutex is not on linux.
+    @return     The pointer to the required EOYmutex. Never NULL.
+ **/
+extern EOYmutex * eoy_mutex_NewExt(const eOymutex_cfg_t *cfg);
+
+
 
 /** @fn         extern void eom_mutex_Delete(EOYmutex *m)
     @brief      Deletes a given EOYmutex object 
@@ -107,6 +147,17 @@ extern eOresult_t eoy_mutex_Take(EOYmutex *m, eOreltime_t tout);
 extern eOresult_t eoy_mutex_Release(EOYmutex *m); 
 
 
+/** @fn         extern eOresult_t eoy_mutex_Stats_Get(EOYmutex *m, eOymutex_stats_t *stats, eObool_t reset)
+    @brief      It gives the statistics of contention of a mutex, to be used for profiling.
+    @param      m               The mutex
+    @param      stats           Filled with the statistics.
+    @param      reset           If eobool_true the statistics restart from zero.
+    @return     eores_OK in case of success, eores_NOK_nullpointer if a param is NULL, or eores_NOK_unsupported
+                if the mutex is not on linux.
+ **/
+extern eOresult_t eoy_mutex_Stats_Get(EOYmutex *m, eOymutex_stats_t *stats, eObool_t reset);
+
+
 
 
 
@@ -63,7 +63,14 @@ struct EOYmutex_hid
     EOVmutex                *mutex;
 
     // - other stuff
-    void                    *acemutex;
+    void                    *acemutex;      // used only if not on linux
+    volatile int32_t        state;          // the futex: 0 is free, 1 is taken, 2 is taken w/ possible sleepers
+    volatile uint32_t       owner;          // the thread id of the holder or 0
+    uint32_t                recursion;
+    eObool_t                recursive;
+    uint32_t                maxspin;
+    uint32_t                spin;           // the adaptive number of spins
+    eOymutex_stats_t        stats;
 }; 
 
 
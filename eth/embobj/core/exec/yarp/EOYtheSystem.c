@@ -20,16 +20,20 @@
 // - external dependencies
 // --------------------------------------------------------------------------------------------------------------------
 
-// marco.accame: tested correct behaviour of eoy_sys_abstime_get() in pc104 on 13 may 2014
-#define EOY_SYS_USE_FEATURE_INTERFACE
-
-
 #include "stdlib.h"
 #include "EoCommon.h"
 #include "string.h"
 #include "stdio.h"
 #include "math.h"
 
+// the time is the yarp time. on linux it can be taken instead from a monotonic clock by defining EOY_SYS_USE_MONOTONIC_CLOCK:
+// it is read inside the vDSO without a system call and it does not jump when NTP steps the wall clock, but it does not 
+// follow a network clock as the yarp time can do.
+// marco.accame: tested correct behaviour of eoy_sys_abstime_get() w/ the yarp time in pc104 on 13 may 2014
+#if     !defined(EOY_SYS_USE_MONOTONIC_CLOCK) || !defined(EO_TAILOR_CODE_FOR_LINUX)
+#define EOY_SYS_USE_FEATURE_INTERFACE
+#endif
+
 #if     defined(EOY_SYS_USE_FEATURE_INTERFACE)
 #include "FeatureInterface.h"
 #endif
@@ -38,18 +42,11 @@
 #include "EOtheErrorManager.h"
 #include "EOVtheSystem_hid.h" 
 
-#if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
-    #if !defined(_MSC_VER)
-    #warning  marco.accame on 24 april 2014: remember to test w/ EOY_SYS_USE_FEATURE_INTERFACE defined so that te code is portable w/ YARP
-    #endif
-#endif
-
 
 
 #if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
   #if   defined(EO_TAILOR_CODE_FOR_LINUX)
   #include <time.h>
-  #include <sys/time.h>
   #endif
 #endif
 
@@ -71,7 +68,13 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
+  #if   defined(EO_TAILOR_CODE_FOR_LINUX) && !defined(EOY_SYS_CLOCK)
+  // CLOCK_MONOTONIC_RAW is also immune from the NTP slewing, but older kernels read it with a system call
+  #define EOY_SYS_CLOCK     CLOCK_MONOTONIC
+  #endif
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -104,7 +107,7 @@ static void s_eoy_sys_stop(void);
 
 #if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
 #if   defined(EO_TAILOR_CODE_FOR_LINUX)
-static int s_timeval_subtract(struct timespec *_result, struct timespec *_x, struct timespec *_y);
+static uint64_t s_eoy_sys_clock_nanosec(void);
 #endif
 #endif
 
@@ -113,7 +116,7 @@ static int s_timeval_subtract(struct timespec *_result, struct timespec *_x, str
 // --------------------------------------------------------------------------------------------------------------------
 
 
-static const char s_eobj_ownname[] = "EOYtheSystem";
+//static const char s_eobj_ownname[] = "EOYtheSystem";
 
 static const eOysystem_cfg_t s_eoy_sys_defaultconfig = 
 {
@@ -129,7 +132,7 @@ static EOYtheSystem s_eoy_system =
 
 #if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
 #if   defined(EO_TAILOR_CODE_FOR_LINUX)
-static struct timespec s_eoy_sys_linux_start_time;
+static uint64_t s_eoy_sys_linux_start_nanosec = 0;   // the EOY_SYS_CLOCK which is the zero of the lifetime
 #endif
 #endif
 
@@ -169,7 +172,7 @@ extern EOYtheSystem * eoy_sys_Initialise(const eOysystem_cfg_t *syscfg,
 #else
 
 #if   defined(EO_TAILOR_CODE_FOR_LINUX)
-  clock_gettime(CLOCK_REALTIME, &s_eoy_sys_linux_start_time);
+    s_eoy_sys_linux_start_nanosec = s_eoy_sys_clock_nanosec();
 #endif
 
 #endif
@@ -191,6 +194,7 @@ extern EOYtheSystem* eoy_sys_GetHandle(void)
 
 extern void eoy_sys_Start(EOYtheSystem *p, eOvoid_fp_void_t userinit_fn)
 {
+    (void)p;
     s_eoy_sys_start(userinit_fn);
 }
 
@@ -252,10 +256,7 @@ static eOabstime_t s_eoy_sys_abstime_get(void)
 #else//defined(EOY_SYS_USE_FEATURE_INTERFACE)
 
 #if   defined(EO_TAILOR_CODE_FOR_LINUX)
-    struct timespec curr_time, diff;
-    clock_gettime(CLOCK_REALTIME, &curr_time);
-    s_timeval_subtract(&diff, &curr_time, &s_eoy_sys_linux_start_time);
-    time = ((diff.tv_sec * 1000 * 1000) + (diff.tv_nsec/1000));
+    time = (s_eoy_sys_clock_nanosec() - s_eoy_sys_linux_start_nanosec) / 1000;
 #endif
 
 #endif//defined(EOY_SYS_USE_FEATURE_INTERFACE)
@@ -268,6 +269,9 @@ static void s_eoy_sys_abstime_set(eOabstime_t time)
 {
 #if     defined(EOY_SYS_USE_FEATURE_INTERFACE)
     s_eoy_system.start = ((double) time)/ 1e6;
+#elif   defined(EO_TAILOR_CODE_FOR_LINUX)
+    // we move the zero of the lifetime so that now it is equal to time
+    s_eoy_sys_linux_start_nanosec = s_eoy_sys_clock_nanosec() - (1000 * time);
 #else
     // do nothing ...
 #endif
@@ -282,6 +286,8 @@ static eOnanotime_t s_eoy_sys_nanotime_get(void)
     double delta = feat_yarp_time_now() - s_eoy_system.start;
     delta *= 1e9;
     nanotime = (eOnanotime_t)floor(delta);
+#elif   defined(EO_TAILOR_CODE_FOR_LINUX)
+    nanotime = s_eoy_sys_clock_nanosec() - s_eoy_sys_linux_start_nanosec;
 #endif
 
     return(nanotime);
@@ -297,37 +303,13 @@ static void s_eoy_sys_stop(void)
 #if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
 
 #if   defined(EO_TAILOR_CODE_FOR_LINUX)
-// risultato= stop - start, cioè _result = _x - _y
-static int s_timeval_subtract(struct timespec *_result, struct timespec *_x, struct timespec *_y)
+static uint64_t s_eoy_sys_clock_nanosec(void)
 {
-	//difftime();
-	/* Perform the carry for the later subtraction by updating y. */
-	static const long int MULTIPLIER = 1000 * 1000 * 1000;
-
-	if(_x->tv_nsec < _y->tv_nsec)
-	{
-		int nsec = (_y->tv_nsec - _x->tv_nsec) / MULTIPLIER + 1;
-
-		_y->tv_nsec -= MULTIPLIER * nsec;
-		_y->tv_sec += nsec;
-	}
-
-	if(_x->tv_nsec - _y->tv_nsec > MULTIPLIER)
-	{
-		int nsec = (_x->tv_nsec - _y->tv_nsec) / MULTIPLIER;
-
-		_y->tv_nsec += MULTIPLIER * nsec;
-		_y->tv_sec -= nsec;
-	}
-
-	/* Compute the time remaining to wait. tv_usec is certainly positive. */
-
-	_result->tv_sec = _x->tv_sec - _y->tv_sec;
-	_result->tv_nsec = _x->tv_nsec - _y->tv_nsec;
+    struct timespec ts;
 
-	/* Return 1 if result is negative. */
+    clock_gettime(EOY_SYS_CLOCK, &ts);
 
-	return _x->tv_sec < _y->tv_sec;
+    return(((uint64_t)ts.tv_sec * 1000000000) + (uint64_t)ts.tv_nsec);
 }
 #endif
 
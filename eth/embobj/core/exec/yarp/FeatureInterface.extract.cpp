@@ -6,10 +6,10 @@
 
 
 
-// returns a void pointer to the allocated ACE_Recursive_Thread_Mutex 
+// returns a void pointer to the allocated ACE_Recursive_Thread_Mutex. it must be released w/ ace_mutex_delete()
 void* ace_mutex_new(void)
 {
-    return(ACE_Recursive_Thread_Mutex());
+    return(new ACE_Recursive_Thread_Mutex());
 }
 
 // returns 0 on success to take mutex, -3 on failure upon timeout, -2 on failure upon null pointer. m is pointer obtained w/ ace_mutex_new(), tout_usec is in microsec (no timeout is 0xffffffff).
@@ -40,3 +40,18 @@ int8_t ace_mutex_release(void* m)
     return(0);
 }
 
+// returns 0 on success to delete the mutex, -2 on failure upon null pointer. m is pointer obtained w/ ace_mutex_new(), 
+// which must not be taken by anybody
+int8_t ace_mutex_delete(void* m)
+{
+    ACE_Recursive_Thread_Mutex* acemtx = (ACE_Recursive_Thread_Mutex*)m;
+    if(NULL == acemtx)
+    {
+        return(-2);
+    }
+    
+    delete acemtx;
+    
+    return(0);
+}
+
@@ -71,6 +71,11 @@ extern "C" {
 // this macro can be used to obtain a eOprotID32_t value as function eoprot_ID_get() does, but as a macro it can be used for initialisation of constants  
 #define EOPROT_ID_GET(end, ent, ind, tag)   ( (uint32_t)( (((end)&0xff)<<24) | (((ent)&0xff)<<16) | (((ind)&0xff)<<8) | (((tag)&0xff)) ) ) 
 
+// this macro gives the ID to be used in an ask<> which requests in bulk all the indices of an entity, all the entities of an 
+// endpoint (ent is eoprot_entity_all) or all the endpoints (end is eoprot_endpoint_all). the receiver replies with one say<> 
+// of the wholeitem for each index of each entity, spread over as many ropframes as needed.
+#define EOPROT_ID_BULK_GET(end, ent)        EOPROT_ID_GET((end), (ent), eoprot_index_none, eoprot_tag_none)
+
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
 
 
@@ -216,10 +221,11 @@ typedef enum
     eoprot_entity_as_extorque               = eoas_entity_extorque,     /**<  */  
     eoprot_entity_as_inertial               = eoas_entity_inertial,     /**<  */   
     eoprot_entity_sk_skin                   = eosk_entity_skin,         /**<  */
+    eoprot_entity_all                       = 254,                      /**< specifies all the entities of an endpoint in some operations */
     eoprot_entity_none                      = EOK_uint08dummy
 } eOprot_entity_t;
 
-enum { eoprot_entities_numberof = 12 }; // it does not count the eoprot_entity_none.
+enum { eoprot_entities_numberof = 12 }; // it does not count the eoprot_entity_none and eoprot_entity_all.
 
 
 /** @typedef    typedef enum eOprot_index_t
@@ -277,6 +283,18 @@ typedef struct
     uint8_t             numberofentities[eoprot_maxvalueof_entity+1];   /*< the multiplicity of each entity in position of the entity */
 } eOprot_EPcfg_t;
 
+
+// it is what eoprot_variable_descriptor_get() resolves of a variable in one pass
+typedef struct
+{
+    void*               ram;        /*< the ram of the variable. it is NULL if the ram of the endpoint is not configured or if it cannot be addressed */
+    const void*         rom;        /*< the EOnv_rom_t of the variable */
+    uint16_t            size;       /*< the size of the variable */
+    eObool_t            proxied;    /*< eobool_true if the variable is proxied */
+    uint8_t             filler;
+    eOprotProgNumber_t  prognum;    /*< the progressive number of the variable inside its endpoint */
+} eOprot_variable_descriptor_t;
+
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
 extern const eOprot_EPcfg_t eoprot_arrayof_stdEPcfg[eoprot_endpoints_numberof];
@@ -332,6 +350,15 @@ extern eOprotIndex_t eoprot_ID2index(eOprotID32_t id);
 extern eOprotTag_t eoprot_ID2tag(eOprotID32_t id); 
 
 
+/** @fn         extern eObool_t eoprot_ID_isbulk(eOprotID32_t id)
+    @brief      it tells if the ID is one of those given by EOPROT_ID_BULK_GET(), which do not refer to a variable
+                but to all the wholeitems of an entity or of an endpoint.
+    @param      id              the identifier.
+    @return     eobool_true if the ID requests a bulk, eobool_false otherwise.
+ **/
+extern eObool_t eoprot_ID_isbulk(eOprotID32_t id); 
+
+
 /** @fn         extern const char* eoprot_EP2string(eOprotEndpoint_t ep)
     @brief      it returns a string which describes the endpoint in argument. 
                 if the argument maps to one of the values defined in eOprot_endpoint_t, then the associated 
@@ -477,6 +504,35 @@ extern eOresult_t eoprot_config_endpoint_entities(eOprotBRD_t brd, eOprotEndpoin
 extern eOresult_t eoprot_config_proxied_variables(eOprotBRD_t brd, eOprotEndpoint_t ep, eObool_fp_uint32_t isvarproxied_fn);
 
 
+/** @fn         extern eOresult_t eoprot_config_endpoint_hotvariables(eOprotBRD_t brd, eOprotEndpoint_t ep, eObool_fp_uint32_t isvarhot_fn)
+    @brief      it configures the layout of the ram of an endpoint. by default (or with isvarhot_fn NULL) the ram is flat: one entity 
+                after another as in the struct eOprot_bxx_endpointname_t. otherwise the hot variables of all the entities are packed at
+                the start of the ram and the cold ones are kept apart, so that a loop over the status of all joints touches contiguous 
+                memory. the hot region of each entity is the range which contains all the variables for which isvarhot_fn() returns true 
+                (evaluated on index 0), widened so that no variable crosses its boundary. the size of the ram does not change and 
+                eoprot_variable_ramof_get() resolves every variable in both layouts apart from the wholeitem of a split entity, which 
+                is not contiguous anymore. eoprot_variable_ram_write() / eoprot_variable_ram_read() and eoprot_entity_ram_write() / 
+                eoprot_entity_ram_read() copy any variable or entity in any layout, and the EOnv objects use them for the wholeitem.
+                also the initialiser of the endpoint receives the ram in this layout, thus it must not cast it to the struct.
+                It must be called when the ram of the endpoint is not configured, because the layout is computed inside 
+                eoprot_config_endpoint_ram().
+    @param      brd                 the number of board 
+    @param      ep                  the endpoint
+    @param      isvarhot_fn         tells if a variable is hot. eoprot_variable_ishot_default() selects the read-only ones (the status).
+    @return     eores_OK or eores_NOK_generic upon failure or if the ram is already configured.
+ **/
+extern eOresult_t eoprot_config_endpoint_hotvariables(eOprotBRD_t brd, eOprotEndpoint_t ep, eObool_fp_uint32_t isvarhot_fn);
+
+
+/** @fn         extern eObool_t eoprot_variable_ishot_default(uint32_t id)
+    @brief      the default selection of hot variables for eoprot_config_endpoint_hotvariables(): the read-only ones apart from the
+                wholeitem. 
+    @param      id              the identifier of the variable.
+    @return     eobool_true if the variable is hot.
+ **/
+extern eObool_t eoprot_variable_ishot_default(uint32_t id);
+
+
 /** @fn         extern eObool_t eoprot_endpoint_configured_is(eOprotBRD_t brd, eOprotEndpoint_t ep)
     @brief      it tells if a given board has a given endpoint configured.
     @param      brd                 the number of board 
@@ -641,7 +697,8 @@ extern eOresult_t eoprot_config_endpoint_ram(eOprotBRD_t brd, eOprotEndpoint_t e
                 for the same endpoint the number of entities may be different.
     @param      brd             the number of the board.
     @param      id              the identifier of the variable.
-    @return     the ram of the variable or NULL in case of invalid parameters.
+    @return     the ram of the variable or NULL in case of invalid parameters or if the variable is the wholeitem of an entity split 
+                in a hot and in a cold part (see eoprot_config_endpoint_hotvariables()). eoprot_variable_ram_read() works also then.
  **/
 extern void* eoprot_variable_ramof_get(eOprotBRD_t brd, eOprotID32_t id);
 
@@ -674,6 +731,18 @@ extern eObool_t eoprot_variable_is_proxied(eOprotBRD_t brd, eOprotID32_t id);
  **/
 extern void* eoprot_variable_romof_get(eOprotBRD_t brd, eOprotID32_t id);
 
+
+/** @fn         extern eOresult_t eoprot_variable_descriptor_get(eOprotBRD_t brd, eOprotID32_t id, eOprot_variable_descriptor_t *des)
+    @brief      it validates the id as eoprot_id_isvalid() does and then it fills des with what eoprot_variable_ramof_get(), 
+                eoprot_variable_romof_get(), eoprot_variable_sizeof_get(), eoprot_variable_is_proxied() and eoprot_endpoint_id2prognum()
+                would return, but it computes the board data and the offsets only once.
+    @param      brd             the number of the board.
+    @param      id              the identifier of the variable.
+    @param      des             the descriptor to fill.
+    @return     eores_OK, or eores_NOK_generic if the (brd, id) pair is not valid, or eores_NOK_nullpointer if des is NULL.
+ **/
+extern eOresult_t eoprot_variable_descriptor_get(eOprotBRD_t brd, eOprotID32_t id, eOprot_variable_descriptor_t *des);
+
 /** @fn         extern eObool_t eoprot_entity_configured_is(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity)
     @brief      tells if the entity is configured.
     @param      brd             the number of the board.
@@ -701,11 +770,60 @@ extern eObool_t eoprot_entity_configured_is(eOprotBRD_t brd, eOprotEndpoint_t ep
     @param      ep              the endpoint.
     @param      entity          the entity.
     @param      index           the index.
-    @return     the ram of the entity or NULL in case of invalid parameters.
+    @return     the ram of the entity or NULL in case of invalid parameters or if the entity is split in a hot and in a cold part
+                (see eoprot_config_endpoint_hotvariables()). eoprot_entity_ram_read() works also then.
  **/
 extern void* eoprot_entity_ramof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index);
 
 
+/** @fn         extern eOresult_t eoprot_entity_ram_write(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, const void *value)
+    @brief      it copies the whole value of an entity (with the same layout of its struct) into its ram. it works with any layout
+                of the ram of the endpoint.
+    @param      brd             the number of the board.
+    @param      ep              the endpoint.
+    @param      entity          the entity.
+    @param      index           the index.
+    @param      value           the value, of eoprot_entity_sizeof_get() bytes.
+    @return     eores_OK or eores_NOK_generic in case of invalid parameters or if the ram is not configured.
+ **/
+extern eOresult_t eoprot_entity_ram_write(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, const void *value);
+
+
+/** @fn         extern eOresult_t eoprot_entity_ram_read(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, void *value)
+    @brief      it copies the ram of an entity into value, with the same layout of its struct. it works with any layout of the
+                ram of the endpoint.
+    @param      brd             the number of the board.
+    @param      ep              the endpoint.
+    @param      entity          the entity.
+    @param      index           the index.
+    @param      value           the destination, of eoprot_entity_sizeof_get() bytes.
+    @return     eores_OK or eores_NOK_generic in case of invalid parameters or if the ram is not configured.
+ **/
+extern eOresult_t eoprot_entity_ram_read(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, void *value);
+
+
+/** @fn         extern eOresult_t eoprot_variable_ram_write(eOprotBRD_t brd, eOprotID32_t id, const void *value)
+    @brief      it copies the value of a variable into its ram. it works with any layout of the ram of the endpoint, also for the 
+                wholeitem of an entity split in a hot and in a cold part.
+    @param      brd             the number of the board.
+    @param      id              the identifier of the variable.
+    @param      value           the value, of eoprot_variable_sizeof_get() bytes.
+    @return     eores_OK or eores_NOK_generic in case of invalid parameters or if the ram is not configured.
+ **/
+extern eOresult_t eoprot_variable_ram_write(eOprotBRD_t brd, eOprotID32_t id, const void *value);
+
+
+/** @fn         extern eOresult_t eoprot_variable_ram_read(eOprotBRD_t brd, eOprotID32_t id, void *value)
+    @brief      it copies the ram of a variable into value. it works with any layout of the ram of the endpoint, also for the 
+                wholeitem of an entity split in a hot and in a cold part.
+    @param      brd             the number of the board.
+    @param      id              the identifier of the variable.
+    @param      value           the destination, of eoprot_variable_sizeof_get() bytes.
+    @return     eores_OK or eores_NOK_generic in case of invalid parameters or if the ram is not configured.
+ **/
+extern eOresult_t eoprot_variable_ram_read(eOprotBRD_t brd, eOprotID32_t id, void *value);
+
+
 /** @fn         extern uint16_t eoprot_entity_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity)
     @brief      it gets the size of the entity on a given (board, endpoint, entity). The dependency from the board is necessary because
                 for the same endpoint the number of entities may be different.
@@ -717,6 +835,16 @@ extern void* eoprot_entity_ramof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOpro
 extern uint16_t eoprot_entity_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity);
 
 
+/** @fn         extern const void* eoprot_entity_defaultvalue_get(eOprotEndpoint_t ep, eOprotEntity_t entity)
+    @brief      it gets the default value of a whole entity, which contains the reset values of all its variables. its size
+                is given by eoprot_entity_sizeof_get().
+    @param      ep              the endpoint.
+    @param      entity          the entity.
+    @return     the default value of the entity or NULL in case of invalid parameters.
+ **/
+extern const void* eoprot_entity_defaultvalue_get(eOprotEndpoint_t ep, eOprotEntity_t entity);
+
+
 /** @fn         extern uint8_t eoprot_entity_numberof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity)
     @brief      it gets the number of the entities on a given (board, endpoint, entity). The dependency from the board is necessary because
                 for the same endpoint the number of entities may be different..
@@ -0,0 +1,385 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPROTOCOL_HPP_
+#define _EOPROTOCOL_HPP_
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+    #error EoProtocol.hpp requires c++17
+#endif
+
+
+/** @file       EoProtocol.hpp
+    @brief      This header file gives compile-time typed access to the variables of the protocol.
+    @author     marco.accame@iit.it
+    @date       06/05/2013
+**/
+
+/** @defgroup eo_EoProtocolHPP Compile-time access to the variables of the protocol 
+    For host code written in c++17. Every variable (ep, entity, tag) is a type eoprot::var<ep, entity, tag> which gives at 
+    compile time its id32, its c type, its size and its offset inside the struct of the entity. There are also shorter aliases 
+    as eoprot::mc::joint::status_core, and eoprot::mc::joint::entity describes the entity.
+    
+    eoprot::mc::joint::status_core::in(joint) returns a typed reference inside a eOmc_joint_t without any lookup.
+    eoprot::mc::joint::status_core::ramof(brd, index) returns a typed pointer inside the ram of the endpoint with a single
+    lookup of the entity plus the constant offset. if the entity is split by eoprot_config_endpoint_hotvariables(), it uses 
+    eoprot_variable_ramof_get() instead. the split entities and their wholeitem have no pointer: read() and write() copy them 
+    in any layout.
+    
+    The list of variables in here must follow the tags in EoProtocolMN.h, EoProtocolMC.h, EoProtocolAS.h and EoProtocolSK.h 
+    and the members used by the resetval of their descriptors in the EoProtocolXX_rom.c files. It does not compile if a tag 
+    or an entity of those files has no type in here, or if a tag in here is beyond eoprot_tags_xx_yyy_numberof.
+    
+    @{        
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "EoProtocol.h"
+#include "EoProtocolMN.h"
+#include "EoProtocolMC.h"
+#include "EoProtocolAS.h"
+#include "EoProtocolSK.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types ------------------------------------------------------------------------- 
+
+namespace eoprot {
+
+template<eOprotEndpoint_t EP, eOprotEntity_t EN> 
+struct entity;                      // specialised for every entity of the protocol 
+
+template<eOprotEndpoint_t EP, eOprotEntity_t EN, eOprotTag_t TAG> 
+struct var;                         // specialised for every variable of the protocol
+    
+namespace detail {
+
+template<eOprotEndpoint_t EP, eOprotEntity_t EN, typename T>
+struct entity_base
+{
+    using type = T;
+    static constexpr eOprotEndpoint_t endpoint = EP;
+    static constexpr eOprotEntity_t id = EN;
+    static constexpr uint16_t size = sizeof(T);
+    
+    static_assert(sizeof(T) <= 0xffff, "the entities of the protocol use 16 bits for their size");
+    
+    // it is NULL if the ram is not configured or if the entity is split in a hot and a cold part 
+    static T* ramof(eOprotBRD_t brd, eOprotIndex_t index)
+    {
+        return(static_cast<T*>(eoprot_entity_ramof_get(brd, EP, EN, index)));
+    }
+    
+    // they gather and scatter the entity if it is split
+    static bool read(eOprotBRD_t brd, eOprotIndex_t index, T& value)
+    {
+        return(eores_OK == eoprot_entity_ram_read(brd, EP, EN, index, &value));
+    }
+    
+    static bool write(eOprotBRD_t brd, eOprotIndex_t index, const T& value)
+    {
+        return(eores_OK == eoprot_entity_ram_write(brd, EP, EN, index, &value));
+    }
+};
+
+template<typename ENTITY, eOprotTag_t TAG, typename T, std::size_t OFFSET>
+struct variable
+{
+    using entity = ENTITY;
+    using entity_type = typename ENTITY::type;
+    using type = T;
+    static constexpr eOprotEndpoint_t endpoint = ENTITY::endpoint;
+    static constexpr eOprotEntity_t entityid = ENTITY::id;
+    static constexpr eOprotTag_t tag = TAG;
+    static constexpr uint16_t size = sizeof(T);
+    static constexpr uint16_t offset = OFFSET;
+    
+    static_assert((OFFSET + sizeof(T)) <= sizeof(entity_type), "the variable must be inside its entity");
+    
+    static constexpr eOprotID32_t id32(eOprotIndex_t index = 0)
+    {
+        return(EOPROT_ID_GET(ENTITY::endpoint, ENTITY::id, index, TAG));
+    }
+    
+    static T* ramof(eOprotBRD_t brd, eOprotIndex_t index)
+    {
+        // in the flat layout the entity is contiguous: one lookup plus a constant offset
+        uint8_t* e = static_cast<uint8_t*>(eoprot_entity_ramof_get(brd, ENTITY::endpoint, ENTITY::id, index));
+        if(nullptr != e)
+        {
+            return(reinterpret_cast<T*>(e + OFFSET));
+        }
+        return(static_cast<T*>(eoprot_variable_ramof_get(brd, id32(index))));
+    }
+    
+    // they also work for the wholeitem of a split entity, for which ramof() is NULL
+    static bool read(eOprotBRD_t brd, eOprotIndex_t index, T& value)
+    {
+        return(eores_OK == eoprot_variable_ram_read(brd, id32(index), &value));
+    }
+    
+    static bool write(eOprotBRD_t brd, eOprotIndex_t index, const T& value)
+    {
+        return(eores_OK == eoprot_variable_ram_write(brd, id32(index), &value));
+    }
+};
+
+// it is true if T has a definition, thus if the var<> or the entity<> T has been specialised
+template<typename T, typename = void>
+struct is_defined : std::false_type {};
+
+template<typename T>
+struct is_defined<T, std::void_t<decltype(sizeof(T))>> : std::true_type {};
+
+template<eOprotEndpoint_t EP, eOprotEntity_t EN, std::size_t... TAG>
+constexpr bool all_tags_defined(std::index_sequence<TAG...>)
+{
+    return((is_defined<var<EP, EN, static_cast<eOprotTag_t>(TAG)>>::value && ...));
+}
+
+template<eOprotEndpoint_t EP, std::size_t... EN>
+constexpr bool all_entities_defined(std::index_sequence<EN...>)
+{
+    return((is_defined<entity<EP, static_cast<eOprotEntity_t>(EN)>>::value && ...));
+}
+
+} // namespace detail
+
+
+// - the entities and their variables
+
+#define EOPROT_HPP_ENTITY(ep, ent, endp, ctype)                                                                         \
+    template<> struct entity<endp, eoprot_entity_##ep##_##ent>                                                          \
+        : detail::entity_base<endp, eoprot_entity_##ep##_##ent, ctype> {};                                              \
+    namespace ep { namespace ent { using entity = eoprot::entity<endp, eoprot_entity_##ep##_##ent>; } } 
+
+#define EOPROT_HPP_TAGBOUND(ep, ent, name)                                                                              \
+    static_assert(static_cast<int>(eoprot_tag_##ep##_##ent##_##name) <                                                  \
+                  static_cast<int>(eoprot_tags_##ep##_##ent##_numberof),                                                \
+                  "eoprot_tag_" #ep "_" #ent "_" #name " is beyond eoprot_tags_" #ep "_" #ent "_numberof");
+
+#define EOPROT_HPP_VARIABLE(ep, ent, name, member)                                                                      \
+    template<> struct var<ep::ent::entity::endpoint, ep::ent::entity::id, eoprot_tag_##ep##_##ent##_##name>             \
+        : detail::variable<ep::ent::entity, eoprot_tag_##ep##_##ent##_##name,                                           \
+                           std::remove_reference_t<decltype(std::declval<ep::ent::entity::type&>().member)>,            \
+                           offsetof(ep::ent::entity::type, member)>                                                     \
+    {                                                                                                                   \
+        static type& in(entity_type& e) { return(e.member); }                                                           \
+        static const type& in(const entity_type& e) { return(e.member); }                                               \
+    };                                                                                                                  \
+    namespace ep { namespace ent {                                                                                      \
+        using name = eoprot::var<ep::ent::entity::endpoint, ep::ent::entity::id, eoprot_tag_##ep##_##ent##_##name>; } }  \
+    EOPROT_HPP_TAGBOUND(ep, ent, name)
+
+#define EOPROT_HPP_WHOLEITEM(ep, ent, name)                                                                             \
+    template<> struct var<ep::ent::entity::endpoint, ep::ent::entity::id, eoprot_tag_##ep##_##ent##_##name>             \
+        : detail::variable<ep::ent::entity, eoprot_tag_##ep##_##ent##_##name, ep::ent::entity::type, 0>                 \
+    {                                                                                                                   \
+        static type& in(entity_type& e) { return(e); }                                                                  \
+        static const type& in(const entity_type& e) { return(e); }                                                      \
+    };                                                                                                                  \
+    namespace ep { namespace ent {                                                                                      \
+        using name = eoprot::var<ep::ent::entity::endpoint, ep::ent::entity::id, eoprot_tag_##ep##_##ent##_##name>; } }  \
+    EOPROT_HPP_TAGBOUND(ep, ent, name)
+
+// they must follow all the variables of an entity and all the entities of an endpoint
+#define EOPROT_HPP_ALLTAGS(ep, ent)                                                                                     \
+    static_assert(detail::all_tags_defined<ep::ent::entity::endpoint, ep::ent::entity::id>(                             \
+                      std::make_index_sequence<eoprot_tags_##ep##_##ent##_numberof>()),                                 \
+                  "some of the eoprot_tags_" #ep "_" #ent "_numberof tags have no eoprot::var<>");
+
+#define EOPROT_HPP_ALLENTITIES(ep, endp)                                                                                \
+    static_assert(detail::all_entities_defined<endp>(std::make_index_sequence<eoprot_entities_##ep##_numberof>()),      \
+                  "some of the eoprot_entities_" #ep "_numberof entities have no eoprot::entity<>");
+
+
+// - endpoint management
+
+EOPROT_HPP_ENTITY(mn, comm, eoprot_endpoint_management, eOmn_comm_t)
+EOPROT_HPP_WHOLEITEM(mn, comm, wholeitem)
+EOPROT_HPP_VARIABLE(mn, comm, status, status)
+EOPROT_HPP_VARIABLE(mn, comm, status_managementprotocolversion, status.managementprotocolversion)
+EOPROT_HPP_VARIABLE(mn, comm, cmmnds_command_querynumof, cmmnds.command.cmd.querynumof)
+EOPROT_HPP_VARIABLE(mn, comm, cmmnds_command_queryarray, cmmnds.command.cmd.queryarray)
+EOPROT_HPP_VARIABLE(mn, comm, cmmnds_command_replynumof, cmmnds.command.cmd.replynumof)
+EOPROT_HPP_VARIABLE(mn, comm, cmmnds_command_replyarray, cmmnds.command.cmd.replyarray)
+EOPROT_HPP_VARIABLE(mn, comm, cmmnds_command_config, cmmnds.command.cmd.config)
+EOPROT_HPP_ALLTAGS(mn, comm)
+
+EOPROT_HPP_ENTITY(mn, appl, eoprot_endpoint_management, eOmn_appl_t)
+EOPROT_HPP_WHOLEITEM(mn, appl, wholeitem)
+EOPROT_HPP_VARIABLE(mn, appl, config, config)
+EOPROT_HPP_VARIABLE(mn, appl, config_txratedivider, config.txratedivider)
+EOPROT_HPP_VARIABLE(mn, appl, status, status)
+EOPROT_HPP_VARIABLE(mn, appl, cmmnds_go2state, cmmnds.go2state)
+EOPROT_HPP_ALLTAGS(mn, appl)
+
+EOPROT_HPP_ENTITY(mn, info, eoprot_endpoint_management, eOmn_info_t)
+EOPROT_HPP_WHOLEITEM(mn, info, wholeitem)
+EOPROT_HPP_VARIABLE(mn, info, config, config)
+EOPROT_HPP_VARIABLE(mn, info, config_enabled, config.enabled)
+EOPROT_HPP_VARIABLE(mn, info, status, status)
+EOPROT_HPP_VARIABLE(mn, info, status_basic, status.basic)
+EOPROT_HPP_ALLTAGS(mn, info)
+
+EOPROT_HPP_ENTITY(mn, service, eoprot_endpoint_management, eOmn_service_t)
+EOPROT_HPP_WHOLEITEM(mn, service, wholeitem)
+EOPROT_HPP_VARIABLE(mn, service, status_commandresult, status.commandresult)
+EOPROT_HPP_VARIABLE(mn, service, cmmnds_command, cmmnds.command)
+EOPROT_HPP_ALLTAGS(mn, service)
+EOPROT_HPP_ALLENTITIES(mn, eoprot_endpoint_management)
+
+
+// - endpoint motioncontrol
+
+EOPROT_HPP_ENTITY(mc, joint, eoprot_endpoint_motioncontrol, eOmc_joint_t)
+EOPROT_HPP_WHOLEITEM(mc, joint, wholeitem)
+EOPROT_HPP_VARIABLE(mc, joint, config, config)
+EOPROT_HPP_VARIABLE(mc, joint, config_pidposition, config.pidposition)
+EOPROT_HPP_VARIABLE(mc, joint, config_pidvelocity, config.pidvelocity)
+EOPROT_HPP_VARIABLE(mc, joint, config_pidtorque, config.pidtorque)
+EOPROT_HPP_VARIABLE(mc, joint, config_limitsofjoint, config.limitsofjoint)
+EOPROT_HPP_VARIABLE(mc, joint, config_impedance, config.impedance)
+EOPROT_HPP_VARIABLE(mc, joint, config_motor_params, config.motor_params)
+EOPROT_HPP_VARIABLE(mc, joint, config_tcfiltertype, config.tcfiltertype)
+EOPROT_HPP_VARIABLE(mc, joint, status, status)
+EOPROT_HPP_VARIABLE(mc, joint, status_core, status.core)
+EOPROT_HPP_VARIABLE(mc, joint, status_target, status.target)
+EOPROT_HPP_VARIABLE(mc, joint, status_core_modes_controlmodestatus, status.core.modes.controlmodestatus)
+EOPROT_HPP_VARIABLE(mc, joint, status_core_modes_interactionmodestatus, status.core.modes.interactionmodestatus)
+EOPROT_HPP_VARIABLE(mc, joint, status_core_modes_ismotiondone, status.core.modes.ismotiondone)
+EOPROT_HPP_VARIABLE(mc, joint, status_addinfo_multienc, status.addinfo.multienc)
+EOPROT_HPP_VARIABLE(mc, joint, inputs, inputs)
+EOPROT_HPP_VARIABLE(mc, joint, inputs_externallymeasuredtorque, inputs.externallymeasuredtorque)
+EOPROT_HPP_VARIABLE(mc, joint, cmmnds_calibration, cmmnds.calibration)
+EOPROT_HPP_VARIABLE(mc, joint, cmmnds_setpoint, cmmnds.setpoint)
+EOPROT_HPP_VARIABLE(mc, joint, cmmnds_stoptrajectory, cmmnds.stoptrajectory)
+EOPROT_HPP_VARIABLE(mc, joint, cmmnds_controlmode, cmmnds.controlmode)
+EOPROT_HPP_VARIABLE(mc, joint, cmmnds_interactionmode, cmmnds.interactionmode)
+EOPROT_HPP_ALLTAGS(mc, joint)
+
+EOPROT_HPP_ENTITY(mc, motor, eoprot_endpoint_motioncontrol, eOmc_motor_t)
+EOPROT_HPP_WHOLEITEM(mc, motor, wholeitem)
+EOPROT_HPP_VARIABLE(mc, motor, config, config)
+EOPROT_HPP_VARIABLE(mc, motor, config_currentlimits, config.currentLimits)
+EOPROT_HPP_VARIABLE(mc, motor, config_gearboxratio, config.gearboxratio)
+EOPROT_HPP_VARIABLE(mc, motor, config_rotorencoder, config.rotorEncoderResolution)
+EOPROT_HPP_VARIABLE(mc, motor, config_pwmlimit, config.pwmLimit)
+EOPROT_HPP_VARIABLE(mc, motor, config_temperaturelimit, config.temperatureLimit)
+EOPROT_HPP_VARIABLE(mc, motor, status, status)
+EOPROT_HPP_VARIABLE(mc, motor, status_basic, status.basic)
+EOPROT_HPP_ALLTAGS(mc, motor)
+
+EOPROT_HPP_ENTITY(mc, controller, eoprot_endpoint_motioncontrol, eOmc_controller_t)
+EOPROT_HPP_WHOLEITEM(mc, controller, wholeitem)
+EOPROT_HPP_VARIABLE(mc, controller, config, config)
+EOPROT_HPP_VARIABLE(mc, controller, config_jointcoupling, config.jointcoupling)
+EOPROT_HPP_VARIABLE(mc, controller, status, status)
+EOPROT_HPP_ALLTAGS(mc, controller)
+EOPROT_HPP_ALLENTITIES(mc, eoprot_endpoint_motioncontrol)
+
+
+// - endpoint analogsensors
+
+EOPROT_HPP_ENTITY(as, strain, eoprot_endpoint_analogsensors, eOas_strain_t)
+EOPROT_HPP_WHOLEITEM(as, strain, wholeitem)
+EOPROT_HPP_VARIABLE(as, strain, config, config)
+EOPROT_HPP_VARIABLE(as, strain, status, status)
+EOPROT_HPP_VARIABLE(as, strain, status_fullscale, status.fullscale)
+EOPROT_HPP_VARIABLE(as, strain, status_calibratedvalues, status.calibratedvalues)
+EOPROT_HPP_VARIABLE(as, strain, status_uncalibratedvalues, status.uncalibratedvalues)
+EOPROT_HPP_ALLTAGS(as, strain)
+
+EOPROT_HPP_ENTITY(as, mais, eoprot_endpoint_analogsensors, eOas_mais_t)
+EOPROT_HPP_WHOLEITEM(as, mais, wholeitem)
+EOPROT_HPP_VARIABLE(as, mais, config, config)
+EOPROT_HPP_VARIABLE(as, mais, config_mode, config.mode)
+EOPROT_HPP_VARIABLE(as, mais, config_datarate, config.datarate)
+EOPROT_HPP_VARIABLE(as, mais, config_resolution, config.resolution)
+EOPROT_HPP_VARIABLE(as, mais, status, status)
+EOPROT_HPP_VARIABLE(as, mais, status_the15values, status.the15values)
+EOPROT_HPP_ALLTAGS(as, mais)
+
+EOPROT_HPP_ENTITY(as, extorque, eoprot_endpoint_analogsensors, eOas_extorque_t)
+EOPROT_HPP_WHOLEITEM(as, extorque, wholeitem)
+EOPROT_HPP_VARIABLE(as, extorque, config, config)
+EOPROT_HPP_VARIABLE(as, extorque, inputs, inputs)
+EOPROT_HPP_ALLTAGS(as, extorque)
+
+EOPROT_HPP_ENTITY(as, inertial, eoprot_endpoint_analogsensors, eOas_inertial_t)
+EOPROT_HPP_WHOLEITEM(as, inertial, wholeitem)
+EOPROT_HPP_VARIABLE(as, inertial, config, config)
+EOPROT_HPP_VARIABLE(as, inertial, config_datarate, config.datarate)
+EOPROT_HPP_VARIABLE(as, inertial, config_enabled, config.enabled)
+EOPROT_HPP_VARIABLE(as, inertial, status, status)
+EOPROT_HPP_VARIABLE(as, inertial, cmmnds_enable, cmmnds.enable)
+EOPROT_HPP_ALLTAGS(as, inertial)
+EOPROT_HPP_ALLENTITIES(as, eoprot_endpoint_analogsensors)
+
+
+// - endpoint skin
+
+EOPROT_HPP_ENTITY(sk, skin, eoprot_endpoint_skin, eOsk_skin_t)
+EOPROT_HPP_WHOLEITEM(sk, skin, wholeitem)
+EOPROT_HPP_VARIABLE(sk, skin, config_sigmode, config.sigmode)
+EOPROT_HPP_VARIABLE(sk, skin, status_arrayofcandata, status.arrayofcandata)
+EOPROT_HPP_VARIABLE(sk, skin, cmmnds_boardscfg, cmmnds.boardscfg)
+EOPROT_HPP_VARIABLE(sk, skin, cmmnds_trianglescfg, cmmnds.trianglescfg)
+EOPROT_HPP_ALLTAGS(sk, skin)
+EOPROT_HPP_ALLENTITIES(sk, eoprot_endpoint_skin)
+
+#undef EOPROT_HPP_ENTITY
+#undef EOPROT_HPP_VARIABLE
+#undef EOPROT_HPP_WHOLEITEM
+#undef EOPROT_HPP_TAGBOUND
+#undef EOPROT_HPP_ALLTAGS
+#undef EOPROT_HPP_ALLENTITIES
+
+} // namespace eoprot
+
+    
+// - declaration of extern public variables, ...deprecated: better using use _get/_set instead ------------------------
+// empty-section
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+// empty-section
+
+
+/** @}            
+    end of group eo_EoProtocolHPP  
+ **/
+ 
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
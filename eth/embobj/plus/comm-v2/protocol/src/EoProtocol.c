@@ -57,6 +57,9 @@
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
+// the hot region of an entity is widened to 4 bytes, so that the hot and the cold parts of every entity keep the alignment of their fields
+#define EOPROT_HOTREGION_ALIGN          4
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
@@ -67,6 +70,10 @@ typedef struct
     const uint8_t*      numberofeachentity[eoprot_endpoints_numberof];   
     void*               ramofeachendpoint[eoprot_endpoints_numberof];   
     eObool_fp_uint32_t  isvarproxied_fn[eoprot_endpoints_numberof];        
+    eObool_fp_uint32_t  isvarhot_fn[eoprot_endpoints_numberof];
+    uint16_t            hotsizeofendpoint[eoprot_endpoints_numberof];                           // bytes at the start of the ram with the hot regions
+    uint16_t            hotoffset[eoprot_endpoints_numberof][eoprot_maxvalueof_entity+1];       // start of the hot region inside the entity 
+    uint16_t            hotsize[eoprot_endpoints_numberof][eoprot_maxvalueof_entity+1];         // size of the hot region: 0 means flat entity
 } eOprot_board_data_t;
 
 
@@ -77,6 +84,12 @@ typedef struct
 static uint16_t s_eoprot_endpoint_numberofvariables_get(eOprotBRD_t brd, eOprotEndpoint_t ep);
 static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi, eOprotEntity_t entity, eOprotIndex_t index);
 static uint16_t s_eoprot_brdid2ramoffset(eOprotBRD_t brd, uint8_t epi, eOprotID32_t id);
+static uint16_t s_eoprot_brdentityindex2ramparts(eOprotBRD_t brd, uint8_t epi, eOprotEntity_t entity, eOprotIndex_t index, uint16_t *hotbase);
+static uint16_t s_eoprot_entityindex2ramparts(eOprot_board_data_t *data, uint8_t epi, eOprotEntity_t entity, eOprotIndex_t index, uint16_t *hotbase, eOprotProgNumber_t *prognum);
+static uint16_t s_eoprot_ramparts2ramoffset(eOprot_board_data_t *data, uint8_t epi, eOprotEntity_t entity, uint16_t coldbase, uint16_t hotbase, uint16_t offset, uint16_t size);
+static void s_eoprot_hotregions_compute(eOprot_board_data_t *data, eOprotEndpoint_t ep);
+static eOresult_t s_eoprot_variable_ram_copy(eOprotBRD_t brd, eOprotID32_t id, void *value, eObool_t toram);
+static eOresult_t s_eoprot_entity_ram_copy(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, void *value, eObool_t toram);
 static eObool_t s_eoprot_entity_tag_is_valid(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag);
 
 static uint16_t s_eoprot_rom_get_offset(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag);
@@ -207,6 +220,30 @@ extern eOprotTag_t eoprot_ID2tag(eOprotID32_t id)
 }
 
 
+extern eObool_t eoprot_ID_isbulk(eOprotID32_t id)
+{
+    eOprotEndpoint_t ep = eoprot_ID2endpoint(id);
+    eOprotEntity_t entity = eoprot_ID2entity(id);
+    
+    if((eoprot_index_none != eoprot_ID2index(id)) || (eoprot_tag_none != eoprot_ID2tag(id)))
+    {
+        return(eobool_false);
+    }
+    
+    if(eoprot_endpoint_all == ep)
+    {   // all the endpoints imply all the entities
+        return((eoprot_entity_all == entity) ? (eobool_true) : (eobool_false));
+    }
+    
+    if(ep >= eoprot_endpoints_numberof)
+    {
+        return(eobool_false);
+    }
+    
+    return(((eoprot_entity_all == entity) || (entity < eoprot_ep_entities_numberof[eoprot_ep_ep2index(ep)])) ? (eobool_true) : (eobool_false));
+}
+
+
 extern const char* eoprot_EP2string(eOprotEndpoint_t ep)
 {
     if(ep < eoprot_endpoints_numberof)
@@ -474,6 +511,54 @@ extern eOresult_t eoprot_config_proxied_variables(eOprotBRD_t brd, eOprotEndpoin
     return(res);        
 }
 
+extern eOresult_t eoprot_config_endpoint_hotvariables(eOprotBRD_t brd, eOprotEndpoint_t ep, eObool_fp_uint32_t isvarhot_fn)
+{
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
+    uint8_t epi = 0;
+    
+    if(NULL == data)
+    {
+        return(eores_NOK_generic);
+    }
+
+    if(ep >= eoprot_endpoints_numberof)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    epi = eoprot_ep_ep2index(ep);
+    
+    if(NULL != data->ramofeachendpoint[epi])
+    {   // the layout cannot change while the ram is in use
+        return(eores_NOK_generic);
+    }
+    
+    data->isvarhot_fn[epi] = isvarhot_fn;    
+    
+    return(eores_OK);        
+}
+
+extern eObool_t eoprot_variable_ishot_default(uint32_t id)
+{
+    EOnv_rom_t* rom = s_eoprot_rom_get_nvrom(id);
+    uint8_t epi = 0;
+    
+    if(NULL == rom)
+    {
+        return(eobool_false);
+    }
+    
+    epi = eoprot_ep_ep2index(eoprot_ID2endpoint(id));
+    
+    // the read-only variables are those produced by the board at every cycle (status). we exclude the wholeitem.
+    if((eo_nv_rwmode_RO == rom->rwmode) && (rom->capacity < eoprot_ep_entities_sizeof[epi][eoprot_ID2entity(id)]))
+    {
+        return(eobool_true);
+    }
+    
+    return(eobool_false);
+}
+
 extern eObool_t eoprot_endpoint_configured_is(eOprotBRD_t brd, eOprotEndpoint_t ep)
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
@@ -1005,6 +1090,11 @@ extern eOresult_t eoprot_config_endpoint_ram(eOprotBRD_t brd, eOprotEndpoint_t e
     }
     
     epi = eoprot_ep_ep2index(ep);    
+    
+    if(NULL != ram)
+    {   // the offsets of the hot regions depend on the number of entities, thus we compute them now
+        s_eoprot_hotregions_compute(data, ep);
+    }
         
     data->ramofeachendpoint[epi] = ram;    
         
@@ -1116,6 +1206,64 @@ extern void* eoprot_variable_romof_get(eOprotBRD_t brd, eOprotID32_t id)
     return(s_eoprot_rom_get_nvrom(id));
 }
 
+extern eOresult_t eoprot_variable_descriptor_get(eOprotBRD_t brd, eOprotID32_t id, eOprot_variable_descriptor_t *des)
+{
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
+    eOprotEndpoint_t ep = eoprot_ID2endpoint(id);
+    eOprotEntity_t ent = eoprot_ID2entity(id);
+    eOprotIndex_t  ind = eoprot_ID2index(id);
+    eOprotTag_t    tag = eoprot_ID2tag(id);
+    const eOprot_ep_variable_t* var = NULL;
+    uint8_t* startofdata = NULL;
+    eObool_fp_uint32_t isproxied = NULL;
+    eOprotProgNumber_t prognum = 0;
+    uint16_t hotbase = 0;
+    uint16_t coldbase = 0;
+    uint16_t offset = 0;
+    uint8_t epi = 0;
+    
+    if(NULL == des)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // the same checks of eoprot_id_isvalid()
+    if((NULL == data) || (ep >= eoprot_endpoints_numberof))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    epi = eoprot_ep_ep2index(ep);
+    
+    if((ent >= eoprot_ep_entities_numberof[epi]) || (NULL == data->numberofeachentity[epi]))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if((ind >= data->numberofeachentity[epi][ent]) || (eobool_false == s_eoprot_entity_tag_is_valid(epi, ent, tag)))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    var = eoprot_ep_variable_get(epi, ent, tag);
+    
+    // a single loop on the entities gives the offsets in ram and the progressive number
+    coldbase = s_eoprot_entityindex2ramparts(data, epi, ent, ind, &hotbase, &prognum);
+    offset = s_eoprot_ramparts2ramoffset(data, epi, ent, coldbase, hotbase, var->offset, var->capacity);
+    startofdata = (uint8_t*)data->ramofeachendpoint[epi];
+    
+    des->ram        = ((NULL == startofdata) || (EOK_uint16dummy == offset)) ? (NULL) : (&startofdata[offset]);
+    des->rom        = var->rom;
+    des->size       = var->capacity;
+    isproxied       = data->isvarproxied_fn[epi];
+    des->proxied    = (NULL == isproxied) ? (eobool_false) : (isproxied(id));
+    des->filler     = 0;
+    des->prognum    = prognum + ind*eoprot_ep_tags_numberof[epi][ent] + s_eoprot_rom_get_prognum(id);
+    
+    return(eores_OK);
+}
+
+
 extern eObool_t eoprot_entity_configured_is(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity)
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
@@ -1182,6 +1330,50 @@ extern void* eoprot_entity_ramof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOpro
 }
 
 
+extern eOresult_t eoprot_entity_ram_write(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, const void *value)
+{
+    return(s_eoprot_entity_ram_copy(brd, ep, entity, index, (void*)value, eobool_true));
+}
+
+
+extern eOresult_t eoprot_entity_ram_read(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, void *value)
+{
+    return(s_eoprot_entity_ram_copy(brd, ep, entity, index, value, eobool_false));
+}
+
+
+extern eOresult_t eoprot_variable_ram_write(eOprotBRD_t brd, eOprotID32_t id, const void *value)
+{
+    return(s_eoprot_variable_ram_copy(brd, id, (void*)value, eobool_true));
+}
+
+
+extern eOresult_t eoprot_variable_ram_read(eOprotBRD_t brd, eOprotID32_t id, void *value)
+{
+    return(s_eoprot_variable_ram_copy(brd, id, value, eobool_false));
+}
+
+
+extern const void* eoprot_entity_defaultvalue_get(eOprotEndpoint_t ep, eOprotEntity_t entity)
+{
+    uint8_t epi = 0;
+    
+    if(ep >= eoprot_endpoints_numberof)
+    {
+        return(NULL);
+    }
+    
+    epi = eoprot_ep_ep2index(ep);
+    
+    if(entity >= eoprot_ep_entities_numberof[epi])
+    {
+        return(NULL);
+    }
+    
+    return(eoprot_ep_entities_defval[epi][entity]);
+}
+
+
 extern uint16_t eoprot_entity_sizeof_get(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity)
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
@@ -1457,8 +1649,24 @@ static uint16_t s_eoprot_endpoint_numberofvariables_get(eOprotBRD_t brd, eOprotE
 static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi, eOprotEntity_t entity, eOprotIndex_t index)
 {
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
-    uint16_t offset = 0;
-    uint8_t i = 0;
+    uint16_t hotbase = 0;
+    uint16_t coldbase = s_eoprot_brdentityindex2ramparts(brd, epi, entity, index, &hotbase);
+    
+    if(EOK_uint16dummy == coldbase)
+    {
+        return(EOK_uint16dummy);
+    }
+    
+    // the entity is contiguous only if it is all cold (as in the flat layout) or all hot
+    return(s_eoprot_ramparts2ramoffset(data, epi, entity, coldbase, hotbase, 0, eoprot_ep_entities_sizeof[epi][entity]));
+}    
+
+
+// returns the offset of the cold part of the entity (in the flat layout: of the entity) and in hotbase the offset of its hot part.
+// in the hot-cold layout the ram starts with the hot regions of all the entities, then it has what is left of the entities.
+static uint16_t s_eoprot_brdentityindex2ramparts(eOprotBRD_t brd, uint8_t epi, eOprotEntity_t entity, eOprotIndex_t index, uint16_t *hotbase)
+{
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     
     if(NULL == data)
     {
@@ -1480,37 +1688,248 @@ static uint16_t s_eoprot_brdentityindex2ramoffset(eOprotBRD_t brd, uint8_t epi,
         return(EOK_uint16dummy);
     }
         
+    return(s_eoprot_entityindex2ramparts(data, epi, entity, index, hotbase, NULL));
+}    
+
+
+// as s_eoprot_brdentityindex2ramparts() but without any check. if prognum is not NULL, it also returns the number of variables 
+// in the entities before the current one.
+static uint16_t s_eoprot_entityindex2ramparts(eOprot_board_data_t *data, uint8_t epi, eOprotEntity_t entity, eOprotIndex_t index, uint16_t *hotbase, eOprotProgNumber_t *prognum)
+{
+    uint16_t offset = data->hotsizeofendpoint[epi];
+    uint16_t hotoffset = 0;
+    eOprotProgNumber_t prog = 0;
+    uint8_t i = 0;
+    
     for(i=0; i<entity; i++)
-    {   // we sum the size of all the entities before the current one
-        offset += (data->numberofeachentity[epi][i] * eoprot_ep_entities_sizeof[epi][i]);
+    {   // we sum the size of all the entities before the current one. in the flat layout the hot sizes are all zero
+        hotoffset += (data->numberofeachentity[epi][i] * data->hotsize[epi][i]);
+        offset += (data->numberofeachentity[epi][i] * (eoprot_ep_entities_sizeof[epi][i] - data->hotsize[epi][i]));
+        prog += (eoprot_ep_tags_numberof[epi][i] * data->numberofeachentity[epi][i]);
     }
     // then we add the offset of the current entity
-    offset += (index*eoprot_ep_entities_sizeof[epi][entity]);
+    hotoffset += (index*data->hotsize[epi][entity]);
+    offset += (index*(eoprot_ep_entities_sizeof[epi][entity] - data->hotsize[epi][entity]));
+    
+    *hotbase = hotoffset;
+    if(NULL != prognum)
+    {
+        *prognum = prog;
+    }
 
     return(offset);
-}    
+}
+
+
+// returns the offset in ram of the bytes [offset, offset+size) of an entity or EOK_uint16dummy if they are split between its hot and cold parts
+static uint16_t s_eoprot_ramparts2ramoffset(eOprot_board_data_t *data, uint8_t epi, eOprotEntity_t entity, uint16_t coldbase, uint16_t hotbase, uint16_t offset, uint16_t size)
+{
+    uint16_t hotstart = data->hotoffset[epi][entity];
+    uint16_t hotend = hotstart + data->hotsize[epi][entity];
+    
+    if(0 == data->hotsize[epi][entity])
+    {   // flat entity
+        return(coldbase + offset);
+    }
+    else if((offset >= hotstart) && ((offset+size) <= hotend))
+    {
+        return(hotbase + (offset - hotstart));
+    }
+    else if((offset+size) <= hotstart)
+    {
+        return(coldbase + offset);
+    }
+    else if(offset >= hotend)
+    {
+        return(coldbase + (offset - data->hotsize[epi][entity]));
+    }
+    
+    return(EOK_uint16dummy);
+}
+
+
+static void s_eoprot_hotregions_compute(eOprot_board_data_t *data, eOprotEndpoint_t ep)
+{
+    uint8_t epi = eoprot_ep_ep2index(ep);
+    eObool_fp_uint32_t ishot = data->isvarhot_fn[epi];
+    uint8_t ent = 0;
+    uint8_t tag = 0;
+    
+    data->hotsizeofendpoint[epi] = 0;
+    memset(data->hotoffset[epi], 0, sizeof(data->hotoffset[epi]));
+    memset(data->hotsize[epi], 0, sizeof(data->hotsize[epi]));
+    
+    if((NULL == ishot) || (NULL == data->numberofeachentity[epi]))
+    {   // flat layout
+        return;
+    }
+    
+    for(ent=0; ent<eoprot_ep_entities_numberof[epi]; ent++)
+    {
+        uint16_t sizeofentity = eoprot_ep_entities_sizeof[epi][ent];
+        uint16_t start = sizeofentity;
+        uint16_t end = 0;
+        
+        // the hot region is the smallest range which contains all the hot variables of the entity
+        for(tag=0; tag<eoprot_ep_tags_numberof[epi][ent]; tag++)
+        {
+            if(eobool_true == ishot(eoprot_ID_get(ep, ent, 0, tag)))
+            {
+                uint16_t off = eoprot_ep_variable_get(epi, ent, tag)->offset;
+                uint16_t cap = eoprot_ep_variable_get(epi, ent, tag)->capacity;
+                start = (off < start) ? (off) : (start);
+                end = ((off+cap) > end) ? (off+cap) : (end);
+            }
+        }
+        
+        if(end > start)
+        {   // a variable which crosses the boundary of the hot region is taken inside it, so that every variable apart from the 
+            // wholeitem stays contiguous. we repeat until no variable crosses it: at most the region becomes the whole entity
+            eObool_t grown = eobool_true;
+            while(eobool_true == grown)
+            {
+                grown = eobool_false;
+                start = start & ~(EOPROT_HOTREGION_ALIGN-1);
+                end = (end + EOPROT_HOTREGION_ALIGN - 1) & ~(EOPROT_HOTREGION_ALIGN-1);
+                end = (end > sizeofentity) ? (sizeofentity) : (end);
+                for(tag=0; tag<eoprot_ep_tags_numberof[epi][ent]; tag++)
+                {
+                    uint16_t off = eoprot_ep_variable_get(epi, ent, tag)->offset;
+                    uint16_t cap = eoprot_ep_variable_get(epi, ent, tag)->capacity;
+                    if(cap >= sizeofentity)
+                    {   // the wholeitem: it is gathered and scattered by s_eoprot_variable_ram_copy()
+                        continue;
+                    }
+                    if((off < end) && ((off+cap) > start) && ((off < start) || ((off+cap) > end)))
+                    {
+                        start = (off < start) ? (off) : (start);
+                        end = ((off+cap) > end) ? (off+cap) : (end);
+                        grown = eobool_true;
+                    }
+                }
+            }
+            data->hotoffset[epi][ent] = start;
+            data->hotsize[epi][ent] = end - start;
+            data->hotsizeofendpoint[epi] += data->numberofeachentity[epi][ent] * (end - start);
+        }
+    }
+}
+
+
+static eOresult_t s_eoprot_entity_ram_copy(eOprotBRD_t brd, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotIndex_t index, void *value, eObool_t toram)
+{
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
+    uint8_t epi = 0;
+    uint8_t *startofdata = NULL;
+    uint8_t *flat = (uint8_t*)value;
+    uint16_t coldbase = 0;
+    uint16_t hotbase = 0;
+    uint16_t hotstart = 0;
+    uint16_t hotsize = 0;
+    uint16_t sizeofentity = 0;
+    
+    if((NULL == data) || (NULL == value) || (ep >= eoprot_endpoints_numberof))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    epi = eoprot_ep_ep2index(ep);
+    startofdata = (uint8_t*)data->ramofeachendpoint[epi];
+    if(NULL == startofdata)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    coldbase = s_eoprot_brdentityindex2ramparts(brd, epi, entity, index, &hotbase);
+    if(EOK_uint16dummy == coldbase)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    sizeofentity = eoprot_ep_entities_sizeof[epi][entity];
+    hotstart = data->hotoffset[epi][entity];
+    hotsize = data->hotsize[epi][entity];
+    
+    // the entity is made of: cold bytes [0, hotstart), hot bytes [hotstart, hotstart+hotsize), cold bytes [hotstart+hotsize, sizeofentity)
+    if(eobool_true == toram)
+    {
+        memcpy(&startofdata[coldbase], flat, hotstart);
+        memcpy(&startofdata[hotbase], &flat[hotstart], hotsize);
+        memcpy(&startofdata[coldbase+hotstart], &flat[hotstart+hotsize], sizeofentity-hotstart-hotsize);
+    }
+    else
+    {
+        memcpy(flat, &startofdata[coldbase], hotstart);
+        memcpy(&flat[hotstart], &startofdata[hotbase], hotsize);
+        memcpy(&flat[hotstart+hotsize], &startofdata[coldbase+hotstart], sizeofentity-hotstart-hotsize);
+    }
+    
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eoprot_variable_ram_copy(eOprotBRD_t brd, eOprotID32_t id, void *value, eObool_t toram)
+{
+    eOprotEndpoint_t ep = eoprot_ID2endpoint(id);
+    eOprotEntity_t entity = eoprot_ID2entity(id);
+    uint16_t size = 0;
+    uint8_t *ram = NULL;
+    
+    if((NULL == value) || (eobool_false == eoprot_id_isvalid(brd, id)))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    size = eoprot_variable_sizeof_get(brd, id);
+    ram = (uint8_t*)eoprot_variable_ramof_get(brd, id);
+    
+    if(NULL != ram)
+    {
+        if(eobool_true == toram)
+        {
+            memcpy(ram, value, size);
+        }
+        else
+        {
+            memcpy(value, ram, size);
+        }
+        return(eores_OK);
+    }
+    
+    // s_eoprot_hotregions_compute() keeps contiguous every variable but the wholeitem, which we gather or scatter
+    if(size != eoprot_ep_entities_sizeof[eoprot_ep_ep2index(ep)][entity])
+    {   // the ram is not configured
+        return(eores_NOK_generic);
+    }
+    
+    return(s_eoprot_entity_ram_copy(brd, ep, entity, eoprot_ID2index(id), value, toram));
+}
 
 
 static uint16_t s_eoprot_brdid2ramoffset(eOprotBRD_t brd, uint8_t epi, eOprotID32_t id)
 {
-    //eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
+    eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
     eOprotEntity_t entity = eoprot_ID2entity(id);
     eOprotIndex_t index = eoprot_ID2index(id);
     eOprotTag_t tag = eoprot_ID2tag(id);
+    uint16_t hotbase = 0;
     
     // we compute the offset of the entity. the validity of the brd is verified inside the following function
-    uint16_t offset = s_eoprot_brdentityindex2ramoffset(brd, epi, entity, index);
+    uint16_t coldbase = s_eoprot_brdentityindex2ramparts(brd, epi, entity, index, &hotbase);
        
-    if(EOK_uint16dummy == offset)
+    if(EOK_uint16dummy == coldbase)
     {
         return(EOK_uint16dummy);
     }
     
-    // then we add the offset of the tag
+    if(tag >= eoprot_ep_tags_numberof[epi][entity])
+    {
+        return(EOK_uint16dummy);
+    }
+    
+    // then we add the offset of the tag, which is inside the hot or the cold part of the entity
     //offset += (eoprot_ep_romif[epi]->get_offset(entity, tag)); 
-    offset += s_eoprot_rom_get_offset(epi, entity, tag); 
-
-    return(offset);
+    return(s_eoprot_ramparts2ramoffset(data, epi, entity, coldbase, hotbase, s_eoprot_rom_get_offset(epi, entity, tag), eoprot_ep_variable_get(epi, entity, tag)->capacity));
 } 
 
 
@@ -1522,26 +1941,8 @@ static eObool_t s_eoprot_entity_tag_is_valid(uint8_t epi, eOprotEntity_t entity,
 
 // returns the offset of the variable with a given tag from the start of the entity
 static uint16_t s_eoprot_rom_entity_offset_of_tag(uint8_t epi, uint8_t ent, eOprotTag_t tag)
-{
-    uint32_t i, tag_aux = 0;
-    uint8_t *one = NULL;
-    uint8_t *two = NULL;
-    int res = 0;
-
-    tag_aux = 0;
-    for(i=0; i<ent; i++)
-    {
-        tag_aux += eoprot_ep_tags_numberof[epi][i];
-    }
-    // one contains the address of the default value of the entire entity (eg: &MYdefentity = 0x08001200).
-    one = (uint8_t*) eoprot_ep_entities_defval[epi][ent];
-    // two contains the address of the default value of the variable, but inside the default value of the entire entity (eg: &MYdefentity.var = 0x08001220)  
-    two = (uint8_t*) eoprot_ep_descriptors[epi][ent][tag]->resetval;
-    // if we want to know how many bytes they are fare aways we simply cast them to pointers of 1 byte and make the difference.
-    // the C standard assures that the result is an integer containing the distance between the pointers expressed in object pointed. in our case 1 byte.
-    res = two - one;
-    // and now we cast result to 16 bits because we dont have big entities.
-    return((uint16_t)res); 
+{   // the offset is computed at compile time by offsetof() inside the flat table of the endpoint
+    return(eoprot_ep_variable_get(epi, ent, tag)->offset); 
 }
 
 static uint16_t s_eoprot_rom_get_offset(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag)
@@ -1579,7 +1980,7 @@ static void* s_eoprot_rom_get_nvrom(eOprotID32_t id)
         return(NULL);
     }        
     
-    return((void*)eoprot_ep_descriptors[epindex][entity][tag]);  
+    return((void*)eoprot_ep_variable_get(epindex, entity, tag)->rom);  
 }
 
 
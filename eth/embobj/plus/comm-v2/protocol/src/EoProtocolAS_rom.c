@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -455,53 +456,201 @@ const eoprot_version_t eoprot_as_version =
 };
 
 
-// -- collector of eonv descriptors for the endpoint
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_as_rom_strain_descriptors[] =
-{   // here are eoprot_tags_as_strain_numberof descriptors for the strain entity
-    &eoprot_as_rom_descriptor_strain_wholeitem,
-    &eoprot_as_rom_descriptor_strain_config,
-    &eoprot_as_rom_descriptor_strain_status,
-    &eoprot_as_rom_descriptor_strain_status_fullscale,
-    &eoprot_as_rom_descriptor_strain_status_calibratedvalues,
-    &eoprot_as_rom_descriptor_strain_status_uncalibratedvalues
-};  EO_VERIFYsizeof(s_eoprot_as_rom_strain_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_as_strain_numberof));
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_as_rom_mais_descriptors[] =
-{   // here are eoprot_tags_as_mais_numberof descriptors for the strain entity
-    &eoprot_as_rom_descriptor_mais_wholeitem,
-    &eoprot_as_rom_descriptor_mais_config,
-    &eoprot_as_rom_descriptor_mais_config_mode,
-    &eoprot_as_rom_descriptor_mais_config_datarate,
-    &eoprot_as_rom_descriptor_mais_config_resolution,
-    &eoprot_as_rom_descriptor_mais_status,
-    &eoprot_as_rom_descriptor_mais_status_the15values
-};  EO_VERIFYsizeof(s_eoprot_as_rom_mais_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_as_mais_numberof));
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_as_rom_extorque_descriptors[] =
-{   // here are eoprot_tags_as_extorque_numberof descriptors for the strain entity
-    &eoprot_as_rom_descriptor_extorque_wholeitem,
-    &eoprot_as_rom_descriptor_extorque_config,    
-    &eoprot_as_rom_descriptor_extorque_inputs
-};  EO_VERIFYsizeof(s_eoprot_as_rom_extorque_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_as_extorque_numberof));
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_as_rom_inertial_descriptors[] =
-{   // here are eoprot_tags_as_inertial_numberof descriptors for the inertial entity
-    &eoprot_as_rom_descriptor_inertial_wholeitem,
-    &eoprot_as_rom_descriptor_inertial_config,
-    &eoprot_as_rom_descriptor_inertial_config_datarate,
-    &eoprot_as_rom_descriptor_inertial_config_enabled,
-    &eoprot_as_rom_descriptor_inertial_status,
-    &eoprot_as_rom_descriptor_inertial_cmmnds_enable
-};  EO_VERIFYsizeof(s_eoprot_as_rom_inertial_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_as_inertial_numberof));
-
-EOPROT_ROMmap EOnv_rom_t * const * const eoprot_as_rom_descriptors[] = 
-{
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_as_rom_strain_descriptors,
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_as_rom_mais_descriptors,   
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_as_rom_extorque_descriptors, 
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_as_rom_inertial_descriptors
-};  EO_VERIFYsizeof(eoprot_as_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_as_numberof));
+// -- the variables of the endpoint in a flat table
+
+// - begin of code generated by EoProtocolTables.cmake: do not edit
+
+const eOprot_ep_variable_t eoprot_as_rom_variables[] =
+{   // eoprot_entities_as_numberof x eoprot_as_rom_tags_stride items: position is entity*stride+tag
+    // strain
+    {   // strain_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_strain_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_as_strain_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_strain_defaultvalue,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_strain_wholeitem
+    },
+    {   // strain_config
+        EO_INIT(.offset)    offsetof(eOas_strain_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_strain_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_as_strain_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_strain_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_strain_config
+    },
+    {   // strain_status
+        EO_INIT(.offset)    offsetof(eOas_strain_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_strain_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_as_strain_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_strain_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_strain_status
+    },
+    {   // strain_status_fullscale
+        EO_INIT(.offset)    offsetof(eOas_strain_t, status.fullscale),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_strain_defaultvalue.status.fullscale),
+        EO_INIT(.rwmode)    eoprot_rwm_as_strain_status_fullscale,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_strain_defaultvalue.status.fullscale,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_strain_status_fullscale
+    },
+    {   // strain_status_calibratedvalues
+        EO_INIT(.offset)    offsetof(eOas_strain_t, status.calibratedvalues),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_strain_defaultvalue.status.calibratedvalues),
+        EO_INIT(.rwmode)    eoprot_rwm_as_strain_status_calibratedvalues,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_strain_defaultvalue.status.calibratedvalues,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_strain_status_calibratedvalues
+    },
+    {   // strain_status_uncalibratedvalues
+        EO_INIT(.offset)    offsetof(eOas_strain_t, status.uncalibratedvalues),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_strain_defaultvalue.status.uncalibratedvalues),
+        EO_INIT(.rwmode)    eoprot_rwm_as_strain_status_uncalibratedvalues,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_strain_defaultvalue.status.uncalibratedvalues,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_strain_status_uncalibratedvalues
+    },
+    {   0 },
+    // mais
+    {   // mais_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_mais_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_as_mais_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_mais_defaultvalue,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_mais_wholeitem
+    },
+    {   // mais_config
+        EO_INIT(.offset)    offsetof(eOas_mais_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_mais_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_as_mais_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_mais_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_mais_config
+    },
+    {   // mais_config_mode
+        EO_INIT(.offset)    offsetof(eOas_mais_t, config.mode),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_mais_defaultvalue.config.mode),
+        EO_INIT(.rwmode)    eoprot_rwm_as_mais_config_mode,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_mais_defaultvalue.config.mode,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_mais_config_mode
+    },
+    {   // mais_config_datarate
+        EO_INIT(.offset)    offsetof(eOas_mais_t, config.datarate),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_mais_defaultvalue.config.datarate),
+        EO_INIT(.rwmode)    eoprot_rwm_as_mais_config_datarate,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_mais_defaultvalue.config.datarate,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_mais_config_datarate
+    },
+    {   // mais_config_resolution
+        EO_INIT(.offset)    offsetof(eOas_mais_t, config.resolution),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_mais_defaultvalue.config.resolution),
+        EO_INIT(.rwmode)    eoprot_rwm_as_mais_config_resolution,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_mais_defaultvalue.config.resolution,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_mais_config_resolution
+    },
+    {   // mais_status
+        EO_INIT(.offset)    offsetof(eOas_mais_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_mais_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_as_mais_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_mais_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_mais_status
+    },
+    {   // mais_status_the15values
+        EO_INIT(.offset)    offsetof(eOas_mais_t, status.the15values),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_mais_defaultvalue.status.the15values),
+        EO_INIT(.rwmode)    eoprot_rwm_as_mais_status_the15values,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_mais_defaultvalue.status.the15values,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_mais_status_the15values
+    },
+    // extorque
+    {   // extorque_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_extorque_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_as_extorque_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_extorque_defaultvalue,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_extorque_wholeitem
+    },
+    {   // extorque_config
+        EO_INIT(.offset)    offsetof(eOas_extorque_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_extorque_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_as_extorque_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_extorque_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_extorque_config
+    },
+    {   // extorque_inputs
+        EO_INIT(.offset)    offsetof(eOas_extorque_t, inputs),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_extorque_defaultvalue.inputs),
+        EO_INIT(.rwmode)    eoprot_rwm_as_extorque_inputs,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_extorque_defaultvalue.inputs,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_extorque_inputs
+    },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    // inertial
+    {   // inertial_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_inertial_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_as_inertial_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_inertial_defaultvalue,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_inertial_wholeitem
+    },
+    {   // inertial_config
+        EO_INIT(.offset)    offsetof(eOas_inertial_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_inertial_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_as_inertial_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_inertial_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_inertial_config
+    },
+    {   // inertial_config_datarate
+        EO_INIT(.offset)    offsetof(eOas_inertial_t, config.datarate),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_inertial_defaultvalue.config.datarate),
+        EO_INIT(.rwmode)    eoprot_rwm_as_inertial_config_datarate,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_inertial_defaultvalue.config.datarate,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_inertial_config_datarate
+    },
+    {   // inertial_config_enabled
+        EO_INIT(.offset)    offsetof(eOas_inertial_t, config.enabled),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_inertial_defaultvalue.config.enabled),
+        EO_INIT(.rwmode)    eoprot_rwm_as_inertial_config_enabled,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_inertial_defaultvalue.config.enabled,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_inertial_config_enabled
+    },
+    {   // inertial_status
+        EO_INIT(.offset)    offsetof(eOas_inertial_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_inertial_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_as_inertial_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_inertial_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_inertial_status
+    },
+    {   // inertial_cmmnds_enable
+        EO_INIT(.offset)    offsetof(eOas_inertial_t, cmmnds.enable),
+        EO_INIT(.capacity)  sizeof(eoprot_as_rom_inertial_defaultvalue.cmmnds.enable),
+        EO_INIT(.rwmode)    eoprot_rwm_as_inertial_cmmnds_enable,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_as_rom_inertial_defaultvalue.cmmnds.enable,
+        EO_INIT(.rom)       &eoprot_as_rom_descriptor_inertial_cmmnds_enable
+    },
+    {   0 },
+};  EO_VERIFYsizeof(eoprot_as_rom_variables, sizeof(eOprot_ep_variable_t)*eoprot_entities_as_numberof*eoprot_as_rom_tags_stride);
+
+// - end of code generated by EoProtocolTables.cmake
 
 
 // the other constants: to be changed when a new entity is added
@@ -112,13 +112,21 @@ eOvoid_fp_cnvp_cropdesp_t eoprot_ep_onsay[] =
 };  EO_VERIFYsizeof(eoprot_ep_onsay, eoprot_endpoints_numberof*sizeof(eOvoid_fp_cnvp_cropdesp_t)); 
 
 
-EOPROT_ROMmap EOnv_rom_t * const * const * const eoprot_ep_descriptors[] = 
+const eOprot_ep_variable_t * const eoprot_ep_variables[] = 
 {   // very important: use order of eOprot_endpoint_t: pos 0 is eoprot_endpoint_management etc.
-    eoprot_mn_rom_descriptors,
-    eoprot_mc_rom_descriptors,
-    eoprot_as_rom_descriptors,
-    eoprot_sk_rom_descriptors
-};  EO_VERIFYsizeof(eoprot_ep_descriptors, eoprot_endpoints_numberof*sizeof(EOPROT_ROMmap EOnv_rom_t * const * const *)); 
+    eoprot_mn_rom_variables,
+    eoprot_mc_rom_variables,
+    eoprot_as_rom_variables,
+    eoprot_sk_rom_variables
+};  EO_VERIFYsizeof(eoprot_ep_variables, eoprot_endpoints_numberof*sizeof(const eOprot_ep_variable_t *)); 
+
+const uint8_t eoprot_ep_tags_stride[] =
+{   // very important: use order of eOprot_endpoint_t: pos 0 is eoprot_endpoint_management etc.
+    eoprot_mn_rom_tags_stride,
+    eoprot_mc_rom_tags_stride,
+    eoprot_as_rom_tags_stride,
+    eoprot_sk_rom_tags_stride
+};  EO_VERIFYsizeof(eoprot_ep_tags_stride, eoprot_endpoints_numberof*sizeof(uint8_t)); 
 
 const uint16_t* const eoprot_ep_entities_sizeof[] =
 {   // very important: use order of eOprot_endpoint_t: pos 0 is eoprot_endpoint_management etc.
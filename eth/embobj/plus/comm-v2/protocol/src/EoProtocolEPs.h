@@ -54,13 +54,29 @@
 
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
-// empty-section
+
+/** @typedef    typedef struct eOprot_ep_variable_t
+    @brief      It is the item of the flat table of variables of an endpoint, which is generated by EoProtocolTables.cmake.
+                The variable of tag tag inside entity ent is at position ent*stride+tag, the items which pad an entity with
+                less tags than the stride are all zero. The offset and the capacity are those inside the entity, the 
+                init and update functions stay inside the rom because they can be overridden in runtime.
+ **/
+typedef struct
+{
+    uint16_t                    offset;         /**< the offset of the variable inside the ram of its entity */
+    uint16_t                    capacity;       /**< the size of the variable */
+    eOenum08_t                  rwmode;         /**< the eOprot_rwm_t of the variable */
+    uint8_t                     filler[3];
+    const void*                 resetval;       /**< the default value of the variable */
+    EOPROT_ROMmap EOnv_rom_t*   rom;            /**< the descriptor of the variable */
+} eOprot_ep_variable_t;
 
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
 
-extern EOPROT_ROMmap EOnv_rom_t * const * const * const eoprot_ep_descriptors[];
+extern const eOprot_ep_variable_t * const eoprot_ep_variables[];     // eoprot_endpoints_numberof
+extern const uint8_t eoprot_ep_tags_stride[];                       // eoprot_endpoints_numberof
     
 extern eOvoid_fp_cnvp_cropdesp_t eoprot_ep_onsay[];                 // eoprot_endpoints_numberof
 extern const eoprot_version_t * const eoprot_endpoint_version[];    // eoprot_endpoints_numberof
@@ -92,6 +108,11 @@ EO_extern_inline eOprotEndpoint_t eoprot_ep_index2ep(uint8_t index)
     return(index);
 }
 
+EO_extern_inline const eOprot_ep_variable_t * eoprot_ep_variable_get(uint8_t epi, uint8_t ent, uint8_t tag)
+{   // dont use control on epi, ent, tag ... use sensibly !
+    return(&eoprot_ep_variables[epi][(uint16_t)ent*eoprot_ep_tags_stride[epi] + tag]);
+}
+
 /** @}            
     end of group eo_EoProtocolEPs  
  **/
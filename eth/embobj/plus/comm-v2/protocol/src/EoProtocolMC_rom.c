@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -682,64 +683,339 @@ const eoprot_version_t eoprot_mc_version =
 };
 
 
-// -- collector of eonv descriptors for the endpoint
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_mc_rom_joint_descriptors[] =
-{   // here are eoprot_tags_mc_joint_numberof descriptors for the joint entity
-    &eoprot_mc_rom_descriptor_joint_wholeitem,
-    &eoprot_mc_rom_descriptor_joint_config,
-    &eoprot_mc_rom_descriptor_joint_config_pidposition,
-    &eoprot_mc_rom_descriptor_joint_config_pidvelocity,
-    &eoprot_mc_rom_descriptor_joint_config_pidtorque,
-    &eoprot_mc_rom_descriptor_joint_config_limitsofjoint,
-    &eoprot_mc_rom_descriptor_joint_config_impedance,
-    &eoprot_mc_rom_descriptor_joint_config_motor_params,
-    &eoprot_mc_rom_descriptor_joint_config_tcfiltertype,
-    &eoprot_mc_rom_descriptor_joint_status,
-    &eoprot_mc_rom_descriptor_joint_status_core,
-    &eoprot_mc_rom_descriptor_joint_status_target,
-    &eoprot_mc_rom_descriptor_joint_status_core_modes_controlmodestatus,
-    &eoprot_mc_rom_descriptor_joint_status_core_modes_interactionmodestatus,
-    &eoprot_mc_rom_descriptor_joint_status_core_modes_ismotiondone,
-    &eoprot_mc_rom_descriptor_joint_status_addinfo_multienc,
-    &eoprot_mc_rom_descriptor_joint_inputs,
-    &eoprot_mc_rom_descriptor_joint_inputs_externallymeasuredtorque,
-    &eoprot_mc_rom_descriptor_joint_cmmnds_calibration,
-    &eoprot_mc_rom_descriptor_joint_cmmnds_setpoint,
-    &eoprot_mc_rom_descriptor_joint_cmmnds_stoptrajectory,
-    &eoprot_mc_rom_descriptor_joint_cmmnds_controlmode,
-    &eoprot_mc_rom_descriptor_joint_cmmnds_interactionmode  
-};  EO_VERIFYsizeof(s_eoprot_mc_rom_joint_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_mc_joint_numberof));
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_mc_rom_motor_descriptors[] =
-{   // here are eoprot_tags_mc_motor_numberof descriptors for the motor entity
-    &eoprot_mc_rom_descriptor_motor_wholeitem,
-    &eoprot_mc_rom_descriptor_motor_config,
-    &eoprot_mc_rom_descriptor_motor_config_currentlimits,
-    &eoprot_mc_rom_descriptor_motor_config_gearboxratio,
-    &eoprot_mc_rom_descriptor_motor_config_rotorencoder,
-    &eoprot_mc_rom_descriptor_motor_config_pwmlimit,
-    &eoprot_mc_rom_descriptor_motor_config_temperaturelimit,
-    &eoprot_mc_rom_descriptor_motor_status,
-    &eoprot_mc_rom_descriptor_motor_status_basic   
-};  EO_VERIFYsizeof(s_eoprot_mc_rom_motor_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_mc_motor_numberof));
-
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_mc_rom_controller_descriptors[] =
-{   // here are eoprot_tags_mc_controller_numberof descriptors for the controller entity
-    &eoprot_mc_rom_descriptor_controller_wholeitem,
-    &eoprot_mc_rom_descriptor_controller_config,
-    &eoprot_mc_rom_descriptor_controller_config_jointcoupling,
-    &eoprot_mc_rom_descriptor_controller_status
-};  EO_VERIFYsizeof(s_eoprot_mc_rom_controller_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_mc_controller_numberof));
-
-
-EOPROT_ROMmap EOnv_rom_t * const * const eoprot_mc_rom_descriptors[] = 
-{
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mc_rom_joint_descriptors,
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mc_rom_motor_descriptors,   
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mc_rom_controller_descriptors, 
-};  EO_VERIFYsizeof(eoprot_mc_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_mc_numberof));
+// -- the variables of the endpoint in a flat table
+
+// - begin of code generated by EoProtocolTables.cmake: do not edit
+
+const eOprot_ep_variable_t eoprot_mc_rom_variables[] =
+{   // eoprot_entities_mc_numberof x eoprot_mc_rom_tags_stride items: position is entity*stride+tag
+    // joint
+    {   // joint_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_wholeitem
+    },
+    {   // joint_config
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config
+    },
+    {   // joint_config_pidposition
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config.pidposition),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config.pidposition),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config_pidposition,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config.pidposition,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config_pidposition
+    },
+    {   // joint_config_pidvelocity
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config.pidvelocity),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config.pidvelocity),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config_pidvelocity,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config.pidvelocity,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config_pidvelocity
+    },
+    {   // joint_config_pidtorque
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config.pidtorque),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config.pidtorque),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config_pidtorque,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config.pidtorque,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config_pidtorque
+    },
+    {   // joint_config_limitsofjoint
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config.limitsofjoint),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config.limitsofjoint),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config_limitsofjoint,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config.limitsofjoint,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config_limitsofjoint
+    },
+    {   // joint_config_impedance
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config.impedance),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config.impedance),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config_impedance,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config.impedance,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config_impedance
+    },
+    {   // joint_config_motor_params
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config.motor_params),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config.motor_params),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config_motor_params,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config.motor_params,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config_motor_params
+    },
+    {   // joint_config_tcfiltertype
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, config.tcfiltertype),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.config.tcfiltertype),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_config_tcfiltertype,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.config.tcfiltertype,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_config_tcfiltertype
+    },
+    {   // joint_status
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_status
+    },
+    {   // joint_status_core
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, status.core),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.status.core),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_status_core,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.status.core,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_status_core
+    },
+    {   // joint_status_target
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, status.target),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.status.target),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_status_target,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.status.target,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_status_target
+    },
+    {   // joint_status_core_modes_controlmodestatus
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, status.core.modes.controlmodestatus),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.status.core.modes.controlmodestatus),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_status_core_modes_controlmodestatus,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.status.core.modes.controlmodestatus,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_status_core_modes_controlmodestatus
+    },
+    {   // joint_status_core_modes_interactionmodestatus
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, status.core.modes.interactionmodestatus),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.status.core.modes.interactionmodestatus),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_status_core_modes_interactionmodestatus,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.status.core.modes.interactionmodestatus,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_status_core_modes_interactionmodestatus
+    },
+    {   // joint_status_core_modes_ismotiondone
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, status.core.modes.ismotiondone),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.status.core.modes.ismotiondone),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_status_core_modes_ismotiondone,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.status.core.modes.ismotiondone,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_status_core_modes_ismotiondone
+    },
+    {   // joint_status_addinfo_multienc
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, status.addinfo.multienc),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.status.addinfo.multienc),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_status_addinfo_multienc,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.status.addinfo.multienc,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_status_addinfo_multienc
+    },
+    {   // joint_inputs
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, inputs),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.inputs),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_inputs,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.inputs,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_inputs
+    },
+    {   // joint_inputs_externallymeasuredtorque
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, inputs.externallymeasuredtorque),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.inputs.externallymeasuredtorque),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_inputs_externallymeasuredtorque,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.inputs.externallymeasuredtorque,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_inputs_externallymeasuredtorque
+    },
+    {   // joint_cmmnds_calibration
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, cmmnds.calibration),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.cmmnds.calibration),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_cmmnds_calibration,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.cmmnds.calibration,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_cmmnds_calibration
+    },
+    {   // joint_cmmnds_setpoint
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, cmmnds.setpoint),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.cmmnds.setpoint),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_cmmnds_setpoint,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.cmmnds.setpoint,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_cmmnds_setpoint
+    },
+    {   // joint_cmmnds_stoptrajectory
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, cmmnds.stoptrajectory),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.cmmnds.stoptrajectory),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_cmmnds_stoptrajectory,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.cmmnds.stoptrajectory,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_cmmnds_stoptrajectory
+    },
+    {   // joint_cmmnds_controlmode
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, cmmnds.controlmode),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.cmmnds.controlmode),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_cmmnds_controlmode,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.cmmnds.controlmode,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_cmmnds_controlmode
+    },
+    {   // joint_cmmnds_interactionmode
+        EO_INIT(.offset)    offsetof(eOmc_joint_t, cmmnds.interactionmode),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_joint_defaultvalue.cmmnds.interactionmode),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_joint_cmmnds_interactionmode,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_joint_defaultvalue.cmmnds.interactionmode,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_joint_cmmnds_interactionmode
+    },
+    // motor
+    {   // motor_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_wholeitem
+    },
+    {   // motor_config
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_config
+    },
+    {   // motor_config_currentlimits
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, config.currentLimits),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.config.currentLimits),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_config_currentlimits,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.config.currentLimits,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_config_currentlimits
+    },
+    {   // motor_config_gearboxratio
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, config.gearboxratio),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.config.gearboxratio),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_config_gearboxratio,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.config.gearboxratio,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_config_gearboxratio
+    },
+    {   // motor_config_rotorencoder
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, config.rotorEncoderResolution),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.config.rotorEncoderResolution),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_config_rotorencoder,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.config.rotorEncoderResolution,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_config_rotorencoder
+    },
+    {   // motor_config_pwmlimit
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, config.pwmLimit),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.config.pwmLimit),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_config_pwmlimit,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.config.pwmLimit,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_config_pwmlimit
+    },
+    {   // motor_config_temperaturelimit
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, config.temperatureLimit),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.config.temperatureLimit),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_config_temperaturelimit,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.config.temperatureLimit,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_config_temperaturelimit
+    },
+    {   // motor_status
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_status
+    },
+    {   // motor_status_basic
+        EO_INIT(.offset)    offsetof(eOmc_motor_t, status.basic),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_motor_defaultvalue.status.basic),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_motor_status_basic,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_motor_defaultvalue.status.basic,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_motor_status_basic
+    },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    // controller
+    {   // controller_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_controller_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_controller_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_controller_defaultvalue,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_controller_wholeitem
+    },
+    {   // controller_config
+        EO_INIT(.offset)    offsetof(eOmc_controller_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_controller_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_controller_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_controller_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_controller_config
+    },
+    {   // controller_config_jointcoupling
+        EO_INIT(.offset)    offsetof(eOmc_controller_t, config.jointcoupling),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_controller_defaultvalue.config.jointcoupling),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_controller_config_jointcoupling,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_controller_defaultvalue.config.jointcoupling,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_controller_config_jointcoupling
+    },
+    {   // controller_status
+        EO_INIT(.offset)    offsetof(eOmc_controller_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_mc_rom_controller_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_mc_controller_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mc_rom_controller_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_mc_rom_descriptor_controller_status
+    },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+};  EO_VERIFYsizeof(eoprot_mc_rom_variables, sizeof(eOprot_ep_variable_t)*eoprot_entities_mc_numberof*eoprot_mc_rom_tags_stride);
+
+// - end of code generated by EoProtocolTables.cmake
 
 
 
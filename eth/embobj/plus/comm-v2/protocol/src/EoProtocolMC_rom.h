@@ -47,7 +47,9 @@
 #include "EOnv_hid.h"
 
 // - public #define  --------------------------------------------------------------------------------------------------
-// empty-section
+// - begin of code generated by EoProtocolTables.cmake: do not edit
+enum { eoprot_mc_rom_tags_stride = 23 };   // the max number of tags of the entities
+// - end of code generated by EoProtocolTables.cmake
 
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
@@ -59,7 +61,7 @@
 extern const eoprot_version_t eoprot_mc_version;
 
 // in the following arrays we dont put the size inside brackets [] so that EO_VERIFYsizeof() can alert about a change
-extern EOPROT_ROMmap EOnv_rom_t * const * const eoprot_mc_rom_descriptors[];   // size: eoprot_entities_mc_numberof
+extern const eOprot_ep_variable_t eoprot_mc_rom_variables[];            // size: eoprot_entities_mc_numberof*eoprot_mc_rom_tags_stride
 extern const uint8_t eoprot_mc_rom_tags_numberof[];                     // size: eoprot_entities_mc_numberof
 extern const uint16_t eoprot_mc_rom_entities_sizeof[];                  // size: eoprot_entities_mc_numberof
 extern const void* const eoprot_mc_rom_entities_defval[];               // size: eoprot_entities_mc_numberof
@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -449,55 +450,198 @@ const eOprot_EPcfg_t eoprot_mn_basicEPcfg =
     EO_INIT(.numberofentities)  {1, 1, 1, 1, 0, 0, 0}
 };    
 
-// -- collector of eonv descriptors for the endpoint
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_mn_rom_comm_descriptors[] =
-{   // here are eoprot_mn_tags_comm_numberof descriptors for the comm entity
-    &eoprot_mn_rom_descriptor_comm_wholeitem,
-    &eoprot_mn_rom_descriptor_comm_status,
-    &eoprot_mn_rom_descriptor_comm_status_managementprotocolversion,
-    &eoprot_mn_rom_descriptor_comm_cmmnds_command_querynumof,
-    &eoprot_mn_rom_descriptor_comm_cmmnds_command_queryarray,
-    &eoprot_mn_rom_descriptor_comm_cmmnds_command_replynumof,
-    &eoprot_mn_rom_descriptor_comm_cmmnds_command_replyarray,
-    &eoprot_mn_rom_descriptor_comm_cmmnds_command_config         
-};  EO_VERIFYsizeof(s_eoprot_mn_rom_comm_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_mn_comm_numberof));
-
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_mn_rom_appl_descriptors[] =
-{   // here are eoprot_mn_tags_appl_numberof descriptors for the appl entity
-    &eoprot_mn_rom_descriptor_appl_wholeitem,
-    &eoprot_mn_rom_descriptor_appl_config,
-    &eoprot_mn_rom_descriptor_appl_config_txratedivider,
-    &eoprot_mn_rom_descriptor_appl_status,
-    &eoprot_mn_rom_descriptor_appl_cmmnds_go2state     
-};  EO_VERIFYsizeof(s_eoprot_mn_rom_appl_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_mn_appl_numberof));
-
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_mn_rom_info_descriptors[] =
-{   // here are eoprot_mn_tags_info_numberof descriptors for the info entity
-    &eoprot_mn_rom_descriptor_info_wholeitem,
-    &eoprot_mn_rom_descriptor_info_config,
-    &eoprot_mn_rom_descriptor_info_config_enabled,
-    &eoprot_mn_rom_descriptor_info_status,
-    &eoprot_mn_rom_descriptor_info_status_basic
-};  EO_VERIFYsizeof(s_eoprot_mn_rom_info_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_mn_info_numberof));
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_mn_rom_service_descriptors[] =
-{   // here are eoprot_mn_tags_service_numberof descriptors for the info entity
-    &eoprot_mn_rom_descriptor_service_wholeitem,
-    &eoprot_mn_rom_descriptor_service_status_commandresult,
-    &eoprot_mn_rom_descriptor_service_cmmnds_command
-};  EO_VERIFYsizeof(s_eoprot_mn_rom_service_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_mn_service_numberof));
-
-
-EOPROT_ROMmap EOnv_rom_t * const * const eoprot_mn_rom_descriptors[] = 
-{
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mn_rom_comm_descriptors,
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mn_rom_appl_descriptors,
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mn_rom_info_descriptors,
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mn_rom_service_descriptors       
-};  EO_VERIFYsizeof(eoprot_mn_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_mn_numberof));
+// -- the variables of the endpoint in a flat table
+
+// - begin of code generated by EoProtocolTables.cmake: do not edit
+
+const eOprot_ep_variable_t eoprot_mn_rom_variables[] =
+{   // eoprot_entities_mn_numberof x eoprot_mn_rom_tags_stride items: position is entity*stride+tag
+    // comm
+    {   // comm_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_wholeitem
+    },
+    {   // comm_status
+        EO_INIT(.offset)    offsetof(eOmn_comm_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_status
+    },
+    {   // comm_status_managementprotocolversion
+        EO_INIT(.offset)    offsetof(eOmn_comm_t, status.managementprotocolversion),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue.status.managementprotocolversion),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_status_managementprotocolversion,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue.status.managementprotocolversion,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_status_managementprotocolversion
+    },
+    {   // comm_cmmnds_command_querynumof
+        EO_INIT(.offset)    offsetof(eOmn_comm_t, cmmnds.command.cmd.querynumof),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.querynumof),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_cmmnds_command_querynumof,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.querynumof,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_cmmnds_command_querynumof
+    },
+    {   // comm_cmmnds_command_queryarray
+        EO_INIT(.offset)    offsetof(eOmn_comm_t, cmmnds.command.cmd.queryarray),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.queryarray),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_cmmnds_command_queryarray,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.queryarray,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_cmmnds_command_queryarray
+    },
+    {   // comm_cmmnds_command_replynumof
+        EO_INIT(.offset)    offsetof(eOmn_comm_t, cmmnds.command.cmd.replynumof),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.replynumof),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_cmmnds_command_replynumof,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.replynumof,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_cmmnds_command_replynumof
+    },
+    {   // comm_cmmnds_command_replyarray
+        EO_INIT(.offset)    offsetof(eOmn_comm_t, cmmnds.command.cmd.replyarray),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.replyarray),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_cmmnds_command_replyarray,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.replyarray,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_cmmnds_command_replyarray
+    },
+    {   // comm_cmmnds_command_config
+        EO_INIT(.offset)    offsetof(eOmn_comm_t, cmmnds.command.cmd.config),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.config),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_comm_cmmnds_command_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_comm_defaultvalue.cmmnds.command.cmd.config,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_comm_cmmnds_command_config
+    },
+    // appl
+    {   // appl_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_appl_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_appl_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_appl_defaultvalue,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_appl_wholeitem
+    },
+    {   // appl_config
+        EO_INIT(.offset)    offsetof(eOmn_appl_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_appl_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_appl_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_appl_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_appl_config
+    },
+    {   // appl_config_txratedivider
+        EO_INIT(.offset)    offsetof(eOmn_appl_t, config.txratedivider),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_appl_defaultvalue.config.txratedivider),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_appl_config_txratedivider,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_appl_defaultvalue.config.txratedivider,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_appl_config_txratedivider
+    },
+    {   // appl_status
+        EO_INIT(.offset)    offsetof(eOmn_appl_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_appl_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_appl_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_appl_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_appl_status
+    },
+    {   // appl_cmmnds_go2state
+        EO_INIT(.offset)    offsetof(eOmn_appl_t, cmmnds.go2state),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_appl_defaultvalue.cmmnds.go2state),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_appl_cmmnds_go2state,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_appl_defaultvalue.cmmnds.go2state,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_appl_cmmnds_go2state
+    },
+    {   0 },
+    {   0 },
+    {   0 },
+    // info
+    {   // info_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_info_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_info_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_info_defaultvalue,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_info_wholeitem
+    },
+    {   // info_config
+        EO_INIT(.offset)    offsetof(eOmn_info_t, config),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_info_defaultvalue.config),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_info_config,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_info_defaultvalue.config,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_info_config
+    },
+    {   // info_config_enabled
+        EO_INIT(.offset)    offsetof(eOmn_info_t, config.enabled),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_info_defaultvalue.config.enabled),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_info_config_enabled,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_info_defaultvalue.config.enabled,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_info_config_enabled
+    },
+    {   // info_status
+        EO_INIT(.offset)    offsetof(eOmn_info_t, status),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_info_defaultvalue.status),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_info_status,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_info_defaultvalue.status,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_info_status
+    },
+    {   // info_status_basic
+        EO_INIT(.offset)    offsetof(eOmn_info_t, status.basic),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_info_defaultvalue.status.basic),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_info_status_basic,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_info_defaultvalue.status.basic,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_info_status_basic
+    },
+    {   0 },
+    {   0 },
+    {   0 },
+    // service
+    {   // service_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_service_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_service_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_service_defaultvalue,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_service_wholeitem
+    },
+    {   // service_status_commandresult
+        EO_INIT(.offset)    offsetof(eOmn_service_t, status.commandresult),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_service_defaultvalue.status.commandresult),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_service_status_commandresult,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_service_defaultvalue.status.commandresult,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_service_status_commandresult
+    },
+    {   // service_cmmnds_command
+        EO_INIT(.offset)    offsetof(eOmn_service_t, cmmnds.command),
+        EO_INIT(.capacity)  sizeof(eoprot_mn_rom_service_defaultvalue.cmmnds.command),
+        EO_INIT(.rwmode)    eoprot_rwm_mn_service_cmmnds_command,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_mn_rom_service_defaultvalue.cmmnds.command,
+        EO_INIT(.rom)       &eoprot_mn_rom_descriptor_service_cmmnds_command
+    },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+    {   0 },
+};  EO_VERIFYsizeof(eoprot_mn_rom_variables, sizeof(eOprot_ep_variable_t)*eoprot_entities_mn_numberof*eoprot_mn_rom_tags_stride);
+
+// - end of code generated by EoProtocolTables.cmake
 
     
 
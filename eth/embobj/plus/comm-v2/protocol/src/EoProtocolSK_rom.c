@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -180,23 +181,56 @@ const eoprot_version_t eoprot_sk_version =
 };
   
 
-// -- collector of eonv descriptors for the endpoint
-
-static EOPROT_ROMmap EOnv_rom_t * const s_eoprot_sk_rom_skin_descriptors[] =
-{   // here are eoprot_tags_sk_skin_numberof descriptors for the skin entity
-    &eoprot_sk_rom_descriptor_skin_wholeitem,
-    &eoprot_sk_rom_descriptor_skin_config_sigmode,
-    &eoprot_sk_rom_descriptor_skin_status_arrayofcandata,
-    &eoprot_sk_rom_descriptor_skin_cmmnds_boardscfg,
-    &eoprot_sk_rom_descriptor_skin_cmmnds_trianglescfg
-};  EO_VERIFYsizeof(s_eoprot_sk_rom_skin_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t* const)*(eoprot_tags_sk_skin_numberof));
-
-
-
-EOPROT_ROMmap EOnv_rom_t * const * const eoprot_sk_rom_descriptors[] = 
-{
-    (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_sk_rom_skin_descriptors 
-};  EO_VERIFYsizeof(eoprot_sk_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_sk_numberof));
+// -- the variables of the endpoint in a flat table
+
+// - begin of code generated by EoProtocolTables.cmake: do not edit
+
+const eOprot_ep_variable_t eoprot_sk_rom_variables[] =
+{   // eoprot_entities_sk_numberof x eoprot_sk_rom_tags_stride items: position is entity*stride+tag
+    // skin
+    {   // skin_wholeitem
+        EO_INIT(.offset)    0,
+        EO_INIT(.capacity)  sizeof(eoprot_sk_rom_skin_defaultvalue),
+        EO_INIT(.rwmode)    eoprot_rwm_sk_skin_wholeitem,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_sk_rom_skin_defaultvalue,
+        EO_INIT(.rom)       &eoprot_sk_rom_descriptor_skin_wholeitem
+    },
+    {   // skin_config_sigmode
+        EO_INIT(.offset)    offsetof(eOsk_skin_t, config.sigmode),
+        EO_INIT(.capacity)  sizeof(eoprot_sk_rom_skin_defaultvalue.config.sigmode),
+        EO_INIT(.rwmode)    eoprot_rwm_sk_skin_config_sigmode,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_sk_rom_skin_defaultvalue.config.sigmode,
+        EO_INIT(.rom)       &eoprot_sk_rom_descriptor_skin_config_sigmode
+    },
+    {   // skin_status_arrayofcandata
+        EO_INIT(.offset)    offsetof(eOsk_skin_t, status.arrayofcandata),
+        EO_INIT(.capacity)  sizeof(eoprot_sk_rom_skin_defaultvalue.status.arrayofcandata),
+        EO_INIT(.rwmode)    eoprot_rwm_sk_skin_status_arrayofcandata,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_sk_rom_skin_defaultvalue.status.arrayofcandata,
+        EO_INIT(.rom)       &eoprot_sk_rom_descriptor_skin_status_arrayofcandata
+    },
+    {   // skin_cmmnds_boardscfg
+        EO_INIT(.offset)    offsetof(eOsk_skin_t, cmmnds.boardscfg),
+        EO_INIT(.capacity)  sizeof(eoprot_sk_rom_skin_defaultvalue.cmmnds.boardscfg),
+        EO_INIT(.rwmode)    eoprot_rwm_sk_skin_cmmnds_boardscfg,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_sk_rom_skin_defaultvalue.cmmnds.boardscfg,
+        EO_INIT(.rom)       &eoprot_sk_rom_descriptor_skin_cmmnds_boardscfg
+    },
+    {   // skin_cmmnds_trianglescfg
+        EO_INIT(.offset)    offsetof(eOsk_skin_t, cmmnds.trianglescfg),
+        EO_INIT(.capacity)  sizeof(eoprot_sk_rom_skin_defaultvalue.cmmnds.trianglescfg),
+        EO_INIT(.rwmode)    eoprot_rwm_sk_skin_cmmnds_trianglescfg,
+        EO_INIT(.filler)    {0},
+        EO_INIT(.resetval)  (const void*)&eoprot_sk_rom_skin_defaultvalue.cmmnds.trianglescfg,
+        EO_INIT(.rom)       &eoprot_sk_rom_descriptor_skin_cmmnds_trianglescfg
+    },
+};  EO_VERIFYsizeof(eoprot_sk_rom_variables, sizeof(eOprot_ep_variable_t)*eoprot_entities_sk_numberof*eoprot_sk_rom_tags_stride);
+
+// - end of code generated by EoProtocolTables.cmake
 
     
 
@@ -0,0 +1,173 @@
+# Copyright: (C) 2013 iCub Facility, Istituto Italiano di Tecnologia
+# Authors: Marco Accame <marco.accame@iit.it>
+# CopyPolicy: Released under the terms of the GNU GPL v2.0.
+#
+# It generates the flat table of variables of every endpoint of the protocol (eoprot_xx_rom_variables[] and the
+# enum eoprot_xx_rom_tags_stride) inside the EoProtocolXX_rom.c and EoProtocolXX_rom.h files. The generated code
+# stays in between the begin and end markers, everything else is kept. Run it after adding or changing a tag:
+#
+#   cmake -P EoProtocolTables.cmake
+#
+# The inputs are the tags in api/EoProtocolXX.h (entity by entity, in order of value) and the resetval of the
+# descriptors eoprot_xx_rom_descriptor_<entity>_<tag> in EoProtocolXX_rom.c, from which it takes the member of the
+# entity which the variable refers to.
+
+if(NOT EOPROT_DIR)
+    get_filename_component(EOPROT_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+endif()
+
+set(EOPROT_BEGIN "// - begin of code generated by EoProtocolTables.cmake: do not edit")
+set(EOPROT_END "// - end of code generated by EoProtocolTables.cmake")
+
+# the entities of each endpoint, in order of value
+set(EOPROT_ENTITIES_mn comm appl info service)
+set(EOPROT_ENTITIES_mc joint motor controller)
+set(EOPROT_ENTITIES_as strain mais extorque inertial)
+set(EOPROT_ENTITIES_sk skin)
+
+
+# it gives in var the list of the line terminators of file, "0d 0a " for CRLF and "0a " for LF. file(READ) drops the carriage
+# returns, thus they are taken from the hex dump, with a space after every byte so that the matches stay byte aligned.
+function(eoprot_line_terminators file var)
+    file(READ "${file}" hex HEX)
+    string(REGEX REPLACE "(..)" "\\1 " hex "${hex}")
+    string(REGEX MATCHALL "(0d )?0a " terminators "${hex}")
+    set(${var} "${terminators}" PARENT_SCOPE)
+endfunction()
+
+
+# it replaces the code between the markers of file with the content of text. every line out of the markers keeps its own 
+# terminator, as the files of the protocol may mix CRLF and LF lines. the generated lines take the one of the end marker.
+function(eoprot_replace_generated file text)
+    file(READ "${file}" content)
+    string(FIND "${content}" "${EOPROT_BEGIN}" begin)
+    string(FIND "${content}" "${EOPROT_END}" end)
+    if((begin EQUAL -1) OR (end EQUAL -1))
+        message(FATAL_ERROR "EoProtocolTables: cannot find the markers in ${file}")
+    endif()
+    string(LENGTH "${EOPROT_BEGIN}" beginlength)
+    math(EXPR begin "${begin} + ${beginlength}")
+    string(SUBSTRING "${content}" 0 ${begin} head)
+    string(SUBSTRING "${content}" ${end} -1 tail)
+    set(newcontent "${head}${text}${tail}")
+    if(NOT newcontent STREQUAL content)
+        eoprot_line_terminators("${file}" terminators)
+        list(LENGTH terminators oldlines)
+        string(REGEX MATCHALL "\n" newlines "${head}")
+        list(LENGTH newlines headlines)
+        string(REGEX MATCHALL "\n" newlines "${head}${text}")
+        list(LENGTH newlines firsttaillines)
+        string(REGEX MATCHALL "\n" newlines "${newcontent}")
+        list(LENGTH newlines totallines)
+        # the tail lines are the last ones of the file
+        math(EXPR shift "${oldlines} - ${totallines}")
+        math(EXPR endmarkerline "${firsttaillines} + ${shift}")
+        list(GET terminators ${endmarkerline} generatedterminator)
+        set(output "")
+        set(rest "${newcontent}")
+        set(line 0)
+        string(FIND "${rest}" "\n" newline)
+        while(NOT newline EQUAL -1)
+            string(SUBSTRING "${rest}" 0 ${newline} linetext)
+            math(EXPR next "${newline} + 1")
+            string(SUBSTRING "${rest}" ${next} -1 rest)
+            if(line LESS headlines)
+                list(GET terminators ${line} terminator)
+            elseif(line LESS firsttaillines)
+                set(terminator "${generatedterminator}")
+            else()
+                math(EXPR oldline "${line} + ${shift}")
+                list(GET terminators ${oldline} terminator)
+            endif()
+            if(terminator STREQUAL "0d 0a ")
+                string(APPEND output "${linetext}\r\n")
+            else()
+                string(APPEND output "${linetext}\n")
+            endif()
+            math(EXPR line "${line} + 1")
+            string(FIND "${rest}" "\n" newline)
+        endwhile()
+        file(WRITE "${file}" "${output}${rest}")
+        message(STATUS "EoProtocolTables: generated ${file}")
+    endif()
+endfunction()
+
+
+foreach(ep mn mc as sk)
+    string(TOUPPER ${ep} EP)
+    file(READ "${EOPROT_DIR}/api/EoProtocol${EP}.h" header)
+    file(READ "${EOPROT_DIR}/src/EoProtocol${EP}_rom.c" rom)
+
+    # the stride is the max number of tags of the entities
+    set(stride 0)
+    foreach(ent ${EOPROT_ENTITIES_${ep}})
+        string(REGEX MATCH "eoprot_tags_${ep}_${ent}_numberof *= *([0-9]+)" match "${header}")
+        if(NOT match)
+            message(FATAL_ERROR "EoProtocolTables: cannot find eoprot_tags_${ep}_${ent}_numberof")
+        endif()
+        set(numberof_${ent} ${CMAKE_MATCH_1})
+        if(CMAKE_MATCH_1 GREATER stride)
+            set(stride ${CMAKE_MATCH_1})
+        endif()
+    endforeach()
+
+    set(table "\n\nconst eOprot_ep_variable_t eoprot_${ep}_rom_variables[] =\n{   // eoprot_entities_${ep}_numberof x eoprot_${ep}_rom_tags_stride items: position is entity*stride+tag\n")
+
+    foreach(ent ${EOPROT_ENTITIES_${ep}})
+        string(REGEX MATCH "static const ([A-Za-z0-9_]+) eoprot_${ep}_rom_${ent}_defaultvalue" match "${rom}")
+        if(NOT match)
+            message(FATAL_ERROR "EoProtocolTables: cannot find eoprot_${ep}_rom_${ent}_defaultvalue")
+        endif()
+        set(type ${CMAKE_MATCH_1})
+        set(defval "eoprot_${ep}_rom_${ent}_defaultvalue")
+        set(table "${table}    // ${ent}\n")
+
+        # the names of the tags in order of value
+        string(REGEX MATCHALL "eoprot_tag_${ep}_${ent}_[a-z0-9_]+ *= *[0-9]+" tags "${header}")
+        math(EXPR last "${stride} - 1")
+        foreach(value RANGE 0 ${last})
+            set(tagname "")
+            foreach(tag ${tags})
+                if(tag MATCHES "^eoprot_tag_${ep}_${ent}_([a-z0-9_]+) *= *([0-9]+)$")
+                    if(CMAKE_MATCH_2 EQUAL value)
+                        set(tagname ${CMAKE_MATCH_1})
+                    endif()
+                endif()
+            endforeach()
+
+            if(NOT value LESS numberof_${ent})
+                set(table "${table}    {   0 },\n")
+            elseif(tagname STREQUAL "")
+                message(FATAL_ERROR "EoProtocolTables: cannot find the tag ${value} of ${ep} ${ent}")
+            else()
+                set(descriptor "eoprot_${ep}_rom_descriptor_${ent}_${tagname}")
+                string(REGEX MATCH "${descriptor} *=[^}]*" body "${rom}")
+                string(REGEX MATCH "${defval}([A-Za-z0-9_.]*)" match "${body}")
+                if(NOT match)
+                    message(FATAL_ERROR "EoProtocolTables: cannot find the resetval of ${descriptor}")
+                endif()
+                set(member "${CMAKE_MATCH_1}")
+                if(member STREQUAL "")
+                    set(offset "0")
+                else()
+                    string(SUBSTRING "${member}" 1 -1 designator)
+                    set(offset "offsetof(${type}, ${designator})")
+                endif()
+                set(table "${table}    {   // ${ent}_${tagname}\n")
+                set(table "${table}        EO_INIT(.offset)    ${offset},\n")
+                set(table "${table}        EO_INIT(.capacity)  sizeof(${defval}${member}),\n")
+                set(table "${table}        EO_INIT(.rwmode)    eoprot_rwm_${ep}_${ent}_${tagname},\n")
+                set(table "${table}        EO_INIT(.filler)    {0},\n")
+                set(table "${table}        EO_INIT(.resetval)  (const void*)&${defval}${member},\n")
+                set(table "${table}        EO_INIT(.rom)       &${descriptor}\n")
+                set(table "${table}    },\n")
+            endif()
+        endforeach()
+    endforeach()
+
+    set(table "${table}};  EO_VERIFYsizeof(eoprot_${ep}_rom_variables, sizeof(eOprot_ep_variable_t)*eoprot_entities_${ep}_numberof*eoprot_${ep}_rom_tags_stride);\n\n")
+    eoprot_replace_generated("${EOPROT_DIR}/src/EoProtocol${EP}_rom.c" "${table}")
+
+    set(enum "\nenum { eoprot_${ep}_rom_tags_stride = ${stride} };   // the max number of tags of the entities\n")
+    eoprot_replace_generated("${EOPROT_DIR}/src/EoProtocol${EP}_rom.h" "${enum}")
+endforeach()
@@ -50,7 +50,20 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the rx path hands a bulk ask<> to the tx path with bulk.request and bulk.requested: requested is published with release 
+// after request is written, and it is read with acquire before request is read
+#if     defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#define EOAGENT_LOAD_RELAXED(p)         __atomic_load_n((p), __ATOMIC_RELAXED)
+#define EOAGENT_LOAD_ACQUIRE(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define EOAGENT_STORE_RELAXED(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define EOAGENT_STORE_RELEASE(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define EOAGENT_LOAD_RELAXED(p)         (*(p))
+#define EOAGENT_LOAD_ACQUIRE(p)         (*(p))
+#define EOAGENT_STORE_RELAXED(p, v)     (*(p) = (v))
+#define EOAGENT_STORE_RELEASE(p, v)     (*(p) = (v))
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -76,6 +89,8 @@ static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o);
 static EOrop * s_eo_agent_rop_prepare_reply(EOrop *ropin, EOrop *ropout);
 static eObool_t s_eo_agent_rop_cannot_manage(EOrop *ropin);
 
+static eObool_t s_eo_agent_bulk_seek(EOagent *p);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -107,6 +122,7 @@ extern EOagent* eo_agent_New(const eOagent_cfg_t *cfg)
     retptr = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOagent), 1);
     
     memcpy(&retptr->config, cfg, sizeof(eOagent_cfg_t));
+    memset(&retptr->bulk, 0, sizeof(eOagent_bulk_t));
                
     return(retptr);       
 }    
@@ -208,6 +224,14 @@ extern eOresult_t eo_agent_InpROPprocess(EOagent *p, EOrop *ropin, eOipv4addr_t
 
         return(eores_OK); 
     }
+    else if((eo_ropcode_ask == ropc) && (eobool_true == eoprot_ID_isbulk(ropin->stream.head.id32)))
+    {   // a bulk ask<> does not refer to any netvar: we just record it. the say<> of the wholeitems are then formed by the 
+        // tx path with eo_agent_BulkROP_Get() in as many ropframes as needed. only the rx path writes them.
+        EOAGENT_STORE_RELAXED(&p->bulk.request, ropin->stream.head.id32);
+        EOAGENT_STORE_RELEASE(&p->bulk.requested, p->bulk.requested + 1);
+        
+        return(eores_OK);
+    }
     else 
     {   // we have a normal rop to be processed with eo_ropconf_none
         eOnvOwnership_t ownership = eo_rop_get_ownership(ropc, eo_ropconf_none, eo_rop_dir_received); // local if we receive a set/get. remote if we receive a sig
@@ -313,6 +337,61 @@ extern eOresult_t eo_agent_OutROPprepare(EOagent* p, EOnv* nv, eOropdescriptor_t
 }
 
 
+extern eOresult_t eo_agent_BulkROP_Get(EOagent* p, eOprotID32_t* id32)
+{
+    uint32_t requested = 0;
+    
+    if((NULL == p) || (NULL == id32))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    requested = EOAGENT_LOAD_ACQUIRE(&p->bulk.requested);
+    
+    if(p->bulk.started != requested)
+    {   // a new bulk ask<> has arrived: we start it from its first wholeitem. if another one arrives meanwhile, we may read 
+        // its request with the older counter: it is then started again at next call, which is harmless
+        eOprotID32_t request = EOAGENT_LOAD_RELAXED(&p->bulk.request);
+        p->bulk.started     = requested;
+        p->bulk.active      = eobool_true;
+        p->bulk.endpoint    = eoprot_ID2endpoint(request);
+        p->bulk.entity      = eoprot_ID2entity(request);
+        p->bulk.ep          = (eoprot_endpoint_all == p->bulk.endpoint) ? (0) : (p->bulk.endpoint);
+        p->bulk.ent         = (eoprot_entity_all == p->bulk.entity) ? (0) : (p->bulk.entity);
+        p->bulk.ind         = 0;
+    }
+    
+    if(eobool_false == s_eo_agent_bulk_seek(p))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // the wholeitem has always tag 0
+    *id32 = eoprot_ID_get(p->bulk.ep, p->bulk.ent, p->bulk.ind, 0);
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_agent_BulkROP_Next(EOagent* p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(eobool_false == p->bulk.active)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // eo_agent_BulkROP_Get() will move to the next entity or endpoint if the index is beyond the last one
+    p->bulk.ind ++;
+    
+    return(eores_OK);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -594,6 +673,44 @@ static eObool_t s_eo_agent_rop_cannot_manage(EOrop *ropin)
 }
 
 
+// it moves the cursor (ep, ent, ind) of the bulk to the first existing wholeitem starting from itself. 
+// it returns eobool_false when the bulk is over.
+static eObool_t s_eo_agent_bulk_seek(EOagent *p)
+{
+    eOagent_bulk_t *bulk = &p->bulk;
+    eOnvBRD_t brd = 0;
+    eOprotEndpoint_t lastep = (eoprot_endpoint_all == bulk->endpoint) ? (eoprot_endpoints_numberof-1) : (bulk->endpoint);
+    
+    if((eobool_false == bulk->active) || (eores_OK != eo_nvset_BRD_Get(p->config.nvset, &brd)))
+    {
+        bulk->active = eobool_false;
+        return(eobool_false);
+    }
+    
+    while(bulk->ep <= lastep)
+    {
+        // the entities are scanned from bulk->ent up to endofentities (excluded)
+        uint8_t endofentities = (eoprot_entity_all == bulk->entity) ? (eoprot_endpoint_get_numberofentities(bulk->ep)) : (bulk->entity+1);
+        
+        for(; bulk->ent < endofentities; bulk->ent++, bulk->ind = 0)
+        {
+            if(bulk->ind < eoprot_entity_numberof_get(brd, bulk->ep, bulk->ent))
+            {
+                return(eobool_true);
+            }
+        }
+        
+        // only with eoprot_endpoint_all we have more than one endpoint, and with it also eoprot_entity_all
+        bulk->ep ++;
+        bulk->ent = 0;
+        bulk->ind = 0;
+    }
+    
+    bulk->active = eobool_false;
+    return(eobool_false);
+}
+
+
 
 
 
@@ -101,6 +101,14 @@ extern eOresult_t eo_agent_InpROPprocess(EOagent *p, EOrop *ropin, eOipv4addr_t
 // if data is required this function uses ropdescr->data/size if not NULL/0, otherwise if NULL it used data from EOnv.
 extern eOresult_t eo_agent_OutROPprepare(EOagent* p, EOnv* nv, eOropdescriptor_t* ropdescr, EOrop* rop, uint16_t* requiredbytes);
 
+// OK: called by eo_transmitter_outpacket_Prepare() to serve a bulk ask<> received with id32 from EOPROT_ID_BULK_GET(). 
+// eo_agent_BulkROP_Get() gives the id32 of the next wholeitem to send with a say<> or returns eores_NOK_generic if there is
+// nothing left to send. eo_agent_BulkROP_Next() moves to the following wholeitem once the say<> has found room in a ropframe.
+// a new bulk ask<> restarts from its beginning. a bulk ask<> is never confirmed with ack/nak. 
+extern eOresult_t eo_agent_BulkROP_Get(EOagent* p, eOprotID32_t* id32);
+
+extern eOresult_t eo_agent_BulkROP_Next(EOagent* p);
+
 
 
 
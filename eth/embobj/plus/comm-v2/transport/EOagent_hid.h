@@ -48,6 +48,20 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+typedef struct
+{
+    eOprotID32_t            request;        // the id32 of the last bulk ask<>, written by the rx path
+    uint32_t                requested;      // incremented by the rx path at every bulk ask<>, with release after request
+    uint32_t                started;        // the value of requested when the tx path has started the current bulk
+    eObool_t                active;
+    eOprotEndpoint_t        endpoint;       // the endpoint of the current bulk. it can be eoprot_endpoint_all
+    eOprotEntity_t          entity;         // the entity of the current bulk. it can be eoprot_entity_all
+    eOprotEndpoint_t        ep;             // ep, ent, ind: the wholeitem to be sent next
+    eOprotEntity_t          ent;
+    eOprotIndex_t           ind;
+} eOagent_bulk_t;
+
+
 /** @struct     EOagent_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -57,6 +71,7 @@ extern "C" {
 struct EOagent_hid 
 {
     eOagent_cfg_t   config;
+    eOagent_bulk_t  bulk;
 }; 
 
 
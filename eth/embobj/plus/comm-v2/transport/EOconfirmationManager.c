@@ -24,6 +24,8 @@
 #include "EoCommon.h"
 #include "string.h"
 #include "EOtheMemoryPool.h"
+#include "EOVtheSystem.h"
+#include "EOtransceiver.h"
 
 
 
@@ -76,12 +78,25 @@
 static void s_eo_confman_default_rop_conf_requested(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
 static void s_eo_confman_default_rop_conf_received(eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
 
+static eObool_t s_eo_confman_inflight_trackable(eOropdescriptor_t* ropdes);
+
+static eOconfman_inflight_t * s_eo_confman_inflight_find(EOconfirmationManager *p, eOropdescriptor_t* ropdes);
+
+static void s_eo_confman_inflight_add(EOconfirmationManager *p, eOropdescriptor_t* ropdes);
+
+static void s_eo_confman_inflight_load(EOconfirmationManager *p, eOconfman_inflight_t *item, eOropdescriptor_t* ropdes);
+
+static void s_eo_confman_inflight_confirmed(EOconfirmationManager *p, eOconfman_inflight_t *item, eOropconfinfo_t confinfo);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOconfirmationManager";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOconfirmationManager";
+#endif
 
 const eOconfman_cfg_t eOconfman_cfg_default = 
 {
@@ -89,7 +104,12 @@ const eOconfman_cfg_t eOconfman_cfg_default =
     EO_INIT(.maxnumberofconfreqrops)        16,
     EO_INIT(.mutex_fn_new)                  NULL,
     EO_INIT(.on_rop_conf_requested)         s_eo_confman_default_rop_conf_requested, 
-    EO_INIT(.on_rop_conf_received)          s_eo_confman_default_rop_conf_received
+    EO_INIT(.on_rop_conf_received)          s_eo_confman_default_rop_conf_received,
+    EO_INIT(.maxinflight)                   0,
+    EO_INIT(.timeout)                       50*1000,
+    EO_INIT(.maxretransmissions)            3,
+    EO_INIT(.maxsizeofropdata)              64,
+    EO_INIT(.transceiver)                   NULL
 };
 
 
@@ -123,6 +143,23 @@ extern EOconfirmationManager* eo_confman_New(const eOconfman_cfg_t *cfg)
 
     retptr->mtx = (NULL == cfg->mutex_fn_new) ? (NULL) : (cfg->mutex_fn_new());
     
+    retptr->inflight        = NULL;
+    retptr->inflightdata    = NULL;
+    retptr->retxdata        = NULL;
+    retptr->inflightnumber  = 0;
+    memset(&retptr->stats, 0, sizeof(eOconfman_stats_t));
+    
+    if(0 != cfg->maxinflight)
+    {
+        retptr->inflight = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOconfman_inflight_t), cfg->maxinflight);
+        memset(retptr->inflight, 0, cfg->maxinflight*sizeof(eOconfman_inflight_t));
+        if(0 != cfg->maxsizeofropdata)
+        {
+            retptr->inflightdata = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->maxsizeofropdata, cfg->maxinflight);
+            retptr->retxdata = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->maxsizeofropdata, 1);
+        }
+    }
+    
     return(retptr);
 }
 
@@ -143,6 +180,13 @@ extern void eo_confman_Delete(EOconfirmationManager *p)
     {
         eo_vector_Delete(p->confrequests);
     }
+    
+    if(NULL != p->inflight)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->inflight);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->inflightdata);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->retxdata);
+    }
    
     memset(p, 0, sizeof(EOconfirmationManager));
     eo_mempool_Delete(eo_mempool_GetHandle(), p);
@@ -184,9 +228,39 @@ extern eOresult_t eo_confman_ConfirmationRequest_Insert(EOconfirmationManager *p
         return(eores_NOK_generic);  
     }
     
+    eOconfman_inflight_t *item = NULL;
+    
     // if conf request is flagged on
     if(1 == ropdesc->control.rqstconf)
     {
+        if((NULL != p->inflight) && (eobool_true == s_eo_confman_inflight_trackable(ropdesc)))
+        {   // the rop is tracked until its ack/nak
+            eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+            
+            item = s_eo_confman_inflight_find(p, ropdesc);
+            
+            if(NULL == item)
+            {
+                if(p->inflightnumber >= p->config.maxinflight)
+                {
+                    eov_mutex_Release(p->mtx);
+                    return(eores_NOK_busy); 
+                }
+                s_eo_confman_inflight_add(p, ropdesc);
+            }
+            else if(ropdesc != &p->retxropdes)
+            {   // not a retransmission of eo_confman_Tick() but a new send of a rop in flight: it supersedes the 
+                // old one, so that a timeout retransmits the new data
+                if(item->pending < 255)
+                {
+                    item->pending++;
+                }
+                s_eo_confman_inflight_load(p, item, ropdesc);
+            }
+            
+            eov_mutex_Release(p->mtx);
+        }
+        
         if(NULL != p->confrequests)
         { 
             eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
@@ -243,7 +317,15 @@ extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOi
 
     if(eo_ropconf_none != confinfo)
     {
-        // received a confirmation ack/nak: execute the callback
+        // received a confirmation ack/nak: stop tracking the rop ...
+        if(NULL != p->inflight)
+        {
+            eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+            s_eo_confman_inflight_confirmed(p, s_eo_confman_inflight_find(p, ropdes), confinfo);
+            eov_mutex_Release(p->mtx);
+        }
+        
+        // ... and execute the callback
         if(NULL != p->config.on_rop_conf_received)
         {
             p->config.on_rop_conf_received(fromipaddr, ropdes);
@@ -256,6 +338,174 @@ extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOi
 }
 
 
+extern eObool_t eo_confman_ConfirmationRequest_CanInsert(EOconfirmationManager *p, eOropdescriptor_t* ropdes)
+{
+    eObool_t ret = eobool_true;
+    
+    if((NULL == p) || (NULL == ropdes))
+    {
+        return(eobool_false);  
+    }
+    
+    if((NULL == p->inflight) || (1 != ropdes->control.rqstconf) || (eobool_false == s_eo_confman_inflight_trackable(ropdes)))
+    {   // the rop is not tracked
+        return(eobool_true);
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    if((p->inflightnumber >= p->config.maxinflight) && (NULL == s_eo_confman_inflight_find(p, ropdes)))
+    {
+        ret = eobool_false;
+    }
+    
+    eov_mutex_Release(p->mtx);
+    
+    return(ret);
+}
+
+
+extern uint16_t eo_confman_InFlight_Number(EOconfirmationManager *p)
+{
+    if(NULL == p)
+    {
+        return(0);  
+    }
+    
+    return(p->inflightnumber);
+}
+
+
+extern eOresult_t eo_confman_Tick(EOconfirmationManager *p)
+{
+    eOabstime_t timenow = 0;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);  
+    }
+    
+    if((NULL == p->inflight) || (0 == p->inflightnumber) || (eok_reltimeINFINITE == p->config.timeout))
+    {
+        return(eores_OK);
+    }
+    
+    timenow = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    
+    // we process one expired rop at a time, so that its retransmission is done without holding the mutex: 
+    // the transmitter calls eo_confman_ConfirmationRequest_Insert() again. the loop ends because every
+    // processed rop gets a new deadline in the future or is dropped. 
+    for(;;)
+    {
+        uint16_t i = 0;
+        eOconfman_inflight_t *item = NULL;
+        
+        eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+        
+        for(i=0; i<p->config.maxinflight; i++)
+        {
+            if((1 == p->inflight[i].used) && (timenow > p->inflight[i].deadline))
+            {
+                item = &p->inflight[i];
+                break;
+            }
+        }
+        
+        if(NULL == item)
+        {
+            eov_mutex_Release(p->mtx);
+            break;
+        }
+        
+        if((0 == item->retransmittable) || (item->retransmissions >= p->config.maxretransmissions) || (NULL == p->config.transceiver))
+        {   // we give up 
+            p->stats.timeouts++;
+            item->used = 0;
+            p->inflightnumber--;
+            eov_mutex_Release(p->mtx);
+            continue;
+        }
+        
+        item->retransmissions++;
+        item->deadline = timenow + p->config.timeout;
+        p->stats.retransmissions++;
+        
+        memcpy(&p->retxropdes, &item->ropdes, sizeof(eOropdescriptor_t));
+        if(NULL != item->ropdes.data)
+        {
+            memcpy(p->retxdata, item->ropdes.data, item->ropdes.size);
+            p->retxropdes.data = p->retxdata;
+        }
+        
+        eov_mutex_Release(p->mtx);
+        
+        eo_transceiver_OccasionalROP_Load((EOtransceiver*)p->config.transceiver, &p->retxropdes);
+    }
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_confman_Stats_Get(EOconfirmationManager *p, eOconfman_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);  
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    memcpy(stats, &p->stats, sizeof(eOconfman_stats_t));
+    eov_mutex_Release(p->mtx);
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_confman_Stats_Reset(EOconfirmationManager *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);  
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    memset(&p->stats, 0, sizeof(eOconfman_stats_t));
+    eov_mutex_Release(p->mtx);
+    
+    return(eores_OK);
+}
+
+
+extern uint32_t eo_confman_Footprint(EOconfirmationManager *p, uint16_t *mutexes)
+{
+    uint32_t bytes = 0;
+    
+    if(NULL != mutexes)
+    {
+        *mutexes = ((NULL == p) || (NULL == p->mtx)) ? (0) : (1);
+    }
+    
+    if(NULL == p)
+    {
+        return(0);
+    }
+    
+    bytes = sizeof(EOconfirmationManager) + eo_vector_Footprint(p->confrequests);
+    
+    if(NULL != p->inflight)
+    {
+        bytes += p->config.maxinflight*sizeof(eOconfman_inflight_t);
+    }
+    
+    if(NULL != p->inflightdata)
+    {   // the slots of the rops in flight plus the one used for the retransmission
+        bytes += (p->config.maxinflight + 1)*p->config.maxsizeofropdata;
+    }
+    
+    return(bytes);
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
@@ -280,6 +530,145 @@ static void s_eo_confman_default_rop_conf_received(eOipv4addr_t fromipaddr, eOro
 }
 
 
+static eObool_t s_eo_confman_inflight_trackable(eOropdescriptor_t* ropdes)
+{   // only set<>, rst<> and sig<> get an ack/nak with their own ropcode. an ask<> which succeeds gets a say<> without any
+    // confinfo, thus it would wait in the window until its timeout
+    switch(ropdes->ropcode)
+    {
+        case eo_ropcode_set:
+        case eo_ropcode_rst:
+        case eo_ropcode_sig:
+        {
+            return(eobool_true);
+        }
+        
+        default:
+        {
+            return(eobool_false);
+        }
+    }
+}
+
+
+static eOconfman_inflight_t * s_eo_confman_inflight_find(EOconfirmationManager *p, eOropdescriptor_t* ropdes)
+{   // a rop in flight is identified by ropcode, id32 and, if it is sent, by its signature
+    uint16_t i = 0;
+    
+    for(i=0; i<p->config.maxinflight; i++)
+    {
+        eOconfman_inflight_t *item = &p->inflight[i];
+        if((1 == item->used) && (item->ropdes.id32 == ropdes->id32) && (item->ropdes.ropcode == ropdes->ropcode))
+        {
+            if((0 == item->ropdes.control.plussign) || (item->ropdes.signature == ropdes->signature))
+            {
+                return(item);
+            }
+        }
+    }
+    
+    return(NULL);
+}
+
+
+static void s_eo_confman_inflight_add(EOconfirmationManager *p, eOropdescriptor_t* ropdes)
+{
+    uint16_t i = 0;
+    eOconfman_inflight_t *item = NULL;
+    
+    for(i=0; i<p->config.maxinflight; i++)
+    {
+        if(0 == p->inflight[i].used)
+        {
+            item = &p->inflight[i];
+            break;
+        }
+    }
+    
+    if(NULL == item)
+    {
+        return;
+    }
+    
+    item->used              = 1;
+    item->pending           = 1;
+    s_eo_confman_inflight_load(p, item, ropdes);
+    
+    p->inflightnumber++;
+}
+
+
+static void s_eo_confman_inflight_load(EOconfirmationManager *p, eOconfman_inflight_t *item, eOropdescriptor_t* ropdes)
+{
+    uint16_t i = (uint16_t)(item - p->inflight);
+    
+    memcpy(&item->ropdes, ropdes, sizeof(eOropdescriptor_t));
+    item->retransmissions   = 0;
+    item->retransmittable   = 1;
+    item->firsttime         = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    item->deadline          = (eok_reltimeINFINITE == p->config.timeout) ? (EOK_uint64dummy) : (item->firsttime + p->config.timeout);
+    
+    // the data of a remote nv is passed by the caller: we keep a copy of it for the retransmission
+    if(NULL != ropdes->data)
+    {
+        if((NULL != p->inflightdata) && (ropdes->size <= p->config.maxsizeofropdata))
+        {
+            item->ropdes.data = &p->inflightdata[i*p->config.maxsizeofropdata];
+            memcpy(item->ropdes.data, ropdes->data, ropdes->size);
+        }
+        else
+        {
+            item->ropdes.data = NULL;
+            item->retransmittable = 0;
+        }
+    }
+    
+    p->stats.requested++;
+}
+
+
+static void s_eo_confman_inflight_confirmed(EOconfirmationManager *p, eOconfman_inflight_t *item, eOropconfinfo_t confinfo)
+{
+    eOreltime_t latency = 0;
+    
+    if(NULL == item)
+    {
+        p->stats.unmatched++;
+        return;
+    }
+    
+    latency = (eOreltime_t)(eov_sys_LifeTimeGet(eov_sys_GetHandle()) - item->firsttime);
+    
+    if(eo_ropconf_ack == confinfo)
+    {
+        p->stats.acks++;
+    }
+    else
+    {
+        p->stats.naks++;
+    }
+    
+    if((1 == (p->stats.acks + p->stats.naks)) || (latency < p->stats.latencymin))
+    {
+        p->stats.latencymin = latency;
+    }
+    if(latency > p->stats.latencymax)
+    {
+        p->stats.latencymax = latency;
+    }
+    p->stats.latencylast = latency;
+    p->stats.latencysum += latency;
+    
+    if(item->pending > 1)
+    {   // the rop was sent again before this ack/nak: we wait for the one of the last send
+        item->pending--;
+        return;
+    }
+    
+    item->used = 0;
+    p->inflightnumber--;
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
@@ -32,6 +32,13 @@ extern "C" {
 
 /** @defgroup eo_confman Object EOconfirmationManager
     The EOconfirmationManager object is used as ...
+    If cfg->maxinflight is not zero, it also tracks the rops sent with a confirmation request until their ack/nak arrives. 
+    Up to cfg->maxinflight rops can be in flight at the same time, so that they can be pipelined. Those without ack/nak 
+    after cfg->timeout are retransmitted by eo_confman_Tick(), which EOtransceiver calls at every eo_transceiver_outpacket_Prepare().
+    A rop with the same ropcode, id32 and signature as one still in flight supersedes it: its data replaces the one kept 
+    for the retransmission, and the entry is released only after the ack/nak of every send.
+    Only set<>, rst<> and sig<> are tracked: an ask<> is answered by a say<> (which carries no ack when it succeeds), 
+    so it is sent once as before.
          
     @{        
  **/
@@ -74,7 +81,27 @@ typedef struct
     eov_mutex_fn_mutexderived_new       mutex_fn_new;
     void (*on_rop_conf_requested)(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
     void (*on_rop_conf_received)(eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
+    uint16_t                            maxinflight;        // window of rops which wait for their ack/nak at the same time. if 0 the rops are not tracked
+    eOreltime_t                         timeout;            // time after which a rop without ack/nak is retransmitted. no timeout if eok_reltimeINFINITE 
+    uint8_t                             maxretransmissions; // after them, a rop without ack/nak is dropped and counted as timed out
+    uint16_t                            maxsizeofropdata;   // the bytes of data kept for the retransmission of each rop in flight
+    void*                               transceiver;        // points to a EOtransceiver. it is used for retransmissions 
 } eOconfman_cfg_t;
+
+
+typedef struct
+{
+    uint32_t                            requested;          // the tracked rops sent for the first time
+    uint32_t                            retransmissions;    
+    uint32_t                            acks;
+    uint32_t                            naks;
+    uint32_t                            timeouts;           // the rops dropped after the last retransmission
+    uint32_t                            unmatched;          // the ack/nak which do not match any rop in flight
+    eOreltime_t                         latencylast;        // the latency from first transmission to ack/nak of the last confirmed rop
+    eOreltime_t                         latencymin;
+    eOreltime_t                         latencymax;
+    uint64_t                            latencysum;         // the average latency is latencysum / (acks + naks)
+} eOconfman_stats_t;
  
 
     
@@ -105,6 +132,54 @@ extern eOresult_t eo_confman_Confirmation_Requested(EOconfirmationManager *p, eO
 extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
 
 
+/** @fn         extern eObool_t eo_confman_ConfirmationRequest_CanInsert(EOconfirmationManager *p, eOropdescriptor_t* ropdes)
+    @brief      tells if a rop with confirmation request can be sent now. it cannot if the window of rops in flight 
+                is full, unless the rop is a retransmission of one of them (same ropcode, id32 and signature).
+    @param      p           the object.
+    @param      ropdes      the rop.
+    @return     eobool_true if the rop can be sent.
+ **/
+extern eObool_t eo_confman_ConfirmationRequest_CanInsert(EOconfirmationManager *p, eOropdescriptor_t* ropdes);
+
+
+/** @fn         extern uint16_t eo_confman_InFlight_Number(EOconfirmationManager *p)
+    @brief      gives the number of rops which are waiting for their ack/nak. 
+    @param      p           the object.
+    @return     the number.
+ **/
+extern uint16_t eo_confman_InFlight_Number(EOconfirmationManager *p);
+
+
+/** @fn         extern eOresult_t eo_confman_Tick(EOconfirmationManager *p)
+    @brief      it must be called now and then to retransmit the rops in flight which have passed their timeout
+                or to drop them when they have been retransmitted cfg->maxretransmissions times. 
+    @param      p           the object.
+    @return     eores_NOK_nullpointer if p is NULL, or eores_OK.    
+ **/
+extern eOresult_t eo_confman_Tick(EOconfirmationManager *p);
+
+
+/** @fn         extern eOresult_t eo_confman_Stats_Get(EOconfirmationManager *p, eOconfman_stats_t *stats)
+    @brief      gives the statistics of the rops tracked since creation or since last eo_confman_Stats_Reset(). 
+    @param      p           the object.
+    @param      stats       the statistics.
+    @return     eores_NOK_nullpointer if any argument is NULL, or eores_OK.    
+ **/
+extern eOresult_t eo_confman_Stats_Get(EOconfirmationManager *p, eOconfman_stats_t *stats);
+
+extern eOresult_t eo_confman_Stats_Reset(EOconfirmationManager *p);
+
+
+/** @fn         extern uint32_t eo_confman_Footprint(EOconfirmationManager *p, uint16_t *mutexes)
+    @brief      computes the bytes of memory used by the object: itself, the vector of the requests and the slots of the
+                rops in flight with their data. 
+    @param      p           the object.
+    @param      mutexes     if not NULL, in output it contains the number of mutexes used by the object.
+    @return     the number of bytes, or 0 if p is NULL.    
+ **/
+extern uint32_t eo_confman_Footprint(EOconfirmationManager *p, uint16_t *mutexes);
+
+
 
 
 /** @}            
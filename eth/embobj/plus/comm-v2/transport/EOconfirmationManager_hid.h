@@ -47,6 +47,17 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+typedef struct
+{
+    eOropdescriptor_t   ropdes;                 // ropdes.data points to a slot of inflightdata or is NULL
+    eOabstime_t         firsttime;
+    eOabstime_t         deadline;
+    uint8_t             used;
+    uint8_t             retransmissions;
+    uint8_t             retransmittable;        // 0 if the data of the rop did not fit into its slot
+    uint8_t             pending;                // the sends of the rop which still wait for their ack/nak
+} eOconfman_inflight_t;
+
 
 
 /** @struct     EOconfirmationManager_hid
@@ -57,9 +68,15 @@ extern "C" {
  
 struct EOconfirmationManager_hid 
 {
-    eOconfman_cfg_t     config;
-    EOvector*           confrequests;
-    EOVmutexDerived*    mtx;
+    eOconfman_cfg_t         config;
+    EOvector*               confrequests;
+    EOVmutexDerived*        mtx;
+    eOconfman_inflight_t*   inflight;           // config.maxinflight items
+    uint8_t*                inflightdata;       // config.maxinflight slots of config.maxsizeofropdata bytes
+    uint16_t                inflightnumber;
+    eOconfman_stats_t       stats;
+    eOropdescriptor_t       retxropdes;         // used by eo_confman_Tick() to retransmit outside the mutex
+    uint8_t*                retxdata;
 }; 
 
 
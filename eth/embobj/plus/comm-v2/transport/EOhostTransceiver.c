@@ -98,6 +98,7 @@ const eOhosttransceiver_cfg_t eo_hosttransceiver_cfg_default =
     EO_INIT(.mutex_fn_new)              NULL,
     EO_INIT(.transprotection)           eo_trans_protection_none,
     EO_INIT(.nvsetprotection)           eo_nvset_protection_none,
+    EO_INIT(.nvsetinitmode)             eo_nvset_initmode_eager,
     EO_INIT(.confmancfg)                NULL,
     EO_INIT(.extfn)                         
     {
@@ -241,7 +242,10 @@ extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p)
 static EOnvSet* s_eo_hosttransceiver_nvset_get(const eOhosttransceiver_cfg_t *cfg)
 {
     EOnvSet* nvset = eo_nvset_New(cfg->nvsetprotection, cfg->mutex_fn_new);    
-    eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, cfg->remoteboardipv4addr, (eOnvset_BRDcfg_t*)cfg->nvsetbrdcfg, eobool_true);   
+    // with many boards the lazy mode avoids calling at startup the init of every nv of every board
+    eo_nvset_InitMode_Set(nvset, cfg->nvsetinitmode);
+    // boards with the same configuration of endpoints share its description: each nvset has only its own ram and mutexes
+    eo_nvset_InitBRD_LoadSharedEPs(nvset, eo_nvset_ownership_remote, cfg->remoteboardipv4addr, (eOnvset_BRDcfg_t*)cfg->nvsetbrdcfg, eobool_true);   
     return(nvset);
 }
  
@@ -74,6 +74,7 @@ typedef struct
     eov_mutex_fn_mutexderived_new   mutex_fn_new;    
     eOtransceiver_protection_t      transprotection;
     eOnvset_protection_t            nvsetprotection; 
+    eOnvset_initmode_t              nvsetinitmode;
     eOconfman_cfg_t*                confmancfg;
     eOtransceiver_extfn_t           extfn;
 } eOhosttransceiver_cfg_t;
@@ -92,6 +92,32 @@ EO_static_inline uint16_t s_eo_nv_get_size2(const EOnv *nv)
     return(nv->rom->capacity);   
 }
 
+// the wholeitem of an entity split by eoprot_config_endpoint_hotvariables() has no ram of its own: it is gathered from the entity
+EO_static_inline void s_eo_nv_ram_read(const EOnv *nv, void *dest)
+{
+    if(NULL != nv->ram)
+    {
+        memcpy(dest, nv->ram, nv->rom->capacity);
+    }
+    else
+    {
+        eoprot_variable_ram_read(nv->brd, nv->id32, dest);
+    }
+}
+
+// ... and it is scattered into the entity
+EO_static_inline void s_eo_nv_ram_write(const EOnv *nv, const void *dat)
+{
+    if(NULL != nv->ram)
+    {
+        memcpy(nv->ram, dat, nv->rom->capacity);
+    }
+    else
+    {
+        eoprot_variable_ram_write(nv->brd, nv->id32, dat);
+    }
+}
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -227,10 +253,9 @@ extern eOresult_t eo_nv_Get(const EOnv *nv, eOnvStorage_t strg, void *data, uint
     {
         case eo_nv_strg_volatile:
         {   // better to protect so that the copy is atomic and not interrupted by other tasks which write 
-            source = nv->ram;       
             *size = s_eo_nv_get_size2(nv);  
             eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-            memcpy(data, source, *size); 
+            s_eo_nv_ram_read(nv, data); 
             eov_mutex_Release(nv->mtx);
             res = eores_OK;
         } break;
@@ -360,7 +385,7 @@ extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eOboo
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest)
 {
     eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-    memcpy(dest, nv->ram, nv->rom->capacity);
+    s_eo_nv_ram_read(nv, dest);
     eov_mutex_Release(nv->mtx);    
 }
 
@@ -489,7 +514,14 @@ static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOn
 
     // copy data
     eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-    memcpy(dst, dat, size);
+    if(dst == nv->ram)
+    {
+        s_eo_nv_ram_write(nv, dat);
+    }
+    else
+    {
+        memcpy(dst, dat, size);
+    }
     eov_mutex_Release(nv->mtx);
 
     // call the update function if necessary
@@ -52,7 +52,19 @@
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
-#undef EO_NVSET_INIT_EVERY_NV
+#define EONVSET_SNAPSHOT_MAGIC          0x534e5645      // "EVNS" in little endian
+#define EONVSET_SNAPSHOT_VERSION        1
+#define EONVSET_SNAPSHOT_ALIGN4(n)      (((n)+3) & ~3)
+
+// the state of an entity is read without the init mutex, thus it is published with release and read with acquire, so that
+// whoever finds it initted also sees what its init functions wrote
+#if     defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#define EONVSET_LOAD_ACQUIRE(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define EONVSET_STORE_RELEASE(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define EONVSET_LOAD_ACQUIRE(p)         (*(p))
+#define EONVSET_STORE_RELEASE(p, v)     (*(p) = (v))
+#endif
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
@@ -65,7 +77,9 @@ static const EOconstvector s_eonvset_constvectofEPcfgBasic =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) &eoprot_mn_basicEPcfg,
-    EO_INIT(.functions)       NULL     
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.keyoffset)       0,
+    EO_INIT(.keymode)         0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgBasic =
@@ -82,7 +96,9 @@ static const EOconstvector s_eonvset_constvectofEPcfgMax =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) eoprot_arrayof_maxEPcfg,
-    EO_INIT(.functions)       NULL          
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.keyoffset)       0,
+    EO_INIT(.keymode)         0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgMax =
@@ -100,7 +116,9 @@ static const EOconstvector s_eonvset_constvectofEPcfgStd =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) eoprot_arrayof_stdEPcfg,
-    EO_INIT(.functions)       NULL          
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.keyoffset)       0,
+    EO_INIT(.keymode)         0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgStd =
@@ -114,20 +132,48 @@ const eOnvset_BRDcfg_t eonvset_BRDcfgStd =
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
+// the snapshot is: a eOnvset_snapshot_head_t, then for each endpoint a eOnvset_snapshot_ep_t followed by its ram padded to 4 bytes.
+// it does not contain pointers, thus it can be stored in a file and used by another process on the same architecture.
+typedef struct      // 12 bytes
+{
+    uint32_t                magic;
+    uint16_t                version;
+    uint8_t                 numberofendpoints;
+    uint8_t                 dummy;
+    uint32_t                size;               // the whole size of the snapshot
+} eOnvset_snapshot_head_t;  EO_VERIFYsizeof(eOnvset_snapshot_head_t, 12);
+
+typedef struct      // 12 bytes
+{
+    eOprot_EPcfg_t          epcfg;              // it is what eoprot_config_endpoint_entities() uses
+    uint16_t                sizeofram;
+    uint16_t                dummy;
+} eOnvset_snapshot_ep_t;    EO_VERIFYsizeof(eOnvset_snapshot_ep_t, 12);
 
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
 
-static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum);
+static eOresult_t s_eo_nvset_BRD_init(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum, eOnvset_layout_t* layout);
+static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum, eOnvset_layout_t* layout);
+static eOresult_t s_eo_nvset_endpoint_add(EOnvSet* p, const eOnvset_eplayout_t* eplayout, eObool_t initNVs);
+
+static eOnvset_layout_t* s_eo_nvset_layout_new(void);
+static eOnvset_layout_t* s_eo_nvset_layout_find(const EOconstvector* epcfg_constvect);
+static void s_eo_nvset_layout_release(eOnvset_layout_t* layout);
 
 static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoint, eOnvEP8_t ep08);
+static eObool_t s_eo_nvset_entity_hasinit(EOnvSet* p, eOnvEP8_t ep08, eOnvENT_t ent);
+static void s_eo_nvset_entity_initialise(EOnvSet* p, eOnvset_ep_t* theEndpoint, eOnvENT_t ent, uint8_t index);
+static eOresult_t s_eo_nvset_NV_load(EOnvSet* p, eOnvID32_t id32, EOnv* thenv);
+static EOVmutexDerived* s_eo_nvset_get_rammutex(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static EOVmutexDerived* s_eo_nvset_get_initmutex(EOnvSet* p, eOnvset_ep_t* theEndpoint);
 
 static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p);
 static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p);
 
-static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32);
+static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32, eOprotProgNumber_t prognum);
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8);
 uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 
@@ -136,7 +182,14 @@ uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOnvSet";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOnvSet";
+#endif
+
+// the layouts shared amongst boards. they are created and released only by eo_nvset_InitBRD_LoadSharedEPs() and by
+// eo_nvset_DeinitBRD(), which must not be called concurrently.
+static eOnvset_layout_t* s_eo_nvset_sharedlayouts = NULL;
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -155,11 +208,30 @@ extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderive
     p->theboard.ipaddress       = 0;    
     p->mtxderived_new           = mtxnew; 
     p->protection               = (NULL == mtxnew) ? (eo_nvset_protection_none) : (prot); 
+    p->initmode                 = eo_nvset_initmode_eager;
 
     return(p);
 }
 
 
+extern eOresult_t eo_nvset_InitMode_Set(EOnvSet* p, eOnvset_initmode_t mode)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != p->theboard.theendpoints)
+    {   // it must be called before the board is initted
+        return(eores_NOK_generic);
+    }
+    
+    p->initmode = mode;
+    
+    return(eores_OK);
+}
+
+
 extern void eo_nvset_Delete(EOnvSet* p)
 {   
     if(NULL == p)
@@ -176,6 +248,13 @@ extern void eo_nvset_Delete(EOnvSet* p)
 }
 
 extern eOresult_t eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum)
+{
+    // the board gets a layout of its own which grows with eo_nvset_LoadEP()
+    return(s_eo_nvset_BRD_init(p, ownership, ipaddress, brdnum, NULL));
+}
+
+
+static eOresult_t s_eo_nvset_BRD_init(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum, eOnvset_layout_t* layout)
 {
 //    eOresult_t res = eores_NOK_generic;   
     if(NULL == p)
@@ -206,7 +285,7 @@ extern eOresult_t eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOi
         }
     }    
     
-    if(eores_OK != s_eo_nvset_InitBRD(p, ownership, ipaddress, brdnum))
+    if(eores_OK != s_eo_nvset_InitBRD(p, ownership, ipaddress, brdnum, layout))
     {
         return(eores_NOK_generic);
     }
@@ -270,6 +349,51 @@ extern eOresult_t eo_nvset_InitBRD_LoadEPs(EOnvSet* p, eOnvsetOwnership_t owners
 }
 
 
+extern eOresult_t eo_nvset_InitBRD_LoadSharedEPs(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvset_BRDcfg_t* cfgofbrd, eObool_t initNVs)
+{
+    eOnvset_layout_t* layout = NULL;
+    uint16_t nendpoints = 0;
+    uint16_t i = 0;
+    
+    if((NULL == p) || (NULL == cfgofbrd) || (NULL == cfgofbrd->epcfg_constvect))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    layout = s_eo_nvset_layout_find(cfgofbrd->epcfg_constvect);
+    
+    if(NULL == layout)
+    {   // the first board with this configuration builds the layout in the usual way and then shares it
+        if(eores_OK != eo_nvset_InitBRD_LoadEPs(p, ownership, ipaddress, cfgofbrd, initNVs))
+        {
+            return(eores_NOK_generic);
+        }
+        
+        layout = p->theboard.layout;
+        layout->epcfg_constvect = cfgofbrd->epcfg_constvect;
+        layout->next = s_eo_nvset_sharedlayouts;
+        s_eo_nvset_sharedlayouts = layout;
+        
+        return(eores_OK);
+    }
+    
+    // the other boards just reference the layout and get their own ram and mutexes
+    if(eores_OK != s_eo_nvset_BRD_init(p, ownership, ipaddress, cfgofbrd->boardnum, layout))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    nendpoints = eo_vector_Size(layout->theendpoints);
+    for(i=0; i<nendpoints; i++)
+    {
+        eOnvset_eplayout_t** ppeplayout = (eOnvset_eplayout_t**) eo_vector_At(layout->theendpoints, i);
+        s_eo_nvset_endpoint_add(p, *ppeplayout, initNVs);
+    }
+    
+    return(eores_OK);     
+}
+
+
 extern eOresult_t eo_nvset_DeinitBRD(EOnvSet* p)
 {   
     if(NULL == p)
@@ -302,6 +426,9 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
 {
     eOnvset_brd_t* theBoard = NULL;
     eOnvset_ep_t* theEndpoint = endpoint;
+    const eOnvset_eplayout_t* eplayout = NULL;
+    eOnvENT_t ent = 0;
+    uint8_t index = 0;
 
     eOvoid_fp_uint32_voidp_t initialise = NULL;
     
@@ -331,7 +458,25 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
     if(eobool_true == (theEndpoint->initted))
     {   // already initted
         return(eores_OK);
-    }            
+    }  
+    
+    eplayout = theEndpoint->layout;
+    
+    // in lazy mode, the entities whose variables dont have any init function just get their default value with a memcpy of the 
+    // whole entity, whatever the layout of the ram. it is done before the initialiser of the endpoint, so that the initialiser 
+    // can change them. the eager mode keeps the ram as the initialiser and the init functions leave it
+    for(ent=0; (eo_nvset_initmode_lazy == p->initmode) && (ent<=eoprot_maxvalueof_entity); ent++)
+    {
+        const void* defval = eoprot_entity_defaultvalue_get(ep08, ent);
+        if((0 == eplayout->epcfg.numberofentities[ent]) || (NULL == defval) || (eobool_true == s_eo_nvset_entity_hasinit(p, ep08, ent)))
+        {
+            continue;
+        }
+        for(index=0; index<eplayout->epcfg.numberofentities[ent]; index++)
+        {
+            eoprot_entity_ram_write(theBoard->boardnum, ep08, ent, index, defval);
+        }
+    }
 
     initialise = eoprot_endpoint_get_initialiser(ep08);
     
@@ -342,81 +487,90 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
     
     theEndpoint->initted = eobool_true;
     
+    // the init functions are called now or, in lazy mode, at the first eo_nvset_NV_Get() on the entity
+    if(eo_nvset_initmode_lazy != p->initmode)
+    {
+        for(ent=0; ent<=eoprot_maxvalueof_entity; ent++)
+        {
+            for(index=0; index<eplayout->epcfg.numberofentities[ent]; index++)
+            {
+                s_eo_nvset_entity_initialise(p, theEndpoint, ent, index);
+            }
+        }
+    }
+    
+    return(eores_OK);    
+}
 
-#define EO_NVSET_INIT_EVERY_NV
-#if defined(EO_NVSET_INIT_EVERY_NV)
-    {   // put parenthesis to create a new scope and avoid errors in non c99 environments as windows
-        EOnv thenv = {0};
-        uint16_t k = 0;
-        EOnv_rom_t* rom = NULL;
-        uint8_t* ram = NULL;
-        uint16_t nvars = theEndpoint->epnvsnumberof;
-        eOipv4addr_t ip = theBoard->ipaddress;
-        uint8_t brd =  theBoard->boardnum; // local or 0, 1, 2, 3
-        eOnvID32_t id32 = EOK_uint32dummy;     
-        uint32_t prog = 0;
-        eObool_t proxied = eobool_false;
-        eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
-        
-        EOVmutexDerived* mtx2use = NULL;
 
-        if(eo_nvset_protection_one_per_board == p->protection)
-        {
-            mtx2use = theBoard->mtx_board;
+static eObool_t s_eo_nvset_entity_hasinit(EOnvSet* p, eOnvEP8_t ep08, eOnvENT_t ent)
+{   // the rom of a variable is the same for every instance of its entity, thus we look only at the first one
+    eOnvBRD_t brd = p->theboard.boardnum;
+    eOnvID32_t id32 = EOK_uint32dummy;
+    const EOnv_rom_t* rom = NULL;
+    uint8_t tag = 0;
+    
+    for(tag=0; ; tag++)
+    {
+        id32 = eoprot_ID_get(ep08, ent, 0, tag);
+        if(eobool_false == eoprot_id_isvalid(brd, id32))
+        {   // no more tags
+            return(eobool_false);
         }
-        else if(eo_nvset_protection_one_per_endpoint == p->protection)
+        rom = (const EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
+        if((NULL != rom) && (NULL != rom->init))
         {
-            mtx2use = theEndpoint->mtx_endpoint;
+            return(eobool_true);
         }
-        // else if eo_nvset_protection_one_per_netvar ... eval foreach k
+    }
+}
 
-        for(k=0; k<nvars; k++)
+
+static void s_eo_nvset_entity_initialise(EOnvSet* p, eOnvset_ep_t* theEndpoint, eOnvENT_t ent, uint8_t index)
+{
+    const eOnvset_eplayout_t* eplayout = theEndpoint->layout;
+    eOnvBRD_t brd = p->theboard.boardnum;
+    eOnvEP8_t ep08 = eplayout->epcfg.endpoint;
+    uint16_t instance = eplayout->entityoffset[ent] + index;
+    EOVmutexDerived* mtx = NULL;
+    
+    if(eo_nvset_entity_initted == EONVSET_LOAD_ACQUIRE(&theEndpoint->entitiesinitted[instance]))
+    {   // already initted
+        return;
+    }
+    
+    // the entity is marked as initted only when its init functions are over. the mutex makes any other task wait for it. 
+    // it is recursive, thus the init functions can use eo_nvset_NV_Get() on the same entity: they find it initialising 
+    // and they do not init it again
+    mtx = s_eo_nvset_get_initmutex(p, theEndpoint);
+    eov_mutex_Take(mtx, eok_reltimeINFINITE);
+    
+    if(eo_nvset_entity_notinitted == EONVSET_LOAD_ACQUIRE(&theEndpoint->entitiesinitted[instance]))
+    {   // we call the init function of each variable of the entity. we look for it only now and not when the endpoint is
+        // loaded, so that we also call those installed later with eoprot_config_callbacks_variable_set()
+        EOnv thenv = {0};
+        eOnvID32_t id32 = EOK_uint32dummy;
+        uint8_t tag = 0;
+        
+        EONVSET_STORE_RELEASE(&theEndpoint->entitiesinitted[instance], eo_nvset_entity_initialising);
+        
+        for(tag=0; ; tag++)
         {
-            if(eo_nvset_protection_one_per_netvar == p->protection)
-            {
-                //#warning -> think of uint32 and void* maybe use uint64
-                uint32_t** addr = eo_vector_At(theEndpoint->themtxofthenvs, k);
-                mtx2use = (EOVmutexDerived*) (*addr);
+            id32 = eoprot_ID_get(ep08, ent, index, tag);
+            if(eobool_false == eoprot_id_isvalid(brd, id32))
+            {   // no more tags
+                break;
             }
-            
-            prog = k;
-            // - 0. the id32 
-            id32 = eoprot_endpoint_prognum2id(brd, ep08, prog);               
-            if(EOK_uint32dummy == id32)
+            if(eores_OK == s_eo_nvset_NV_load(p, id32, &thenv))
             {
-                continue;
+                eo_nv_Init(&thenv);
             }
-
-            // - 0+. proxied?
-            proxied = eoprot_variable_is_proxied(brd, id32);                
-            // - 0++ onsay
-            onsay = eoprot_onsay_endpoint_get(ep08); 
-            // - 1. the rom
-            rom = (EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
-            // - 2. the ram
-            ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
-            // - 3. the mtx
-            mtx2use = mtx2use;
-            // - load everything into the nv
-            eo_nv_hid_Load(     &thenv,
-                                ip, 
-                                brd,
-                                proxied,
-                                id32,
-                                onsay,
-                                rom,
-                                ram,
-                                mtx2use
-                          );                    
-            
-         
-            eo_nv_Init(&thenv);                             
         }
-    }   // put parenthesis to create a new scope and avoid errors in non c99 environments as windows
-#endif //EO_NVSET_INIT_EVERY_NV                   
-
+        
+        EONVSET_STORE_RELEASE(&theEndpoint->entitiesinitted[instance], eo_nvset_entity_initted);
+    }
     
-    return(eores_OK);    
+    eov_mutex_Release(mtx);
 }
   
 
@@ -437,7 +591,7 @@ extern eOresult_t eo_nvset_NVSinitialise(EOnvSet* p)
     for(j=0; j<nendpoints; j++)
     {
         eOnvset_ep_t** theEndpoint = (eOnvset_ep_t**) eo_vector_At(theBoard->theendpoints, j);                        
-        s_eo_nvset_NVsOfEP_Initialise(p, (*theEndpoint), (*theEndpoint)->epcfg.endpoint);
+        s_eo_nvset_NVsOfEP_Initialise(p, (*theEndpoint), (*theEndpoint)->layout->epcfg.endpoint);
     }       
 
     return(eores_OK);
@@ -487,6 +641,178 @@ extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32)
 }
 
 
+extern uint32_t eo_nvset_Snapshot_Size(EOnvSet* p)
+{
+    uint32_t size = sizeof(eOnvset_snapshot_head_t);
+    uint16_t nendpoints = 0;
+    uint16_t i = 0;
+    
+    if((NULL == p) || (NULL == p->theboard.theendpoints))
+    {
+        return(0);
+    }
+    
+    nendpoints = eo_vector_Size(p->theboard.theendpoints);
+    for(i=0; i<nendpoints; i++)
+    {
+        eOnvset_ep_t** ppep = (eOnvset_ep_t**) eo_vector_At(p->theboard.theendpoints, i);
+        size += sizeof(eOnvset_snapshot_ep_t) + EONVSET_SNAPSHOT_ALIGN4((*ppep)->layout->sizeofram);
+    }
+    
+    return(size);
+}
+
+
+extern eOresult_t eo_nvset_Snapshot_Save(EOnvSet* p, void* blob, uint32_t capacity, uint32_t* size)
+{
+    eOnvset_snapshot_head_t head = {0};
+    eOnvset_snapshot_ep_t rec = {0};
+    uint8_t* dest = (uint8_t*)blob;
+    uint16_t nendpoints = 0;
+    uint16_t i = 0;
+    
+    if((NULL == p) || (NULL == blob) || (NULL == size))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    *size = eo_nvset_Snapshot_Size(p);
+    if((0 == *size) || (*size > capacity))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    nendpoints = eo_vector_Size(p->theboard.theendpoints);
+    
+    head.magic              = EONVSET_SNAPSHOT_MAGIC;
+    head.version            = EONVSET_SNAPSHOT_VERSION;
+    head.numberofendpoints  = (uint8_t)nendpoints;
+    head.size               = *size;
+    memcpy(dest, &head, sizeof(head));
+    dest += sizeof(head);
+    
+    for(i=0; i<nendpoints; i++)
+    {
+        eOnvset_ep_t* theEndpoint = *((eOnvset_ep_t**) eo_vector_At(p->theboard.theendpoints, i));
+        EOVmutexDerived* mtx = s_eo_nvset_get_rammutex(p, theEndpoint);
+        uint16_t sizeofram = theEndpoint->layout->sizeofram;
+        
+        memcpy(&rec.epcfg, &theEndpoint->layout->epcfg, sizeof(eOprot_EPcfg_t));
+        rec.sizeofram = sizeofram;
+        memcpy(dest, &rec, sizeof(rec));
+        dest += sizeof(rec);
+        
+        eov_mutex_Take(mtx, eok_reltimeINFINITE);
+        memcpy(dest, theEndpoint->epram, sizeofram);
+        eov_mutex_Release(mtx);
+        memset(dest + sizeofram, 0, EONVSET_SNAPSHOT_ALIGN4(sizeofram) - sizeofram);
+        dest += EONVSET_SNAPSHOT_ALIGN4(sizeofram);
+    }
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_Snapshot_Restore(EOnvSet* p, const void* blob, uint32_t size, uint32_t* used)
+{
+    eOnvset_snapshot_head_t head = {0};
+    eOnvset_snapshot_ep_t rec = {0};
+    const uint8_t* orig = (const uint8_t*)blob;
+    uint32_t pos = 0;
+    uint16_t i = 0;
+    eObool_t loadendpoints = eobool_false;
+    
+    if((NULL == p) || (NULL == blob))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((NULL == p->theboard.theendpoints) || (size < sizeof(head)))
+    {   // the board must be initted at least with eo_nvset_InitBRD()
+        return(eores_NOK_generic);
+    }
+    
+    memcpy(&head, orig, sizeof(head));
+    if((EONVSET_SNAPSHOT_MAGIC != head.magic) || (EONVSET_SNAPSHOT_VERSION != head.version) || (head.size > size))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // if the board does not have any endpoint yet, it takes them from the snapshot. else they must be the same
+    loadendpoints = ((0 == eo_vector_Size(p->theboard.theendpoints)) && (NULL == p->theboard.layout->epcfg_constvect)) ? (eobool_true) : (eobool_false);
+    
+    // at first we verify everything, so that in case of errors we dont change the board
+    pos = sizeof(head);
+    for(i=0; i<head.numberofendpoints; i++)
+    {
+        if((pos + sizeof(rec)) > head.size)
+        {
+            return(eores_NOK_generic);
+        }
+        memcpy(&rec, orig + pos, sizeof(rec));
+        pos += sizeof(rec) + EONVSET_SNAPSHOT_ALIGN4(rec.sizeofram);
+        if(pos > head.size)
+        {
+            return(eores_NOK_generic);
+        }
+        
+        if(eobool_false == loadendpoints)
+        {
+            eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, rec.epcfg.endpoint);
+            if((NULL == theEndpoint) || (rec.sizeofram != theEndpoint->layout->sizeofram) || (0 != memcmp(&rec.epcfg, &theEndpoint->layout->epcfg, sizeof(eOprot_EPcfg_t))))
+            {
+                return(eores_NOK_generic);
+            }
+        }
+    }
+    
+    // then we load the endpoints if needed, we initialise them in full and at last we overwrite their ram 
+    pos = sizeof(head);
+    for(i=0; i<head.numberofendpoints; i++)
+    {
+        eOnvset_ep_t* theEndpoint = NULL;
+        EOVmutexDerived* mtx = NULL;
+        eOnvENT_t ent = 0;
+        uint8_t index = 0;
+        
+        memcpy(&rec, orig + pos, sizeof(rec));
+        pos += sizeof(rec);
+        
+        if(eobool_true == loadendpoints)
+        {
+            eo_nvset_LoadEP(p, &rec.epcfg, eobool_false);
+        }
+        
+        theEndpoint = s_eo_nvset_get_endpoint(p, rec.epcfg.endpoint);
+        if((NULL != theEndpoint) && (rec.sizeofram == theEndpoint->layout->sizeofram))
+        {
+            s_eo_nvset_NVsOfEP_Initialise(p, theEndpoint, rec.epcfg.endpoint);
+            for(ent=0; ent<=eoprot_maxvalueof_entity; ent++)
+            {
+                for(index=0; index<theEndpoint->layout->epcfg.numberofentities[ent]; index++)
+                {
+                    s_eo_nvset_entity_initialise(p, theEndpoint, ent, index);
+                }
+            }
+            
+            mtx = s_eo_nvset_get_rammutex(p, theEndpoint);
+            eov_mutex_Take(mtx, eok_reltimeINFINITE);
+            memcpy(theEndpoint->epram, orig + pos, rec.sizeofram);
+            eov_mutex_Release(mtx);
+        }
+        
+        pos += EONVSET_SNAPSHOT_ALIGN4(rec.sizeofram);
+    }
+    
+    if(NULL != used)
+    {
+        *used = head.size;
+    }
+    
+    return(eores_OK);
+}
+
+
 extern eOresult_t eo_nvset_BRD_Get(EOnvSet* p, eOnvBRD_t* brd)
 { 
     if((NULL == p) || (NULL == brd)) 
@@ -501,12 +827,92 @@ extern eOresult_t eo_nvset_BRD_Get(EOnvSet* p, eOnvBRD_t* brd)
 
 
 extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
+{
+    if((NULL == p) || (NULL == thenv)) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    if(eo_nvset_initmode_lazy == p->initmode)
+    {   // the first access to an entity initialises it
+        eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, eoprot_ID2endpoint(id32));
+        eOnvENT_t ent = eoprot_ID2entity(id32);
+        uint8_t index = eoprot_ID2index(id32);
+        // the full validation of id32 is done later by s_eo_nvset_NV_load(): here we just need an existing entity
+        if((NULL != theEndpoint) && (eobool_true == theEndpoint->initted) && (ent <= eoprot_maxvalueof_entity) && (index < theEndpoint->layout->epcfg.numberofentities[ent]))
+        {
+            if(eo_nvset_entity_initted != EONVSET_LOAD_ACQUIRE(&theEndpoint->entitiesinitted[theEndpoint->layout->entityoffset[ent] + index]))
+            {
+                s_eo_nvset_entity_initialise(p, theEndpoint, ent, index);
+            }
+        }
+    }
+    
+    return(s_eo_nvset_NV_load(p, id32, thenv));
+}
+
+
+extern eOresult_t eo_nvset_Footprint_Get(EOnvSet* p, eOnvset_footprint_t* footprint)
+{
+    eOnvset_brd_t* theBoard = NULL;
+    uint16_t i = 0;
+    
+    if((NULL == p) || (NULL == footprint)) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    memset(footprint, 0, sizeof(eOnvset_footprint_t));
+    footprint->descriptors = sizeof(EOnvSet);
+    
+    theBoard = &p->theboard;
+    
+    if(NULL == theBoard->theendpoints)
+    {   // the board is not initted yet
+        return(eores_OK);
+    }
+    
+    footprint->endpoints = eo_vector_Size(theBoard->theendpoints);
+    footprint->descriptors += eo_vector_Footprint(theBoard->theendpoints);
+    footprint->mutexes += (NULL == theBoard->mtx_board) ? (0) : (1);
+    
+    for(i=0; i<footprint->endpoints; i++)
+    {
+        eOnvset_ep_t* theEndpoint = *((eOnvset_ep_t**) eo_vector_At(theBoard->theendpoints, i));
+        
+        footprint->ram += theEndpoint->layout->sizeofram;
+        footprint->descriptors += sizeof(eOnvset_ep_t) + theEndpoint->layout->numberofinstances + eo_vector_Footprint(theEndpoint->themtxofthenvs);
+        footprint->mutexes += (NULL == theEndpoint->mtx_endpoint) ? (0) : (1);
+        footprint->mutexes += (NULL == theEndpoint->themtxofthenvs) ? (0) : (eo_vector_Size(theEndpoint->themtxofthenvs));
+    }
+    
+    if(NULL != theBoard->layout)
+    {
+        footprint->layout = sizeof(eOnvset_layout_t) + eo_vector_Footprint(theBoard->layout->theendpoints);
+        footprint->layout += eo_vector_Size(theBoard->layout->theendpoints)*sizeof(eOnvset_eplayout_t);
+    }
+    
+    return(eores_OK);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static eOresult_t s_eo_nvset_NV_load(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
 {
     eOnvEP8_t ep8 = eoprot_ID2endpoint(id32); 
     uint8_t brd = 0; // local, or 0, 1, 2, 3 ...
-    eObool_t proxied = eobool_false;
-    EOnv_rom_t* rom = NULL;
-    uint8_t* ram = NULL;
+    eOprot_variable_descriptor_t des = {0};
     EOVmutexDerived* mtx2use = NULL;
     eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
  
@@ -517,42 +923,44 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
 
     brd = p->theboard.boardnum;
     
-    // - verify that on the given endpoint there is a valid id32. if the id32 is not recognised, then ... eores_NOK_generic
-    if(eobool_false == eoprot_id_isvalid(brd, id32))
+    // - verify that on the given endpoint there is a valid id32 and retrieve in one pass its ram, rom, proxied flag and progressive number. 
+    //   if the id32 is not recognised, then ... eores_NOK_generic
+    if(eores_OK != eoprot_variable_descriptor_get(brd, id32, &des))
     {
         return(eores_NOK_generic);       
     }
     
-    // - retrieve from the device and endpoint what is required to form the netvar: con, ram, mtx, etc.   
-    // - 0+. proxied? 
-    proxied = eoprot_variable_is_proxied(brd, id32);
-    // - 0++. the onsay function
+    // - retrieve from the endpoint what is required to form the netvar: onsay, mtx   
     onsay = eoprot_onsay_endpoint_get(ep8);   
-    // - 1. the rom
-    rom = (EOnv_rom_t*) eoprot_variable_romof_get(brd, id32);
-    // - 2. the ram
-    ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
-    // - 3. the mtx
-    mtx2use = s_eo_nvset_get_nvmutex(p, id32);
+    mtx2use = s_eo_nvset_get_nvmutex(p, id32, des.prognum);
         
-    // - final control about the validity of id32. it may be redundant but it is safer. for instance if the fptr_isepidsupported()
-    //   does not take into account a removed tag and just checks that the tag-number is lower than the max allowed.
+    // - final control about the validity of id32. the ram is NULL if the endpoint has no ram or if the variable is the wholeitem 
+    //   of an entity split by eoprot_config_endpoint_hotvariables(). the EOnv gathers and scatters the latter.
     
-    if((NULL == rom) || (NULL == ram))  // mtx2use can be NULL
+    if(NULL == des.rom)  // mtx2use can be NULL
     {
         return(eores_NOK_generic); 
     }
     
+    if(NULL == des.ram)
+    {
+        eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+        if((NULL == theEndpoint) || (NULL == theEndpoint->epram) || (des.size != eoprot_entity_sizeof_get(brd, ep8, eoprot_ID2entity(id32))))
+        {
+            return(eores_NOK_generic); 
+        }
+    }
+    
 
     // - load everything into the nv
     eo_nv_hid_Load(     thenv,
                         p->theboard.ipaddress,
                         brd,
-                        proxied,
+                        des.proxied,
                         id32,  
                         onsay,
-                        rom,
-                        ram,
+                        (EOnv_rom_t*)des.rom,
+                        des.ram,
                         mtx2use
                   );    
 
@@ -560,19 +968,7 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
 }
 
 
-
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of extern hidden functions 
-// --------------------------------------------------------------------------------------------------------------------
-
-
-
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of static functions 
-// --------------------------------------------------------------------------------------------------------------------
-
-
-static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum)
+static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum, eOnvset_layout_t* layout)
 {
     eOnvset_brd_t *theBoard = NULL;
  	if(NULL == p) 
@@ -592,14 +988,15 @@ static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, e
     theBoard->ownership             = ownership;
     theBoard->theendpoints          = eo_vector_New(sizeof(eOnvset_ep_t*), eo_vectorcapacity_dynamic, NULL, 0, NULL, NULL);    
     theBoard->mtx_board             = (eo_nvset_protection_one_per_board == p->protection) ? p->mtxderived_new() : NULL;
-    // reset the ep2indexlut to have all values EOK_uint16dummy
+    
+    if(NULL == layout)
+    {   
+        theBoard->layout            = s_eo_nvset_layout_new();
+    }
+    else
     {
-        uint8_t i = 0;
-        const uint8_t lutsize = eonvset_max_endpoint_value+1;
-        for(i=0; i<lutsize; i++)
-        {
-            theBoard->ep2indexlut[i] = EOK_uint16dummy;
-        }
+        theBoard->layout            = layout;
+        theBoard->layout->references ++;
     }
 
     return(eores_OK);
@@ -619,6 +1016,10 @@ static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p)
         eov_mutex_Delete(theBoard->mtx_board);
     }
     
+    // the layout is deleted only if no other board uses it
+    s_eo_nvset_layout_release(theBoard->layout);
+    theBoard->layout = NULL;
+    
     
     // so that we know that everything is deinitted
     p->theboard.ipaddress = 0;
@@ -630,80 +1031,190 @@ static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p)
 
 extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t initNVs)
 {
-    eOnvset_brd_t* theBoard = NULL;
+    eOnvset_layout_t* layout = NULL;
     eOnvBRD_t brd = 0;      // local or 0, 1, 2, etc.
-    eOnvset_ep_t *theEndpoint = NULL;
-    uint16_t epnvsnumberof = 0;  
-    uint16_t sizeofram =0;
+    eOnvset_eplayout_t *eplayout = NULL;
  
     if((NULL == p) || (NULL == cfgofep)) 
     {
         return(eores_NOK_nullpointer); 
     }
         
-        
-    theBoard = &p->theboard;
+    layout = p->theboard.layout;
     brd = p->theboard.boardnum;
+    
+    if((NULL == layout) || (NULL != layout->epcfg_constvect))
+    {   // the board is not initted yet or it uses a shared layout, which cannot change
+        return(eores_NOK_generic);
+    }
         
-    theEndpoint = eo_mempool_New(eo_mempool_GetHandle(), 1*sizeof(eOnvset_ep_t));
+    eplayout = eo_mempool_New(eo_mempool_GetHandle(), 1*sizeof(eOnvset_eplayout_t));
     
-    memcpy(&theEndpoint->epcfg, cfgofep, sizeof(eOprot_EPcfg_t));   
+    memcpy(&eplayout->epcfg, cfgofep, sizeof(eOprot_EPcfg_t));   
     
-    // ok, now in theEndpoint->epcfg.numberofsentities[] we have some ram. we use it to load the protocol.
-    eoprot_config_endpoint_entities(brd, theEndpoint->epcfg.endpoint, theEndpoint->epcfg.numberofentities);
+    // ok, now in eplayout->epcfg.numberofsentities[] we have some ram. we use it to load the protocol.
+    eoprot_config_endpoint_entities(brd, eplayout->epcfg.endpoint, eplayout->epcfg.numberofentities);
     // now it is ok to compute the size of the endpoint using the proper protocol function
-    sizeofram = eoprot_endpoint_sizeof_get(brd, theEndpoint->epcfg.endpoint); 
+    eplayout->sizeofram = eoprot_endpoint_sizeof_get(brd, eplayout->epcfg.endpoint); 
     
     // now that i have loaded  the number of entities i verify if they are ok by checking the number of variables in the endpoint.
-    epnvsnumberof = eoprot_endpoint_numberofvariables_get(brd, cfgofep->endpoint);   
-    if(0 == epnvsnumberof)
+    eplayout->epnvsnumberof = eoprot_endpoint_numberofvariables_get(brd, cfgofep->endpoint);   
+    if(0 == eplayout->epnvsnumberof)
     {
         //#warning TBD: see how we continue in here ....
         char str[64] = {0};
         snprintf(str, sizeof(str), "EOnvSet: ep %d has 0 nvs", cfgofep->endpoint);  
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, str, NULL, &eo_errman_DescrRuntimeErrorLocal); 
         
-        eoprot_config_endpoint_entities(brd, theEndpoint->epcfg.endpoint, NULL);
-        eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint); 
+        eoprot_config_endpoint_entities(brd, eplayout->epcfg.endpoint, NULL);
+        eo_mempool_Delete(eo_mempool_GetHandle(), eplayout); 
         
         return(eores_NOK_generic); 
     }  
     
-    theEndpoint->epnvsnumberof      = epnvsnumberof;
+    // the entities are initialised one by one: each has its offset inside the states of the endpoint
+    {
+        eOnvENT_t ent = 0;
+        
+        eplayout->numberofinstances = 0;
+        for(ent=0; ent<=eoprot_maxvalueof_entity; ent++)
+        {
+            eplayout->entityoffset[ent] = eplayout->numberofinstances;
+            eplayout->numberofinstances += eplayout->epcfg.numberofentities[ent];
+        }
+    }
+    
+    // now, i must update the mapping function from ep value to vector of endpoints. the endpoints of the board have the same order
+    layout->ep2indexlut[eplayout->epcfg.endpoint] = eo_vector_Size(layout->theendpoints);
+    // and only now i push back the endpoint
+    eo_vector_PushBack(layout->theendpoints, &eplayout);
+    
+    return(s_eo_nvset_endpoint_add(p, eplayout, initNVs));
+}
+
+
+static eOresult_t s_eo_nvset_endpoint_add(EOnvSet* p, const eOnvset_eplayout_t* eplayout, eObool_t initNVs)
+{
+    eOnvset_brd_t* theBoard = &p->theboard;
+    eOnvBRD_t brd = theBoard->boardnum;
+    eOnvset_ep_t *theEndpoint = NULL;
+    
+    theEndpoint = eo_mempool_New(eo_mempool_GetHandle(), 1*sizeof(eOnvset_ep_t));
+    
+    theEndpoint->layout             = eplayout;
     theEndpoint->initted            = eobool_false;    
-    theEndpoint->epram              = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
+    theEndpoint->epram              = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, eplayout->sizeofram, 1);
     theEndpoint->mtx_endpoint       = (eo_nvset_protection_one_per_endpoint == p->protection) ? p->mtxderived_new() : NULL;
-        
+    theEndpoint->entitiesinitted    = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, eplayout->numberofinstances, 1);
+    memset((void*)theEndpoint->entitiesinitted, eo_nvset_entity_notinitted, eplayout->numberofinstances);
+    
+    if((eo_nvset_protection_one_per_netvar == p->protection) && (eo_nvset_initmode_lazy == p->initmode))
+    {   // the lazy initialisation of an entity needs one mutex for all its nvs
+        theEndpoint->mtx_endpoint = p->mtxderived_new();
+    }
+    
+    // the numbers of entities are kept by the layout: the boards which share it also share them
+    eoprot_config_endpoint_entities(brd, eplayout->epcfg.endpoint, eplayout->epcfg.numberofentities);
     // now we must load the ram in the endpoint
-    eoprot_config_endpoint_ram(brd, theEndpoint->epcfg.endpoint, theEndpoint->epram, sizeofram);
+    eoprot_config_endpoint_ram(brd, eplayout->epcfg.endpoint, theEndpoint->epram, eplayout->sizeofram);
     
     // now add the vector of mtx if needed.
     if(eo_nvset_protection_one_per_netvar == p->protection)
     {
         uint16_t i;
-        theEndpoint->themtxofthenvs = eo_vector_New(sizeof(EOVmutexDerived*), epnvsnumberof, NULL, 0, NULL, NULL);
-        for(i=0; i<epnvsnumberof; i++)
+        theEndpoint->themtxofthenvs = eo_vector_New(sizeof(EOVmutexDerived*), eplayout->epnvsnumberof, NULL, 0, NULL, NULL);
+        for(i=0; i<eplayout->epnvsnumberof; i++)
         {
             EOVmutexDerived* mtx = p->mtxderived_new();
             eo_vector_PushBack(theEndpoint->themtxofthenvs, &mtx);           
         }
     }
     
-    // now, i must update the mapping function from ep value to vector of endpoints  
-    theBoard->ep2indexlut[theEndpoint->epcfg.endpoint] = eo_vector_Size(theBoard->theendpoints);
-    // and only now i push back the endpoint
     eo_vector_PushBack(theBoard->theendpoints, &theEndpoint);
     
-    
     if(eobool_true == initNVs)
     {
-        s_eo_nvset_NVsOfEP_Initialise(p, theEndpoint, theEndpoint->epcfg.endpoint); 
+        s_eo_nvset_NVsOfEP_Initialise(p, theEndpoint, eplayout->epcfg.endpoint); 
     }
 
     return(eores_OK);
 }
 
 
+static eOnvset_layout_t* s_eo_nvset_layout_new(void)
+{
+    eOnvset_layout_t* layout = eo_mempool_New(eo_mempool_GetHandle(), 1*sizeof(eOnvset_layout_t));
+    uint8_t i = 0;
+    const uint8_t lutsize = eonvset_max_endpoint_value+1;
+    
+    layout->epcfg_constvect = NULL;
+    layout->references      = 1;
+    layout->theendpoints    = eo_vector_New(sizeof(eOnvset_eplayout_t*), eo_vectorcapacity_dynamic, NULL, 0, NULL, NULL);
+    layout->next            = NULL;
+    // reset the ep2indexlut to have all values EOK_uint16dummy
+    for(i=0; i<lutsize; i++)
+    {
+        layout->ep2indexlut[i] = EOK_uint16dummy;
+    }
+    
+    return(layout);
+}
+
+
+static eOnvset_layout_t* s_eo_nvset_layout_find(const EOconstvector* epcfg_constvect)
+{
+    eOnvset_layout_t* layout = s_eo_nvset_sharedlayouts;
+    
+    while((NULL != layout) && (epcfg_constvect != layout->epcfg_constvect))
+    {
+        layout = layout->next;
+    }
+    
+    return(layout);
+}
+
+
+static void s_eo_nvset_layout_release(eOnvset_layout_t* layout)
+{
+    uint16_t i = 0;
+    uint16_t size = 0;
+    
+    if(NULL == layout)
+    {
+        return;
+    }
+    
+    layout->references --;
+    if(0 != layout->references)
+    {   // some other board still uses it
+        return;
+    }
+    
+    if(NULL != layout->epcfg_constvect)
+    {   // remove it from the shared layouts
+        eOnvset_layout_t** pp = &s_eo_nvset_sharedlayouts;
+        while((NULL != *pp) && (layout != *pp))
+        {
+            pp = &((*pp)->next);
+        }
+        if(NULL != *pp)
+        {
+            *pp = layout->next;
+        }
+    }
+    
+    size = eo_vector_Size(layout->theendpoints);
+    for(i=0; i<size; i++)
+    {
+        eOnvset_eplayout_t** ppeplayout = (eOnvset_eplayout_t**) eo_vector_At(layout->theendpoints, i);
+        eo_mempool_Delete(eo_mempool_GetHandle(), *ppeplayout);
+    }
+    eo_vector_Delete(layout->theendpoints);
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), layout);
+}
+
+
 
 static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
 {
@@ -725,10 +1236,11 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
         
         // now i erase memory associated with this endpoint
         eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        eo_mempool_Delete(eo_mempool_GetHandle(), (void*)theEndpoint->entitiesinitted);
         // and i dissociates that from from the internals of the eoprot library
-        eoprot_config_endpoint_ram(theBoard->boardnum, theEndpoint->epcfg.endpoint, NULL, 0);
+        eoprot_config_endpoint_ram(theBoard->boardnum, theEndpoint->layout->epcfg.endpoint, NULL, 0);
         // i also de-init the number of entities for that endpoint
-        eoprot_config_endpoint_entities(theBoard->boardnum, theEndpoint->epcfg.endpoint, NULL);
+        eoprot_config_endpoint_entities(theBoard->boardnum, theEndpoint->layout->epcfg.endpoint, NULL);
         
         // now i delete all data associated to the mutex protection
         
@@ -753,13 +1265,14 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
     }
     
     // so that we dont get in here inside again
+    eo_vector_Delete(theBoard->theendpoints);
     theBoard->theendpoints = NULL;
 
     return(eores_OK);
 }
 
 
-static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
+static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32, eOprotProgNumber_t prognum)
 {
     EOVmutexDerived* mtx2use = NULL;
     
@@ -792,8 +1305,7 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
                 if(NULL != theEndpoint)
                 {
                     //#warning .... i think of void* as a uint32_t* ///////////// think of it
-                    uint32_t nvprognumber = eoprot_endpoint_id2prognum(p->theboard.boardnum, id32);
-                    uint32_t** addr = eo_vector_At(theEndpoint->themtxofthenvs, nvprognumber);
+                    uint32_t** addr = eo_vector_At(theEndpoint->themtxofthenvs, prognum);
                     mtx2use = (EOVmutexDerived*) (*addr);
                 }
             } break;  
@@ -810,6 +1322,29 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
 }
 
 
+static EOVmutexDerived* s_eo_nvset_get_rammutex(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{   // the whole ram of an endpoint can be protected only if its nvs share the same mutex
+    if(eo_nvset_protection_one_per_board == p->protection)
+    {
+        return(p->theboard.mtx_board);
+    }
+    else if(eo_nvset_protection_one_per_endpoint == p->protection)
+    {
+        return(theEndpoint->mtx_endpoint);
+    }
+    
+    return(NULL);
+}
+
+
+static EOVmutexDerived* s_eo_nvset_get_initmutex(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{   // the mutex of the ram or, with one mutex per netvar, the one created for the lazy initialisation. NULL if no protection
+    EOVmutexDerived* mtx = s_eo_nvset_get_rammutex(p, theEndpoint);
+    
+    return((NULL != mtx) ? (mtx) : (theEndpoint->mtx_endpoint));
+}
+
+
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8)
 {
     eOnvset_brd_t* theBoard = &p->theboard;
@@ -836,9 +1371,9 @@ uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08)
     eOnvset_brd_t* theBoard = &p->theboard;
     uint16_t index = EOK_uint16dummy;
     const uint8_t lutsize = eonvset_max_endpoint_value+1;
-    if(ep08 < lutsize)
+    if((ep08 < lutsize) && (NULL != theBoard->layout))
     {
-        index = theBoard->ep2indexlut[ep08];
+        index = theBoard->layout->ep2indexlut[ep08];
     }
     return(index);
 }        
@@ -103,6 +103,39 @@ typedef enum
     eo_nvset_protection_one_per_netvar     = 4     /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
 } eOnvset_protection_t;
 
+
+/** @typedef    typedef enum eOnvset_initmode_t
+    @brief      It tells when the NVs get initialised with eo_nvset_LoadEP(), eo_nvset_InitBRD_LoadEPs() or eo_nvset_NVSinitialise().
+                In any mode the entities whose variables dont have an init function get the default value of the entity with a 
+                single memcpy, and the initialiser of the endpoint is called. 
+                The init functions are looked for when they are called, thus also those installed after the load with 
+                eoprot_config_callbacks_variable_set() are called.
+ **/ 
+typedef enum
+{
+    eo_nvset_initmode_eager                = 0,    /**< the init function of every NV is called at once */
+    eo_nvset_initmode_lazy                 = 1     /**< the init functions of the NVs of an entity are called at the first eo_nvset_NV_Get() 
+                                                        on any of them, hence also when the first ROP arrives. the initialisation is 
+                                                        protected by the mutex of the endpoint (or of the board), so that a concurrent 
+                                                        eo_nvset_NV_Get() waits for its end. with one mutex per NV the endpoint gets 
+                                                        one more mutex for that. with eo_nvset_protection_none the first access to an 
+                                                        entity must not be concurrent */
+} eOnvset_initmode_t;
+
+
+/** @typedef    typedef struct eOnvset_footprint_t
+    @brief      It contains the bytes of memory used by the NV set of a board, as given by eo_nvset_Footprint_Get(). The 
+                memory of the mutexes depends on the EOVmutexDerived in use, thus they are only counted. 
+ **/ 
+typedef struct
+{
+    uint32_t            ram;            /*< the ram of the endpoints */
+    uint32_t            descriptors;    /*< the object, the endpoints with their flags and vectors of mutexes */
+    uint32_t            layout;         /*< the layout of the endpoints. it is shared if the board was loaded with eo_nvset_InitBRD_LoadSharedEPs() */
+    uint16_t            mutexes;        /*< the number of mutexes */
+    uint16_t            endpoints;      /*< the number of endpoints */
+} eOnvset_footprint_t;
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -119,6 +152,9 @@ extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderive
 
 extern void eo_nvset_Delete(EOnvSet* p);
 
+// it must be called before eo_nvset_InitBRD(). the default is eo_nvset_initmode_eager
+extern eOresult_t eo_nvset_InitMode_Set(EOnvSet* p, eOnvset_initmode_t mode);
+
 
 extern eOresult_t eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum);
 
@@ -128,6 +164,13 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
 // it calls eo_nvset_InitBRD() and then for all the endpoint descriptors inside cfgofdev: { eo_nvset_EPcfg_IsValid() and eo_nvset_LoadEP() }
 extern eOresult_t eo_nvset_InitBRD_LoadEPs(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvset_BRDcfg_t* cfgofdev, eObool_t initNVs);
 
+// as eo_nvset_InitBRD_LoadEPs() but the description of the endpoints (their configuration, number of variables, size of ram
+// and the lookup tables) is shared with all the other EOnvSet initialised with this function with the same cfgofdev->epcfg_constvect.
+// only the ram and the mutexes belong to each board. the shared description is reference-counted and released by the last 
+// eo_nvset_DeinitBRD(). eo_nvset_LoadEP() cannot be used afterwards. this function and eo_nvset_DeinitBRD() must not be called 
+// concurrently by different threads.
+extern eOresult_t eo_nvset_InitBRD_LoadSharedEPs(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvset_BRDcfg_t* cfgofdev, eObool_t initNVs);
+
 
 extern eOresult_t eo_nvset_BRDlocalsetnumber(EOnvSet* p, eOnvBRD_t brdnum);
 
@@ -144,6 +187,20 @@ extern void* eo_nvset_RAMofEntity_Get(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent,
 
 extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32);
 
+// the snapshot of a board is a compact binary blob, without pointers, with the configuration of its endpoints (as given to
+// eoprot_config_endpoint_entities()) and the content of their ram. it can be saved to a file and mapped back by a restarted process.
+// eo_nvset_Snapshot_Size() returns the bytes required by eo_nvset_Snapshot_Save() or 0 if the board is not initted.
+extern uint32_t eo_nvset_Snapshot_Size(EOnvSet* p);
+extern eOresult_t eo_nvset_Snapshot_Save(EOnvSet* p, void* blob, uint32_t capacity, uint32_t* size);
+
+// the board must be initted. if it does not have endpoints yet they are loaded from the snapshot, else they must have the same 
+// configuration as in the snapshot. the endpoints are initialised in full and then their ram gets the values in the snapshot. 
+// in used it returns the bytes of blob used by the snapshot.
+extern eOresult_t eo_nvset_Snapshot_Restore(EOnvSet* p, const void* blob, uint32_t size, uint32_t* used);
+
+// it fills footprint with the memory used by the board. the board may also be not initted.
+extern eOresult_t eo_nvset_Footprint_Get(EOnvSet* p, eOnvset_footprint_t* footprint);
+
 
 /** @}            
     end of group eo_nvset 
@@ -49,13 +49,48 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+// the read-only description of an endpoint. it is shared by all the boards which use the same layout
 typedef struct
 {
     eOprot_EPcfg_t                      epcfg;
     uint16_t                            epnvsnumberof;
+    uint16_t                            sizeofram;
+    uint16_t                            numberofinstances;                          // sum of epcfg.numberofentities[]
+    uint16_t                            entityoffset[eoprot_maxvalueof_entity+1];   // position of the first instance of each entity
+} eOnvset_eplayout_t;
+
+
+// the state of the initialisation of an instance of an entity
+typedef enum
+{
+    eo_nvset_entity_notinitted          = 0,
+    eo_nvset_entity_initialising        = 1,    // its init functions are running
+    eo_nvset_entity_initted             = 2
+} eOnvset_entitystate_t;
+
+
+typedef struct eOnvset_layout_hid eOnvset_layout_t;
+
+// the read-only description of the endpoints of a board. if epcfg_constvect is not NULL the layout is shared by all 
+// the boards which were initialised with eo_nvset_InitBRD_LoadSharedEPs() with the same epcfg_constvect 
+struct eOnvset_layout_hid
+{
+    const EOconstvector*                epcfg_constvect;    // NULL if the layout is private to one board
+    uint16_t                            references;
+    uint16_t                            dummy;
+    EOvector*                           theendpoints;       // of eOnvset_eplayout_t* items
+    uint16_t                            ep2indexlut[eonvset_max_endpoint_value+1];
+    eOnvset_layout_t*                   next;               // in the list of the shared layouts
+};
+
+
+typedef struct
+{
+    const eOnvset_eplayout_t*           layout;    
     eObool_t                            initted;
-    uint8_t                             dummy; 
+    uint8_t                             dummy[3]; 
     void*                               epram;    
+    volatile uint8_t*                   entitiesinitted;    // one eOnvset_entitystate_t for each instance of each entity
     EOVmutexDerived*                    mtx_endpoint;    
     EOvector*                           themtxofthenvs;    
 } eOnvset_ep_t;
@@ -66,9 +101,9 @@ typedef struct
     eOipv4addr_t                    ipaddress;
     eOnvBRD_t                       boardnum;
     eOnvsetOwnership_t              ownership;
-    EOvector*                       theendpoints;       // of eOnvset_ep_t items
+    eOnvset_layout_t*               layout;
+    EOvector*                       theendpoints;       // of eOnvset_ep_t* items, in the same order as in layout
     EOVmutexDerived*                mtx_board;    
-    uint16_t                        ep2indexlut[eonvset_max_endpoint_value+1];    
 } eOnvset_brd_t;
 
 
@@ -83,6 +118,7 @@ struct EOnvSet_hid
 {
     eOnvset_brd_t                   theboard;
     eOnvset_protection_t            protection;
+    eOnvset_initmode_t              initmode;
     eov_mutex_fn_mutexderived_new   mtxderived_new;
 };   
  
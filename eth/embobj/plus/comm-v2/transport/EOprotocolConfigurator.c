@@ -97,7 +97,10 @@ const eOprotconfig_cfg_t eo_protconfig_cfg_default =
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOprotocolConfigurator";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOprotocolConfigurator";
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
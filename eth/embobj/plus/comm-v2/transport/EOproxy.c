@@ -74,18 +74,7 @@
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
-typedef struct              // 24+24=48
-{
-    eOropdescriptor_t       ropdes; // ropdes.time contains the expiry time ...
-    EOnv                    nv;
-    eOproxy_params_t        params;
-} eo_proxy_ropdes_plus_t;   //EO_VERIFYsizeof(eo_proxy_ropdes_plus_t, 56); 
-
-typedef struct
-{
-    uint32_t    id32;
-    uint32_t    sign;
-} eo_proxy_search_key_t;
+// empty-section
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -98,13 +87,31 @@ static eOresult_t s_eo_proxy_forward_rst(EOproxy *p, EOrop *rop, EOrop *ropout);
 
 static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout);
 
-static eOresult_t s_matching_rule_id32(void *item, void *param);
+static void s_eo_proxy_pending_init(EOproxy *p, uint16_t capacity);
+
+static uint16_t s_eo_proxy_pending_find(EOproxy *p, eOnvID32_t id32, uint32_t signature);
+
+static uint16_t s_eo_proxy_pending_add(EOproxy *p, const eOproxy_pending_t *item);
+
+static void s_eo_proxy_pending_remove(EOproxy *p, uint16_t index);
+
+static eObool_t s_eo_proxy_pending_requester_isattached(EOproxy *p, uint16_t index, const eOropdescriptor_t *ropdes);
+
+static void s_eo_proxy_pending_requester_attach(EOproxy *p, uint16_t index, const eOproxy_pending_t *item);
+
+EO_static_inline uint16_t s_eo_proxy_hash(EOproxy *p, eOnvID32_t id32)
+{   // fibonacci hashing: the multiplication spreads the bits of ep, entity, index and tag over the whole word
+    return((uint16_t)(((uint32_t)id32 * 0x9E3779B1) >> 16) & p->hashmask);
+}
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOproxy";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOproxy";
+#endif
  
 const eOproxy_cfg_t eo_proxy_cfg_default = 
 {
@@ -147,7 +154,7 @@ extern EOproxy* eo_proxy_New(const eOproxy_cfg_t *cfg)
     
     retptr->transceiver = cfg->transceiver;
     
-    retptr->listofropdes    = (0 == cfg->capacityoflistofropdes) ? (NULL) : (eo_list_New(sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes, NULL, 0, NULL, NULL));
+    s_eo_proxy_pending_init(retptr, cfg->capacityoflistofropdes);
     
     if(NULL != cfg->mutex_fn_new)
     {
@@ -170,9 +177,10 @@ extern void eo_proxy_Delete(EOproxy *p)
         eov_mutex_Delete(p->mtx);
     }
     
-    if(NULL != p->listofropdes)
+    if(NULL != p->pending)
     {
-        eo_list_Delete(p->listofropdes);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->pending);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->hashtable);
     }
    
     memset(p, 0, sizeof(EOproxy));
@@ -203,7 +211,7 @@ extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
     
     if(eobool_false == eo_nv_IsProxied(nv))
     {
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->capacity << 8) | (p->size);
         errdes.par64 = ((uint64_t)rop->ropdes.signature << 32) | (rop->ropdes.id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
         return(eores_NOK_generic);
@@ -235,7 +243,7 @@ extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
     
     if(eores_OK != res)
     {
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->capacity << 8) | (p->size);
         errdes.par64 = ((uint64_t)rop->ropdes.signature << 32) | (rop->ropdes.id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);       
     }
@@ -247,9 +255,8 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
 {
     eOproxy_params_t *par = NULL;
     
-    EOlistIter* li = NULL;
-    eo_proxy_search_key_t skey = {0};
-    eo_proxy_ropdes_plus_t *item = NULL;
+    uint16_t index = EOPROXY_NOENTRY;
+    eOproxy_pending_t *item = NULL;
     
     eOerrmanDescriptor_t errdes = {0};
 	errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
@@ -257,9 +264,6 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
     errdes.code             = eoerror_code_get(eoerror_category_System, eoerror_value_SYS_proxy_ropdes_notfound);
     errdes.par16            = 0; 
     errdes.par64            = 0; 
-
-    skey.id32 = id32;
-    skey.sign = EOK_uint32dummy;
     
     if(NULL == p)
     {
@@ -269,20 +273,20 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
     
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    li = eo_list_Find(p->listofropdes, s_matching_rule_id32, &skey);
+    index = s_eo_proxy_pending_find(p, id32, EOK_uint32dummy);
 
-    if(NULL == li)
+    if(EOPROXY_NOENTRY == index)
     {   // there is no entry with id32 in the list ... i cannot give teh param back
         eov_mutex_Release(p->mtx);
         
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->capacity << 8) | (p->size);
         errdes.par64 = (id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
         
         return(par);
     }
     
-    item = (eo_proxy_ropdes_plus_t*) eo_list_At(p->listofropdes, li);       
+    item = &p->pending[index];       
     eov_mutex_Release(p->mtx);   
 
     return(&item->params);   
@@ -292,18 +296,15 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
 extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data)
 {
     eOresult_t res = eores_NOK_generic;
-    EOlistIter* li = NULL;
-    eo_proxy_search_key_t skey = {0};
-    eo_proxy_ropdes_plus_t *item = NULL;
+    uint16_t index = EOPROXY_NOENTRY;
+    uint16_t requester = EOPROXY_NOENTRY;
+    eOproxy_pending_t *item = NULL;
     eOerrmanDescriptor_t errdes = {0};
 	errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
     errdes.sourceaddress    = 0;
     errdes.code             = eoerror_code_get(eoerror_category_System, eoerror_value_SYS_proxy_reply_fails);
     errdes.par16            = 0; 
     errdes.par64            = 0; 
-
-    skey.id32 = id32;
-    skey.sign = EOK_uint32dummy;
         
     if(NULL == p)
     {
@@ -313,13 +314,13 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
         
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    li = eo_list_Find(p->listofropdes, s_matching_rule_id32, &skey);
+    index = s_eo_proxy_pending_find(p, id32, EOK_uint32dummy);
 
-    if(NULL == li)
+    if(EOPROXY_NOENTRY == index)
     {   // there is no entry with id32 in the list ... i dont load any reply rop
         eov_mutex_Release(p->mtx);
         
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->capacity << 8) | (p->size);
         //errdes.par64 = ((uint64_t)signature << 32) | (id32);
         errdes.par64 = (id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
@@ -327,7 +328,7 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
         return(eores_NOK_generic);
     }
     
-    item = (eo_proxy_ropdes_plus_t*) eo_list_At(p->listofropdes, li);
+    item = &p->pending[index];
     
     if(NULL != data)
     {
@@ -345,7 +346,20 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
     }
     
-    eo_list_Erase(p->listofropdes, li);
+    // the same reply also serves the requesters which have asked the same id32 in the meantime
+    for(requester = item->requesters; EOPROXY_NOENTRY != requester; requester = p->pending[requester].next)
+    {
+        p->pending[requester].ropdes.time = 0;
+        if(eores_OK != eo_transceiver_ReplyROP_Load(p->config.transceiver, &p->pending[requester].ropdes))
+        {
+            res = eores_NOK_generic;
+            errdes.par16 = 0;
+            errdes.par64 = ((uint64_t)p->pending[requester].ropdes.signature << 32) | (id32);
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
+        }
+    }
+    
+    s_eo_proxy_pending_remove(p, index);
     
     eov_mutex_Release(p->mtx);
     
@@ -355,7 +369,6 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
     
 extern eOresult_t eo_proxy_Tick(EOproxy *p)
 {   
-    eo_proxy_ropdes_plus_t* item = NULL;
     eOabstime_t timenow = 0;
 
     if(NULL == p)
@@ -367,12 +380,11 @@ extern eOresult_t eo_proxy_Tick(EOproxy *p)
     
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    // i assume that the items are in expiry order, thus i get the front and i keep on removing until timenow is higher than item->ropdes.time          
-    item = (eo_proxy_ropdes_plus_t*) eo_list_Front(p->listofropdes);   
-    while((NULL != item) && (timenow > item->ropdes.time))
+    // the items are in expiry order, thus i get the front and i keep on removing while timenow is higher than its ropdes.time.
+    // in this way the cost of a tick depends only on the number of expired items          
+    while((EOPROXY_NOENTRY != p->expiryhead) && (timenow > p->pending[p->expiryhead].ropdes.time))
     {
-        eo_list_PopFront(p->listofropdes);
-        item = (eo_proxy_ropdes_plus_t*) eo_list_Front(p->listofropdes);
+        s_eo_proxy_pending_remove(p, p->expiryhead);
     }
     
     eov_mutex_Release(p->mtx);
@@ -381,6 +393,31 @@ extern eOresult_t eo_proxy_Tick(EOproxy *p)
 }    
 
 
+extern uint32_t eo_proxy_Footprint(EOproxy *p, uint16_t *mutexes)
+{
+    uint32_t bytes = 0;
+    
+    if(NULL != mutexes)
+    {
+        *mutexes = ((NULL == p) || (NULL == p->mtx)) ? (0) : (1);
+    }
+    
+    if(NULL == p)
+    {
+        return(0);
+    }
+    
+    bytes = sizeof(EOproxy);
+    
+    if(NULL != p->pending)
+    {
+        bytes += p->capacity*sizeof(eOproxy_pending_t) + (p->hashmask+1)*sizeof(uint16_t);
+    }
+    
+    return(bytes);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -437,12 +474,51 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
     EOnv *nv = &rop->netvar;
     eOropdescriptor_t* ropdes = &rop->ropdes;
     eOresult_t res = eores_NOK_generic;
-    eo_proxy_ropdes_plus_t ropdesplus;
+    eOproxy_pending_t ropdesplus;
+    uint16_t leader = EOPROXY_NOENTRY;
     eOabstime_t timenow = eov_sys_LifeTimeGet(eov_sys_GetHandle());;
+    
+    // we prepare the ropdes for transmission.
+    ropdesplus.ropdes.control.confinfo  = eo_ropconf_none;
+    ropdesplus.ropdes.control.plustime  = ropdes->control.rqsttime;
+    ropdesplus.ropdes.control.plussign  = ropdes->control.plussign;
+    ropdesplus.ropdes.control.rqsttime  = 0;
+    ropdesplus.ropdes.control.rqstconf  = 0;
+    ropdesplus.ropdes.control.version   = ropdes->control.version;
+    ropdesplus.ropdes.ropcode           = eo_ropcode_say;
+    ropdesplus.ropdes.size              = 0;
+    ropdesplus.ropdes.id32              = ropdes->id32;
+    ropdesplus.ropdes.data              = NULL;
+    ropdesplus.ropdes.signature         = ropdes->signature;
+    // in ropdes.time we put the time at which we want the entry to expire    
+    if(eok_reltimeINFINITE == p->config.replyroptimeout)
+    {
+        ropdesplus.ropdes.time = EOK_uint64dummy;   // so that the the check of higher than any measured time always gives false
+    } 
+    else
+    {
+        ropdesplus.ropdes.time = timenow + p->config.replyroptimeout;
+    }    
+
+    // we copy the nv
+    memcpy(&ropdesplus.nv, nv, sizeof(EOnv));
+    
+    // clear the param
+    memset(&ropdesplus.params, 0, sizeof(ropdesplus.params));
      
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    if(eobool_true != eo_list_Full(p->listofropdes))
+    // if the same id32 is already pending, its reply will also serve this request
+    leader = s_eo_proxy_pending_find(p, ropdes->id32, EOK_uint32dummy);
+    
+    if((EOPROXY_NOENTRY != leader) && (eobool_true == s_eo_proxy_pending_requester_isattached(p, leader, &ropdesplus.ropdes)))
+    {   // a repetition of a request which is already waiting: nothing to do
+        eo_rop_Reset(ropout);
+        eov_mutex_Release(p->mtx);
+        return(eores_OK);
+    }
+    
+    if(p->size < p->capacity)
     {   // we can process the ask        
         res = eores_OK;       
     }
@@ -472,38 +548,16 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
     
     // if we can process the ask we dont send a roput, not even a ack. thus we reset the rop so that the caller of roxy object cannot send it out
     eo_rop_Reset(ropout); 
-       
-    // we prepare the ropdes for transmission.
-    ropdesplus.ropdes.control.confinfo  = eo_ropconf_none;
-    ropdesplus.ropdes.control.plustime  = ropdes->control.rqsttime;
-    ropdesplus.ropdes.control.plussign  = ropdes->control.plussign;
-    ropdesplus.ropdes.control.rqsttime  = 0;
-    ropdesplus.ropdes.control.rqstconf  = 0;
-    ropdesplus.ropdes.control.version   = ropdes->control.version;
-    ropdesplus.ropdes.ropcode           = eo_ropcode_say;
-    ropdesplus.ropdes.size              = 0;
-    ropdesplus.ropdes.id32              = ropdes->id32;
-    ropdesplus.ropdes.data              = NULL;
-    ropdesplus.ropdes.signature         = ropdes->signature;
-    // in ropdes.time we put the time at which we want the entry to expire    
-    if(eok_reltimeINFINITE == p->config.replyroptimeout)
-    {
-        ropdesplus.ropdes.time = EOK_uint64dummy;   // so that the the check of higher than any measured time always gives false
-    } 
-    else
-    {
-        ropdesplus.ropdes.time = timenow + p->config.replyroptimeout;
-    }    
-
-    // we copy the nv
-    memcpy(&ropdesplus.nv, nv, sizeof(EOnv));
     
-    // clear the param
-    memset(&ropdesplus.params, 0, sizeof(ropdesplus.params));
+    if(EOPROXY_NOENTRY != leader)
+    {   // we dont forward the ask again: we just attach the requester to the pending entry, so that we save a round trip 
+        s_eo_proxy_pending_requester_attach(p, leader, &ropdesplus);
+        eov_mutex_Release(p->mtx);
+        return(eores_OK);
+    }
        
-    // now we insert the item in the list according to expiry time. 
-    // since the timeouts  are all equal, i just append the item at the end of the list
-    eo_list_PushBack(p->listofropdes, &ropdesplus);
+    // now we insert the item in the hash table and in the list ordered by expiry time. 
+    s_eo_proxy_pending_add(p, &ropdesplus);
      
     eov_mutex_Release(p->mtx); 
 
@@ -514,20 +568,222 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
 }
 
 
-static eOresult_t s_matching_rule_id32(void *item, void *param)
+static void s_eo_proxy_pending_init(EOproxy *p, uint16_t capacity)
 {
-    eo_proxy_ropdes_plus_t *inside = (eo_proxy_ropdes_plus_t*)item;
-    eo_proxy_search_key_t *skeyptr = (eo_proxy_search_key_t*)param;
-    uint32_t insidesignature = (EOK_uint32dummy == skeyptr->sign) ? (EOK_uint32dummy) : (inside->ropdes.signature);
+    uint16_t i = 0;
+    uint32_t buckets = 2;
+    
+    p->pending      = NULL;
+    p->hashtable    = NULL;
+    p->hashmask     = 0;
+    p->capacity     = capacity;
+    p->size         = 0;
+    p->freehead     = EOPROXY_NOENTRY;
+    p->expiryhead   = EOPROXY_NOENTRY;
+    p->expirytail   = EOPROXY_NOENTRY;
+    
+    if(0 == capacity)
+    {
+        return;
+    }
+    
+    // the number of buckets is the power of two not smaller than twice the capacity, so that chains stay short
+    while(buckets < (2*(uint32_t)capacity))
+    {
+        buckets <<= 1;
+    }
+    if(buckets > 0x8000)
+    {
+        buckets = 0x8000;
+    }
+    p->hashmask = buckets - 1;
+    
+    p->pending   = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOproxy_pending_t), capacity);
+    p->hashtable = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), buckets);
+    
+    memset(p->hashtable, 0xff, buckets*sizeof(uint16_t));
+    
+    // all the entries go into the free list
+    for(i=0; i<capacity; i++)
+    {
+        p->pending[i].next = ((i+1) == capacity) ? (EOPROXY_NOENTRY) : (i+1);
+    }
+    p->freehead = 0;
+}
+
 
-    if((inside->ropdes.id32 == skeyptr->id32) && (insidesignature == skeyptr->sign))
+static uint16_t s_eo_proxy_pending_find(EOproxy *p, eOnvID32_t id32, uint32_t signature)
+{
+    uint16_t index = EOPROXY_NOENTRY;
+    
+    if(0 == p->size)
     {
-        return(eores_OK);
+        return(EOPROXY_NOENTRY);
+    }
+    
+    // the hash uses only the id32, so that the search with the wildcard signature EOK_uint32dummy finds the same bucket 
+    index = p->hashtable[s_eo_proxy_hash(p, id32)];
+    
+    while(EOPROXY_NOENTRY != index)
+    {
+        eOproxy_pending_t *item = &p->pending[index];
+        if((item->ropdes.id32 == id32) && ((EOK_uint32dummy == signature) || (item->ropdes.signature == signature)))
+        {
+            return(index);
+        }
+        index = item->hashnext;
+    }
+    
+    return(EOPROXY_NOENTRY);
+}
+
+
+static uint16_t s_eo_proxy_pending_add(EOproxy *p, const eOproxy_pending_t *item)
+{
+    uint16_t index = p->freehead;
+    uint16_t after = p->expirytail;
+    uint16_t bucket = 0;
+    eOproxy_pending_t *entry = NULL;
+    
+    if(EOPROXY_NOENTRY == index)
+    {
+        return(EOPROXY_NOENTRY);
+    }
+    
+    entry = &p->pending[index];
+    p->freehead = entry->next;
+    
+    memcpy(entry, item, sizeof(eOproxy_pending_t));
+    entry->requesters = EOPROXY_NOENTRY;
+    
+    // insert in front of its bucket
+    bucket = s_eo_proxy_hash(p, entry->ropdes.id32);
+    entry->hashnext = p->hashtable[bucket];
+    p->hashtable[bucket] = index;
+    
+    // insert in expiry order. the timeouts are all equal, thus the search from the tail stops immediately
+    while((EOPROXY_NOENTRY != after) && (p->pending[after].ropdes.time > entry->ropdes.time))
+    {
+        after = p->pending[after].prev;
+    }
+    
+    entry->prev = after;
+    if(EOPROXY_NOENTRY == after)
+    {
+        entry->next = p->expiryhead;
+        p->expiryhead = index;
     }
     else
     {
-        return(eores_NOK_generic);
+        entry->next = p->pending[after].next;
+        p->pending[after].next = index;
+    }
+    
+    if(EOPROXY_NOENTRY == entry->next)
+    {
+        p->expirytail = index;
     }
+    else
+    {
+        p->pending[entry->next].prev = index;
+    }
+    
+    p->size++;
+    
+    return(index);
+}
+
+
+static void s_eo_proxy_pending_remove(EOproxy *p, uint16_t index)
+{
+    eOproxy_pending_t *entry = &p->pending[index];
+    uint16_t *link = &p->hashtable[s_eo_proxy_hash(p, entry->ropdes.id32)];
+    uint16_t requester = entry->requesters;
+    
+    // the attached requesters go away with the entry
+    while(EOPROXY_NOENTRY != requester)
+    {
+        uint16_t next = p->pending[requester].next;
+        p->pending[requester].next = p->freehead;
+        p->freehead = requester;
+        p->size--;
+        requester = next;
+    }
+    
+    // unlink from its bucket
+    while(index != *link)
+    {
+        link = &p->pending[*link].hashnext;
+    }
+    *link = entry->hashnext;
+    
+    // unlink from the expiry list
+    if(EOPROXY_NOENTRY == entry->prev)
+    {
+        p->expiryhead = entry->next;
+    }
+    else
+    {
+        p->pending[entry->prev].next = entry->next;
+    }
+    
+    if(EOPROXY_NOENTRY == entry->next)
+    {
+        p->expirytail = entry->prev;
+    }
+    else
+    {
+        p->pending[entry->next].prev = entry->prev;
+    }
+    
+    // and give it back to the free list
+    entry->next = p->freehead;
+    p->freehead = index;
+    
+    p->size--;
+}
+
+
+static eObool_t s_eo_proxy_pending_requester_isattached(EOproxy *p, uint16_t index, const eOropdescriptor_t *ropdes)
+{   // the reply to a requester depends only on signature, plustime and plussign 
+    uint16_t requester = index;
+    
+    while(EOPROXY_NOENTRY != requester)
+    {
+        const eOropdescriptor_t *rd = &p->pending[requester].ropdes;
+        if((rd->signature == ropdes->signature) && (rd->control.plustime == ropdes->control.plustime) && (rd->control.plussign == ropdes->control.plussign))
+        {
+            return(eobool_true);
+        }
+        requester = (requester == index) ? (p->pending[index].requesters) : (p->pending[requester].next);
+    }
+    
+    return(eobool_false);
+}
+
+
+static void s_eo_proxy_pending_requester_attach(EOproxy *p, uint16_t index, const eOproxy_pending_t *item)
+{
+    uint16_t requester = p->freehead;
+    eOproxy_pending_t *entry = NULL;
+    
+    if(EOPROXY_NOENTRY == requester)
+    {
+        return;
+    }
+    
+    entry = &p->pending[requester];
+    p->freehead = entry->next;
+    
+    // the requester is not inside the hash table nor inside the expiry list: it expires or is served with its leader
+    memcpy(entry, item, sizeof(eOproxy_pending_t));
+    entry->hashnext     = EOPROXY_NOENTRY;
+    entry->prev         = EOPROXY_NOENTRY;
+    entry->requesters   = EOPROXY_NOENTRY;
+    entry->next         = p->pending[index].requesters;
+    p->pending[index].requesters = requester;
+    
+    p->size++;
 }
 
 
@@ -112,6 +112,8 @@ extern void eo_proxy_Delete(EOproxy *p);
                 relevant netvar. if the rop is of kind ask<>, then the ropdescriptor and the netvar are stored
                 inside an internal list and are assigned a timeout. if within the timeout the reply arrives, the user
                 calls eo_proxy_ReplyROP_Load() and the say<> is automatically loaded in the transceiver.
+                if an ask<> arrives for a netvar which already waits for its reply, the update() function is not called
+                again: the request is attached to the pending one and is served by the same eo_proxy_ReplyROP_Load(). 
     @param      p           the object.
     @param      rop         the rop to forward.
     @param      ropout      the possible rop to send back (a nak for instance or a ack).
@@ -140,6 +142,7 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32);
 /** @fn         extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data)
     @brief      tells the proxy that a reply has arrived. the ropdescriptor to use is searched inside the object using 
                 two keys: the id32 and the signature. If signature has value EOK_uint32dummy then it is not used.
+                a say<> is loaded for every request of the id32 which was coalesced into the pending one.
     @param      p           the object.
     @param      id32        the id of the variable.
     @param      signature   the signature of the rop. if EOK_uint32dummy the signature is not used for teh search 
@@ -161,6 +164,15 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
 extern eOresult_t eo_proxy_Tick(EOproxy *p);
 
 
+/** @fn         extern uint32_t eo_proxy_Footprint(EOproxy *p, uint16_t *mutexes)
+    @brief      computes the bytes of memory used by the proxy: the object, the pending entries and the hash table.
+    @param      p           the object.
+    @param      mutexes     if not NULL, in output it contains the number of mutexes used by the proxy.
+    @return     the number of bytes, or 0 if p is NULL.    
+ **/
+extern uint32_t eo_proxy_Footprint(EOproxy *p, uint16_t *mutexes);
+
+
 
 
 
@@ -34,7 +34,7 @@ extern "C" {
 // - external dependencies --------------------------------------------------------------------------------------------
 
 #include "EoCommon.h"
-#include "EOlist.h"
+#include "EOnv_hid.h"
 #include "EOVmutex.h"
 #include "EOtransceiver.h"
 
@@ -45,7 +45,9 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
+
+#define EOPROXY_NOENTRY     0xffff
+
 
 
 
@@ -57,11 +59,36 @@ extern "C" {
                 used also by its derived objects.
  **/  
  
+/* @struct     eOproxy_pending_t
+    @brief      a pending ask<> forward. it is kept at the same time inside a bucket of the hash table keyed by id32 
+                (via hashnext) and inside the list ordered by expiry time (via prev and next). the late requesters 
+                of the same id32 are not forwarded again: they are attached to the entry via requesters and chained 
+                amongst them via next. free entries are chained via next as well.
+ **/ 
+typedef struct              
+{
+    eOropdescriptor_t       ropdes; // ropdes.time contains the expiry time ...
+    EOnv                    nv;
+    eOproxy_params_t        params;
+    uint16_t                hashnext;
+    uint16_t                prev;
+    uint16_t                next;
+    uint16_t                requesters;
+} eOproxy_pending_t;
+
+
 struct EOproxy_hid 
 {
     eOproxy_cfg_t       config;
     EOtransceiver*      transceiver;
-    EOlist*             listofropdes;
+    eOproxy_pending_t*  pending;        // capacityoflistofropdes entries
+    uint16_t*           hashtable;      // hashmask+1 buckets, each one with the index of the first entry
+    uint16_t            hashmask;
+    uint16_t            capacity;
+    uint16_t            size;
+    uint16_t            freehead;
+    uint16_t            expiryhead;     // the entry which expires first
+    uint16_t            expirytail;     // the entry which expires last
     EOVmutexDerived*    mtx;           
 }; 
 
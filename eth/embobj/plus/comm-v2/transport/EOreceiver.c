@@ -26,6 +26,7 @@
 #include "EOtheMemoryPool.h"
 #include "EOtheParser.h"
 #include "EOtheFormer.h"
+#include "EOropframe_hid.h"
 
 
 
@@ -76,7 +77,10 @@ static void s_eo_receiver_on_error_seqnumber(EOreceiver* p);
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOreceiver";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOreceiver";
+#endif
 
 const eOreceiver_cfg_t eo_receiver_cfg_default = 
 {
@@ -124,6 +128,7 @@ extern EOreceiver* eo_receiver_New(const eOreceiver_cfg_t *cfg)
     retptr->rx_seqnum           = eok_uint64dummy;
     retptr->tx_ageofframe       = eok_uint64dummy;
     memset(&retptr->error_seqnumber, 0, sizeof(retptr->error_seqnumber));       // even if it is already zero.
+    retptr->lostropframes       = 0;
     memset(&retptr->error_invalidframe, 0, sizeof(retptr->error_invalidframe)); // even if it is already zero. 
     retptr->on_error_seqnumber  = cfg->extfn.onerrorseqnumber;
     retptr->on_error_invalidframe = cfg->extfn.onerrorinvalidframe;
@@ -254,6 +259,8 @@ extern eOresult_t eo_receiver_Process(EOreceiver *p, EOpacket *packet, uint16_t
             p->error_seqnumber.exp_seqnum =  p->rx_seqnum+1;
             p->error_seqnumber.timeoftxofcurrent = rec_ageoframe;
             p->error_seqnumber.timeoftxofprevious = p->tx_ageofframe;
+            // a jump forward tells how many ropframes went lost. a jump backwards (e.g., the remote host restarted) counts as one.
+            p->lostropframes += (rec_seqnum > (p->rx_seqnum+1)) ? ((uint32_t)(rec_seqnum - p->rx_seqnum - 1)) : (1);
             
             s_eo_receiver_on_error_seqnumber(p);
         }
@@ -375,6 +382,31 @@ extern const eOreceiver_seqnum_error_t * eo_receiver_GetSequenceNumberError(EOre
     return(&p->error_seqnumber);   
 }
 
+extern uint32_t eo_receiver_GetLostRopframes(EOreceiver *p)
+{
+    if(NULL == p) 
+    {
+        return(0);
+    }  
+
+    return(p->lostropframes);   
+}
+
+extern uint32_t eo_receiver_Footprint(EOreceiver *p)
+{
+    uint32_t bytes = 0;
+    
+    if(NULL == p) 
+    {
+        return(0);
+    }  
+    
+    bytes = sizeof(EOreceiver) + 2*sizeof(EOropframe) + p->ropframereply->capacity;
+    bytes += eo_rop_Footprint(p->ropinput) + eo_rop_Footprint(p->ropreply);
+
+    return(bytes);   
+}
+
 extern const eOreceiver_invalidframe_error_t * eo_receiver_GetInvalidFrameError(EOreceiver *p)
 {
     if(NULL == p) 
@@ -156,6 +156,22 @@ extern eOresult_t eo_receiver_GetReply(EOreceiver *p, EOropframe **ropframereply
 
 extern const eOreceiver_seqnum_error_t * eo_receiver_GetSequenceNumberError(EOreceiver *p);
 
+/** @fn         extern uint32_t eo_receiver_GetLostRopframes(EOreceiver *p)
+    @brief      returns the number of ropframes which went lost since the creation of the object, as detected by the 
+                errors in the sequence number of the received ropframes. the value wraps around.
+    @param      p               the object.
+    @return     the number of lost ropframes or 0 if p is NULL.
+ **/
+extern uint32_t eo_receiver_GetLostRopframes(EOreceiver *p);
+
+/** @fn         extern uint32_t eo_receiver_Footprint(EOreceiver *p)
+    @brief      computes the bytes of memory used by the receiver: the object, its ropframes, the rops and the buffer 
+                of the reply. the input ropframe uses the memory of the received packet, thus it is not counted.
+    @param      p               the object.
+    @return     the number of bytes or 0 if p is NULL.
+ **/
+extern uint32_t eo_receiver_Footprint(EOreceiver *p);
+
 extern const eOreceiver_invalidframe_error_t * eo_receiver_GetInvalidFrameError(EOreceiver *p);
 
 
@@ -106,7 +106,10 @@ const eOropdescriptor_t eok_ropdesc_basic =
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOrop";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOrop";
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -214,6 +217,17 @@ extern uint16_t eo_rop_GetSize(EOrop *p)
 }
 
 
+extern uint32_t eo_rop_Footprint(EOrop *p)
+{
+    if(NULL == p)
+    {
+        return(0);
+    }
+    
+    return(sizeof(EOrop) + p->stream.capacity);
+}
+
+
 extern eOropcode_t eo_rop_GetROPcode(EOrop *p)
 {
     if(NULL == p)
@@ -194,6 +194,14 @@ extern eOresult_t eo_rop_Reset(EOrop *p);
 extern uint16_t eo_rop_GetSize(EOrop *p);
 
 
+/** @fn         extern uint32_t eo_rop_Footprint(EOrop *p)
+    @brief      Returns the bytes of memory used by the rop: the object and the capacity of its data.
+    @param      p           The ROP 
+    @return     the number of bytes, or 0 if p is NULL
+ **/
+extern uint32_t eo_rop_Footprint(EOrop *p);
+
+
 /** @fn         extern eOropcode_t eo_rop_GetROPCode(EOrop *p)
     @brief      Returns the ROP code.
     @param      p           The EOrop object 
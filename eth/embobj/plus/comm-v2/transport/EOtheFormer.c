@@ -72,9 +72,13 @@
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOtheFormer";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOtheFormer";
+#endif
  
-static EOtheFormer eo_theformer = 
+// every thread has its own default object (see EO_threadlocal)
+static EO_threadlocal EOtheFormer eo_theformer = 
 {
     EO_INIT(.initted)       0
 };
@@ -106,6 +110,31 @@ extern EOtheFormer * eo_former_GetHandle(void)
 }
 
 
+extern EOformer * eo_former_New(void) 
+{
+    EOformer *retptr = NULL;    
+
+    // i get the memory for the object
+    retptr = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOformer), 1);
+    
+    retptr->initted = 1;
+    
+    return(retptr);
+}
+
+
+extern void eo_former_Delete(EOformer *p) 
+{
+    if((NULL == p) || (&eo_theformer == p))
+    {
+        return;
+    }
+    
+    memset(p, 0, sizeof(EOformer));    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
 
 extern eOresult_t eo_former_GetStream(EOtheFormer *p, const EOrop *rop, const uint16_t streamcapacity, uint8_t *streamdata, uint16_t *streamsize)
 {   // this function requires the access to hidden types of EOrop
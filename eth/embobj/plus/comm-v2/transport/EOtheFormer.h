@@ -61,6 +61,13 @@ extern "C" {
 typedef struct EOtheFormer_hid EOtheFormer;
 
 
+/** @typedef    typedef struct EOtheFormer_hid EOformer
+    @brief      EOformer is the instance-based version of EOtheFormer. Every EOformer has its own state, so that
+                several EOformer objects can be used at the same time by different threads.
+ **/  
+typedef struct EOtheFormer_hid EOformer;
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 // empty-section
@@ -78,12 +85,28 @@ extern EOtheFormer * eo_former_Initialise(void);
 
 
 /** @fn         extern EOtheFormer * eo_former_GetHandle(void)
-    @brief      Gets the handle of the EOtheFormer singleton 
+    @brief      Gets the handle of the EOtheFormer singleton. On platforms which support thread local storage
+                (see EO_threadlocal) the singleton is the default object of the calling thread, thus threads
+                never share it. 
     @return     Constant pointer to the singleton.
  **/
 extern EOtheFormer * eo_former_GetHandle(void);
 
 
+/** @fn         extern EOformer * eo_former_New(void)
+    @brief      Creates a new EOformer object which does not share any state with the singleton or with other objects. 
+    @return     A valid and not-NULL pointer to the new object.
+ **/
+extern EOformer * eo_former_New(void);
+
+
+/** @fn         extern void eo_former_Delete(EOformer *p)
+    @brief      Destroys an object created with eo_former_New(). It must not be called with the handle of the singleton.
+    @param      p               The object.
+ **/
+extern void eo_former_Delete(EOformer *p);
+
+
 /** @fn         extern uint16_t eo_former_GetSizeOfStream(EOtheFormer *p, const EOrop *rop)
     @brief      computes the size of the stream that will come out of rop.
     @param      p               The former.
@@ -23,6 +23,7 @@
 #include "stdlib.h"
 #include "EoCommon.h"
 #include "string.h"
+#include "EOtheMemoryPool.h"
 #include "EOtheErrorManager.h"
 #include "EOnv.h"
 #include "EOrop_hid.h"
@@ -73,9 +74,13 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 
-//static const char s_eobj_ownname[] = "EOtheParser";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOtheParser";
+#endif
 
-static EOtheParser eo_theparser = 
+// every thread has its own default object (see EO_threadlocal)
+static EO_threadlocal EOtheParser eo_theparser = 
 {
     EO_INIT(.initted)       0
 };
@@ -107,6 +112,31 @@ extern EOtheParser * eo_parser_GetHandle(void)
 }
 
 
+extern EOparser * eo_parser_New(void) 
+{
+    EOparser *retptr = NULL;    
+
+    // i get the memory for the object
+    retptr = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOparser), 1);
+    
+    retptr->initted = 1;
+    
+    return(retptr);
+}
+
+
+extern void eo_parser_Delete(EOparser *p) 
+{
+    if((NULL == p) || (&eo_theparser == p))
+    {
+        return;
+    }
+    
+    memset(p, 0, sizeof(EOparser));    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
 extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, const uint16_t streamsize, EOrop *rop, uint16_t *consumedbytes, eOparserResult_t *result)
 {   // this function requires the access to hidden types of EOrop
     eOrophead_t *rophead            = NULL;
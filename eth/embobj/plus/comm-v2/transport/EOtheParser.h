@@ -61,6 +61,13 @@ extern "C" {
 typedef struct EOtheParser_hid EOtheParser;
 
 
+/** @typedef    typedef struct EOtheParser_hid EOparser
+    @brief      EOparser is the instance-based version of EOtheParser. Every EOparser has its own state, so that
+                several EOparser objects can be used at the same time by different threads.
+ **/  
+typedef struct EOtheParser_hid EOparser;
+
+
 typedef enum
 {
     eo_parser_res_ok                    = 0,
@@ -88,12 +95,28 @@ extern EOtheParser * eo_parser_Initialise(void);
 
 
 /** @fn         extern EOtheParser * eo_parser_GetHandle(void)
-    @brief      Gets the handle of the EOtheParser singleton 
+    @brief      Gets the handle of the EOtheParser singleton. On platforms which support thread local storage
+                (see EO_threadlocal) the singleton is the default object of the calling thread, thus threads
+                never share it. 
     @return     Constant pointer to the singleton.
  **/
 extern EOtheParser * eo_parser_GetHandle(void);
 
 
+/** @fn         extern EOparser * eo_parser_New(void)
+    @brief      Creates a new EOparser object which does not share any state with the singleton or with other objects. 
+    @return     A valid and not-NULL pointer to the new object.
+ **/
+extern EOparser * eo_parser_New(void);
+
+
+/** @fn         extern void eo_parser_Delete(EOparser *p)
+    @brief      Destroys an object created with eo_parser_New(). It must not be called with the handle of the singleton.
+    @param      p               The object.
+ **/
+extern void eo_parser_Delete(EOparser *p);
+
+
 /** @fn         extern eOresult_t eo_parser_GetROP(EOtheParser *p, uint8_t *pktdata, uint16_t pktsize, EOrop *rop, uint16_t *consumedbytes)
     @brief      Gets a single ROP from a received packet and tells how much of the packet data is used by the rop, so that a new
                 call of the function will be passed the packet data with an offset. 
@@ -29,6 +29,7 @@
 #include "EOropframe_hid.h"
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
+#include "EOagent_hid.h"
 
 #include "EOVmutex.h"
 
@@ -51,7 +52,9 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#define EOTRANSCEIVER_SNAPSHOT_MAGIC        0x534e5254      // "TRNS" in little endian
+#define EOTRANSCEIVER_SNAPSHOT_VERSION      1
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -63,7 +66,15 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the snapshot is: a eOtransceiver_snapshot_head_t, then the snapshot of the nvset, then the regular rops.
+typedef struct      // 12 bytes
+{
+    uint32_t                magic;
+    uint16_t                version;
+    uint16_t                numberofregulars;
+    uint32_t                sizeofnvset;
+} eOtransceiver_snapshot_head_t;    EO_VERIFYsizeof(eOtransceiver_snapshot_head_t, 12);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -76,7 +87,10 @@
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOtransceiver";
+// it is used only to tag the allocations with the trace of the EOtheMemoryPool
+#if     defined(EOMEMPOOL_USE_TRACE)
+static const char s_eobj_ownname[] = "EOtransceiver";
+#endif
 
 const eOtransceiver_cfg_t eo_transceiver_cfg_default = 
 {
@@ -143,6 +157,7 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
         eOconfman_cfg_t confmancfg;
         memcpy(&confmancfg, cfg->confmancfg, sizeof(eOconfman_cfg_t));
         confmancfg.mutex_fn_new = (eo_trans_protection_enabled == cfg->protection) ? (cfg->mutex_fn_new) : (NULL);
+        confmancfg.transceiver  = retptr;
         retptr->confmanager = eo_confman_New(&confmancfg);
     }
     else
@@ -274,6 +289,16 @@ extern EOproxy * eo_transceiver_GetProxy(EOtransceiver *p)
     return(p->proxy);    
 }
 
+extern EOconfirmationManager * eo_transceiver_GetConfirmationManager(EOtransceiver *p)
+{
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+         
+    return(p->confmanager);    
+}
+
 extern EOtransmitter * eo_transceiver_GetTransmitter(EOtransceiver *p)
 {
     if(NULL == p)
@@ -323,6 +348,9 @@ extern eOresult_t eo_transceiver_Receive(EOtransceiver *p, EOpacket *pkt, uint16
     {
         return(res);
     }  
+    
+    // the ropframes of the peer lost on their way to us are used by the adaptive decimation of the transmitter, if enabled
+    eo_transmitter_TXdecimation_InboundLost_Set(p->transmitter, eo_receiver_GetLostRopframes(p->receiver));
 
     if(eobool_true == thereisareply)
     {
@@ -379,6 +407,10 @@ extern eOresult_t eo_transceiver_outpacket_Prepare(EOtransceiver *p, uint16_t *n
     // inserted in EOtransmitter with eo_transceiver_ReplyROP_Load() called by eo_proxy_ReplyROP_Load()
     // if p->proxy is NULL the following call does not harm
     eo_proxy_Tick(p->proxy);
+    
+    // and the confirmation manager to retransmit the confirmed rops which have not received their ack/nak in time.
+    // the retransmitted rops go out with the next packet. if p->confmanager is NULL the following call does not harm
+    eo_confman_Tick(p->confmanager);
        
     return(res);
 }
@@ -512,6 +544,137 @@ extern eOresult_t eo_transceiver_RegularROP_Unload(EOtransceiver *p, eOropdescri
     return(res);
 }
 
+extern uint32_t eo_transceiver_Snapshot_Size(EOtransceiver *p)
+{
+    uint16_t numberofregulars = 0;
+    
+    if(NULL == p)
+    {
+        return(0);
+    }
+    
+    eo_transmitter_regular_rops_Snapshot_Get(p->transmitter, NULL, 0, &numberofregulars);
+    
+    return(sizeof(eOtransceiver_snapshot_head_t) + eo_nvset_Snapshot_Size(p->cfg.nvset) + numberofregulars*sizeof(eOtransmitter_regularrop_t));
+}
+
+
+extern eOresult_t eo_transceiver_Snapshot_Save(EOtransceiver *p, void *blob, uint32_t capacity, uint32_t *size)
+{
+    eOtransceiver_snapshot_head_t head = {0};
+    uint8_t *dest = (uint8_t*)blob;
+    uint32_t pos = sizeof(eOtransceiver_snapshot_head_t);
+    eOresult_t res = eores_OK;
+    
+    if((NULL == p) || (NULL == blob) || (NULL == size))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(capacity < sizeof(eOtransceiver_snapshot_head_t))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(NULL != p->cfg.nvset)
+    {
+        res = eo_nvset_Snapshot_Save(p->cfg.nvset, dest + pos, capacity - pos, &head.sizeofnvset);
+        if(eores_OK != res)
+        {
+            return(res);
+        }
+        pos += head.sizeofnvset;
+    }
+    
+    // the regular rops are copied directly inside the blob, hence it must be 4-aligned
+    res = eo_transmitter_regular_rops_Snapshot_Get(p->transmitter, (eOtransmitter_regularrop_t*)(dest + pos), (capacity - pos) / sizeof(eOtransmitter_regularrop_t), &head.numberofregulars);
+    if(eores_OK != res)
+    {
+        return(res);
+    }
+    pos += head.numberofregulars*sizeof(eOtransmitter_regularrop_t);
+    
+    head.magic      = EOTRANSCEIVER_SNAPSHOT_MAGIC;
+    head.version    = EOTRANSCEIVER_SNAPSHOT_VERSION;
+    memcpy(dest, &head, sizeof(head));
+    
+    *size = pos;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_transceiver_Snapshot_Restore(EOtransceiver *p, const void *blob, uint32_t size)
+{
+    eOtransceiver_snapshot_head_t head = {0};
+    eOtransmitter_regularrop_t regular = {0};
+    eOropdescriptor_t ropdesc = {0};
+    const uint8_t *orig = (const uint8_t*)blob;
+    uint32_t pos = sizeof(eOtransceiver_snapshot_head_t);
+    uint16_t i = 0;
+    eOresult_t res = eores_OK;
+    
+    if((NULL == p) || (NULL == blob))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(size < sizeof(eOtransceiver_snapshot_head_t))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    memcpy(&head, orig, sizeof(head));
+    if((EOTRANSCEIVER_SNAPSHOT_MAGIC != head.magic) || (EOTRANSCEIVER_SNAPSHOT_VERSION != head.version))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if((pos + head.sizeofnvset + head.numberofregulars*sizeof(eOtransmitter_regularrop_t)) > size)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if((0 != head.sizeofnvset) && (NULL == p->cfg.nvset))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // at first the netvars, so that the regular rops find their ram with the values of before the restart
+    if(0 != head.sizeofnvset)
+    {
+        res = eo_nvset_Snapshot_Restore(p->cfg.nvset, orig + pos, head.sizeofnvset, NULL);
+        if(eores_OK != res)
+        {
+            return(res);
+        }
+        pos += head.sizeofnvset;
+    }
+    
+    // then the regular rops, in the same order they had
+    eo_transmitter_regular_rops_Clear(p->transmitter);
+    
+    for(i=0; i<head.numberofregulars; i++)
+    {
+        memcpy(&regular, orig + pos, sizeof(regular));
+        pos += sizeof(regular);
+        
+        memcpy(&ropdesc, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
+        ropdesc.control     = regular.control;
+        ropdesc.ropcode     = regular.ropcode;
+        ropdesc.id32        = regular.id32;
+        ropdesc.signature   = regular.signature;
+        
+        if(eores_OK != eo_transmitter_regular_rops_Load(p->transmitter, &ropdesc))
+        {
+            res = eores_NOK_generic;
+        }
+    }
+    
+    return(res);
+}
+
+
 extern eOresult_t eo_transceiver_lasterror_tx_Get(EOtransceiver *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2)
 {
     //eOresult_t res;
@@ -588,6 +751,38 @@ extern eOresult_t eo_transceiver_LoadReplyInProxy(EOtransceiver *p, eOnvID32_t i
 }    
 
 
+extern eOresult_t eo_transceiver_Footprint_Get(EOtransceiver *p, eOtransceiver_footprint_t *footprint)
+{
+    uint16_t mutexes = 0;
+    
+    if((NULL == p) || (NULL == footprint))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    memset(footprint, 0, sizeof(eOtransceiver_footprint_t));
+    
+    eo_nvset_Footprint_Get(p->cfg.nvset, &footprint->nvset);
+    footprint->mutexes = footprint->nvset.mutexes;
+    
+    footprint->transmitter = eo_transmitter_Footprint(p->transmitter, &mutexes);
+    footprint->mutexes += mutexes;
+    footprint->receiver = eo_receiver_Footprint(p->receiver);
+    footprint->proxy = eo_proxy_Footprint(p->proxy, &mutexes);
+    footprint->mutexes += mutexes;
+    footprint->confmanager = eo_confman_Footprint(p->confmanager, &mutexes);
+    footprint->mutexes += mutexes;
+    footprint->others = sizeof(EOtransceiver) + ((NULL == p->agent) ? (0) : (sizeof(EOagent)));
+    
+    footprint->total = footprint->nvset.ram + footprint->nvset.descriptors + footprint->nvset.layout;
+    footprint->total += footprint->transmitter + footprint->receiver + footprint->proxy + footprint->confmanager + footprint->others;
+    
+    footprint->mempool = eo_mempool_SizeOfAllocated(eo_mempool_GetHandle());
+    
+    return(eores_OK);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -105,6 +105,25 @@ typedef struct
 } eOtransceiver_cfg_t;
 
 
+/** @typedef    typedef struct eOtransceiver_footprint_t
+    @brief      It contains the bytes of memory used by a transceiver and by its objects, as given by eo_transceiver_Footprint_Get().
+                The memory of the mutexes depends on the EOVmutexDerived in use, thus they are only counted.
+ **/
+typedef struct
+{
+    eOnvset_footprint_t             nvset;          /*< the EOnvSet in cfg.nvset */
+    uint32_t                        transmitter;
+    uint32_t                        receiver;
+    uint32_t                        proxy;
+    uint32_t                        confmanager;
+    uint32_t                        others;         /*< the transceiver and its agent */
+    uint32_t                        total;          /*< the sum of all the above, nvset included */
+    uint32_t                        mempool;        /*< what is allocated by the EOtheMemoryPool by all the objects, as a reference */
+    uint16_t                        mutexes;        /*< the number of mutexes, those of the nvset included */
+    uint16_t                        filler;
+} eOtransceiver_footprint_t;
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -127,10 +146,22 @@ extern EOnvSet * eo_transceiver_GetNVset(EOtransceiver *p);
 
 extern EOproxy * eo_transceiver_GetProxy(EOtransceiver *p);
 
+extern EOconfirmationManager * eo_transceiver_GetConfirmationManager(EOtransceiver *p);
+
 extern EOtransmitter * eo_transceiver_GetTransmitter(EOtransceiver *p);
 
 extern EOreceiver * eo_transceiver_GetReceiver(EOtransceiver *p);
 
+/** @fn         extern eOresult_t eo_transceiver_Receive(EOtransceiver *p, EOpacket *pkt, uint16_t *numberofrops, eOabstime_t* txtime)
+    @brief      parses a received packet and loads the replies into the transmitter. if the transceiver was created with
+                eo_trans_protection_enabled, it can be called by the rx thread concurrently with eo_transceiver_outpacket_Prepare()
+                called by the tx thread: the replies and the occasionals / regulars use separate ropframes, scratch rops and mutexes.
+    @param      p               pointer to transceiver        
+    @param      pkt             the received packet
+    @param      numberofrops    the number of rops contained in the received packet
+    @param      txtime          the transmission time of the received packet
+    @return     eores_OK or eores_NOK_nullpointer
+ **/
 extern eOresult_t eo_transceiver_Receive(EOtransceiver *p, EOpacket *pkt, uint16_t *numberofrops, eOabstime_t* txtime); 
 
 extern eOresult_t eo_transceiver_NumberofOutROPs(EOtransceiver *p, uint16_t *numberofreplies, uint16_t *numberofoccasionals, uint16_t *numberofregulars);
@@ -172,6 +203,50 @@ extern eOresult_t eo_transceiver_RegularROP_Unload(EOtransceiver *p, eOropdescri
 extern eOresult_t eo_transceiver_LoadReplyInProxy(EOtransceiver *p, eOnvID32_t id32, void* data);
 
 
+/** @fn         extern uint32_t eo_transceiver_Snapshot_Size(EOtransceiver *p)
+    @brief      returns the bytes required to save a snapshot of the transceiver: the configuration and the ram of the endpoints
+                in its EOnvSet and the list of its regular rops.
+    @param      p               the object
+    @return     the size in bytes or 0 if p is NULL.
+ **/
+extern uint32_t eo_transceiver_Snapshot_Size(EOtransceiver *p);
+
+
+/** @fn         extern eOresult_t eo_transceiver_Snapshot_Save(EOtransceiver *p, void *blob, uint32_t capacity, uint32_t *size)
+    @brief      saves a snapshot of the transceiver inside blob. the blob has no pointers and is in the native byte order, thus
+                it can be restored by a process which restarts on the same host. writing it to a file or mapping it in memory
+                is a duty of the caller.
+    @param      p               the object
+    @param      blob            a 4-aligned memory of at least eo_transceiver_Snapshot_Size() bytes
+    @param      capacity        the bytes of blob
+    @param      size            the bytes used by the snapshot
+    @return     eores_OK or eores_NOK_nullpointer / eores_NOK_generic if the blob is too small.
+ **/
+extern eOresult_t eo_transceiver_Snapshot_Save(EOtransceiver *p, void *blob, uint32_t capacity, uint32_t *size);
+
+
+/** @fn         extern eOresult_t eo_transceiver_Snapshot_Restore(EOtransceiver *p, const void *blob, uint32_t size)
+    @brief      restores a snapshot in a transceiver which has just been created. the endpoints of the EOnvSet are loaded 
+                if it does not have any, their netvars are initialised and then their ram gets the saved values. at last the 
+                regular rops replace the current ones.
+    @param      p               the object
+    @param      blob            the snapshot
+    @param      size            the bytes of blob
+    @return     eores_OK or eores_NOK_nullpointer / eores_NOK_generic if the snapshot is not valid or some regular cannot be loaded.
+ **/
+extern eOresult_t eo_transceiver_Snapshot_Restore(EOtransceiver *p, const void *blob, uint32_t size);
+
+
+/** @fn         extern eOresult_t eo_transceiver_Footprint_Get(EOtransceiver *p, eOtransceiver_footprint_t *footprint)
+    @brief      computes the memory used by the transceiver from the capacities of its objects, so that the sizes in its 
+                configuration can be tuned vs the ram of the board. 
+    @param      p               the object
+    @param      footprint       in output
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eo_transceiver_Footprint_Get(EOtransceiver *p, eOtransceiver_footprint_t *footprint);
+
+
 
 /** @}            
     end of group eo_transceiver  
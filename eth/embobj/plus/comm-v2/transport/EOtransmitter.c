@@ -27,6 +27,7 @@
 #include "EOtheParser.h"
 #include "EOtheFormer.h"
 #include "EOropframe_hid.h"
+#include "EOpacket_hid.h"
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
 #include "EOVtheSystem.h"
@@ -93,7 +94,7 @@ static void s_eo_transmitter_list_updaterop_in_ropframe(void *item, void *param)
 
 static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param);
 
-static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived *mtx);
+static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOrop* roptmp, EOVmutexDerived *mtxrop, EOVmutexDerived *mtx);
 
 static EOropframe * s_eo_transmitter_id32_to_typeofregulars(EOtransmitter* p, eOprotID32_t id32, eo_transm_regropframe_t *ropframetype);
 
@@ -108,6 +109,12 @@ static void s_eo_transmitter_regulars_reset_sizes(EOtransmitter *p);
 
 static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, int16_t ropbytes);
 
+static void s_eo_transmitter_txdecimation_adapt(EOtransmitter *p, uint16_t txsize, uint16_t occasionalsbacklog);
+
+static eObool_t s_eo_transmitter_txdecimation_step(uint8_t *decimation, uint8_t minimum, uint8_t maximum, eObool_t increase);
+
+static uint16_t s_eo_transmitter_bulk_Load(EOtransmitter *p);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -181,6 +188,8 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     retptr->ropframeoccasionals     = eo_ropframe_New();
     retptr->ropframereplies         = eo_ropframe_New();
     retptr->roptmp                  = eo_rop_New(cfg->sizes.capacityofrop);
+    retptr->roptmpoccasionals       = eo_rop_New(cfg->sizes.capacityofrop);
+    retptr->roptmpreplies           = eo_rop_New(cfg->sizes.capacityofrop);
     retptr->agent                   = cfg->agent;
     retptr->nvset                   = eo_agent_GetNVset(cfg->agent);
     retptr->confmanager             = eo_agent_GetConfirmationManager(cfg->agent);
@@ -240,14 +249,16 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
         retptr->mtx_replies     = cfg->mutex_fn_new();
         retptr->mtx_regulars    = cfg->mutex_fn_new();
         retptr->mtx_occasionals = cfg->mutex_fn_new(); 
-        retptr->mtx_roptmp      = cfg->mutex_fn_new();
+        retptr->mtx_roptmpoccasionals   = cfg->mutex_fn_new();
+        retptr->mtx_roptmpreplies       = cfg->mutex_fn_new();
     }
     else
     {
         retptr->mtx_replies     = NULL;
         retptr->mtx_regulars    = NULL;
         retptr->mtx_occasionals = NULL;
-        retptr->mtx_roptmp      = NULL;
+        retptr->mtx_roptmpoccasionals   = NULL;
+        retptr->mtx_roptmpreplies       = NULL;
     }
     
 #if defined(USE_DEBUG_EOTRANSMITTER)
@@ -264,6 +275,13 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     retptr->txdecimationreplies = 1;
     retptr->txdecimationoccasionals = 1;
     retptr->txdecimationregulars = 1;
+    retptr->txdecimationcycledregulars = 1;
+    memset(&retptr->adaptive, 0, sizeof(retptr->adaptive));
+    retptr->adaptive.enabled = eobool_false;
+    retptr->adaptive.minimum.replies = 1;
+    retptr->adaptive.minimum.regulars = 1;
+    retptr->adaptive.minimum.occasionals = 1;
+    retptr->adaptive.minimum.cycledregulars = 1;
 
     s_eo_transmitter_regulars_reset_sizes(retptr);
     
@@ -298,10 +316,14 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
     {
         eov_mutex_Delete(p->mtx_occasionals);
     }
-    if(NULL != p->mtx_roptmp)
+    if(NULL != p->mtx_roptmpoccasionals)
     {
-        eov_mutex_Delete(p->mtx_roptmp);        
-    }   
+        eov_mutex_Delete(p->mtx_roptmpoccasionals);
+    }
+    if(NULL != p->mtx_roptmpreplies)
+    {
+        eov_mutex_Delete(p->mtx_roptmpreplies);
+    }
 
     if(NULL != p->listofregropinfo)
     {
@@ -334,6 +356,8 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
     }  
     
     eo_rop_Delete(p->roptmp);
+    eo_rop_Delete(p->roptmpoccasionals);
+    eo_rop_Delete(p->roptmpreplies);
     
     eo_ropframe_Delete(p->ropframereadytotx);
     eo_ropframe_Delete(p->ropframeregulars_standard);
@@ -501,6 +525,69 @@ extern eOresult_t eo_transmitter_regular_rops_arrayid32_Get(EOtransmitter *p, ui
 }
 
 
+extern eOresult_t eo_transmitter_regular_rops_Snapshot_Get(EOtransmitter *p, eOtransmitter_regularrop_t *rops, uint16_t capacity, uint16_t *number)
+{
+    uint16_t size = 0;
+    uint16_t i = 0;
+    EOlistIter* li = NULL;
+
+    if((NULL == p) || (NULL == number)) 
+    {
+        return(eores_NOK_nullpointer);
+    }  
+    
+    *number = 0;
+
+    if(NULL == p->listofregropinfo)
+    {
+        // in such a case there is room for regular rops (for instance because the cfg->maxnumberofregularrops is zero)
+        return(eores_OK);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    size = eo_list_Size(p->listofregropinfo);
+    
+    if(NULL == rops)
+    {
+        *number = size;
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_OK);
+    }
+    
+    if(size > capacity)
+    {
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_NOK_generic);
+    }
+    
+    li = eo_list_Begin(p->listofregropinfo);
+    for(i=0; i<size; i++)
+    {
+        eo_transm_regrop_info_t *item = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+        // the head of the rop is inside the regular ropframe. the signature, if any, is after the data and before the time
+        eOrophead_t *head = (eOrophead_t*) eo_ropframe_hid_get_pointer_offset(item->ropframe, item->ropstarthere);
+        li = eo_list_Next(p->listofregropinfo, li);
+        
+        memset(&rops[i], 0, sizeof(eOtransmitter_regularrop_t));
+        rops[i].control     = head->ctrl;
+        rops[i].ropcode     = head->ropc;
+        rops[i].id32        = head->id32;
+        if(1 == head->ctrl.plussign)
+        {
+            uint16_t signoffset = item->ropsize - 4 - ((1 == head->ctrl.plustime) ? (8) : (0));
+            memcpy(&rops[i].signature, ((uint8_t*)head) + signoffset, 4);
+        }
+    }
+    
+    *number = size;
+
+    eov_mutex_Release(p->mtx_regulars);
+    
+    return(eores_OK);   
+}
+
+
 extern eOresult_t eo_transmitter_regular_rops_arrayid32_ep_Get(EOtransmitter *p, eOnvEP8_t ep, uint16_t start, EOarray* array)
 {
     uint16_t size = 0;
@@ -674,15 +761,12 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
         ropdescriptor.data = NULL;
     }
 
-    // lock tmprop
-    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
-    
+    // p->roptmp is used only by the regulars, thus mtx_regulars already protects it
     res = eo_agent_OutROPprepare(p->agent, &nv, &ropdescriptor, p->roptmp, &usedbytes);   
     
     // if we cannot prepare the rop ... we quit
     if(eores_OK != res)
     {
-        eov_mutex_Release(p->mtx_roptmp);
         eov_mutex_Release(p->mtx_regulars);
         return(res);
     }
@@ -699,7 +783,6 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     // with knowledge of regropframe2use_type and of usedbytes. 
     if(eobool_false == s_eo_transmitter_regulars_canadd_rop(p, regropframe2use_type, usedbytes))
     {   // cannot load the rop because we dont have usedbytes anymore
-        eov_mutex_Release(p->mtx_roptmp);
         eov_mutex_Release(p->mtx_regulars);
         return(eores_NOK_generic);        
     }
@@ -709,7 +792,6 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     // if we cannot add the rop, then we quit ....
     if(eores_OK != res)
     {
-        eov_mutex_Release(p->mtx_roptmp);
         eov_mutex_Release(p->mtx_regulars);
         return(res);
     }
@@ -733,7 +815,6 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     // increment size of the relevant regular ropframe
     s_eo_transmitter_regulars_update_sizes(p, regropframe2use_type, +regropinfo.ropsize); // with a + we increment
     
-    eov_mutex_Release(p->mtx_roptmp);
     eov_mutex_Release(p->mtx_regulars);  
     
     return(eores_OK);   
@@ -1003,6 +1084,8 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
 extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
 {
     uint16_t remainingbytes;
+    uint16_t occasionalsbacklog = 0;
+    uint16_t txsize = 0;
 
     if(NULL == p) 
     {
@@ -1019,6 +1102,15 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
     // clear the content of the ropframe to transmit which uses the same storage of the packet ...
     eo_ropframe_Clear(p->ropframereadytotx);
     
+    // the adaptive decimation needs the bytes waiting in the occasionals before they are eventually sent
+    if(eobool_true == p->adaptive.enabled)
+    {
+        eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
+        eo_ropframe_Size_Get(p->ropframeoccasionals, &occasionalsbacklog);
+        eov_mutex_Release(p->mtx_occasionals);
+        occasionalsbacklog = (occasionalsbacklog > eo_ropframe_sizeforZEROrops) ? (occasionalsbacklog - eo_ropframe_sizeforZEROrops) : (0);
+    }
+    
 //    // add to it the ropframe of regulars. keep it afterwards. dont clear it !!!
 //    if(0 == (p->txdecimationprogressive % p->txdecimationregulars))
 //    {
@@ -1140,6 +1232,16 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
         eo_ropframe_Append(p->ropframereadytotx, p->ropframereplies, &remainingbytes);
         eo_ropframe_Clear(p->ropframereplies);
         eov_mutex_Release(p->mtx_replies);
+        
+        // the say<> of a bulk ask<> take the room which is left. the others go out with the next ropframes
+        if(NULL != ropsnum)
+        {
+            ropsnum->numberofreplies += s_eo_transmitter_bulk_Load(p);
+        }
+        else
+        {
+            s_eo_transmitter_bulk_Load(p);
+        }
     }
 
 
@@ -1150,6 +1252,13 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
         *numberofrops = eo_ropframe_ROP_NumberOf(p->ropframereadytotx);   
     }
     
+    // an empty ropframe is not transmitted, thus it does not load the link
+    if(0 != eo_ropframe_ROP_NumberOf(p->ropframereadytotx))
+    {
+        eo_ropframe_Size_Get(p->ropframereadytotx, &txsize);
+    }
+    s_eo_transmitter_txdecimation_adapt(p, txsize, occasionalsbacklog);
+    
     // finally we must increment the txdecimationprogressive
     p->txdecimationprogressive ++;
     
@@ -1177,14 +1286,138 @@ extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repl
         occasionalsTXdecimation = 1;
     }
     
-    p->txdecimationreplies      = repliesTXdecimation;
-    p->txdecimationregulars     = regularsTXdecimation;
-    p->txdecimationoccasionals  = occasionalsTXdecimation;
+    p->adaptive.minimum.replies         = repliesTXdecimation;
+    p->adaptive.minimum.regulars        = regularsTXdecimation;
+    p->adaptive.minimum.occasionals     = occasionalsTXdecimation;
+    
+    if(eobool_false == p->adaptive.enabled)
+    {
+        p->txdecimationreplies      = repliesTXdecimation;
+        p->txdecimationregulars     = regularsTXdecimation;
+        p->txdecimationoccasionals  = occasionalsTXdecimation;
+    }
+    else
+    {   // the values are the lower bounds of the adaptive decimation
+        p->txdecimationreplies      = EO_MAX(p->txdecimationreplies, repliesTXdecimation);
+        p->txdecimationregulars     = EO_MAX(p->txdecimationregulars, regularsTXdecimation);
+        p->txdecimationoccasionals  = EO_MAX(p->txdecimationoccasionals, occasionalsTXdecimation);        
+    }
+    
+    return(eores_OK);       
+}
+
+
+extern eOresult_t eo_transmitter_TXdecimation_Adaptive_Set(EOtransmitter *p, const eOtransmitter_txdecimation_adaptive_t *adaptive)
+{
+    eOtransmitter_adaptive_t *a = NULL;
     
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    a = &p->adaptive;
+    
+    // restart from the lower bounds in both cases 
+    p->txdecimationreplies          = a->minimum.replies;
+    p->txdecimationregulars         = a->minimum.regulars;
+    p->txdecimationoccasionals      = a->minimum.occasionals;
+    p->txdecimationcycledregulars   = a->minimum.cycledregulars;
     
-    return(eores_NOK_nullpointer);       
+    a->frames   = 0;
+    a->bytes    = 0;
+    a->fills    = 0;
+    a->backlog  = 0;
+    a->inboundlostseen = a->inboundlost;
+    
+    if(NULL == adaptive)
+    {
+        a->enabled = eobool_false;
+        return(eores_OK);
+    }
+    
+    memcpy(&a->bounds, adaptive, sizeof(eOtransmitter_txdecimation_adaptive_t));
+    
+    // the upper bounds cannot be lower than the lower bounds
+    a->bounds.window                        = EO_MAX(a->bounds.window, 1);
+    a->bounds.maxdecimationreplies          = EO_MAX(a->bounds.maxdecimationreplies, a->minimum.replies);
+    a->bounds.maxdecimationregulars         = EO_MAX(a->bounds.maxdecimationregulars, a->minimum.regulars);
+    a->bounds.maxdecimationoccasionals      = EO_MAX(a->bounds.maxdecimationoccasionals, a->minimum.occasionals);
+    a->bounds.maxdecimationcycledregulars   = EO_MAX(a->bounds.maxdecimationcycledregulars, a->minimum.cycledregulars);
+    
+    a->enabled = eobool_true;
+    
+    return(eores_OK);
 }
 
+
+extern eOresult_t eo_transmitter_TXdecimation_Get(EOtransmitter *p, eOtransmitter_txdecimation_t *txdecimation)
+{
+    if((NULL == p) || (NULL == txdecimation)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    txdecimation->replies           = p->txdecimationreplies;
+    txdecimation->regulars          = p->txdecimationregulars;
+    txdecimation->occasionals       = p->txdecimationoccasionals;
+    txdecimation->cycledregulars    = p->txdecimationcycledregulars;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_transmitter_TXdecimation_InboundLost_Set(EOtransmitter *p, uint32_t inboundlost)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // only this function writes inboundlost and only s_eo_transmitter_txdecimation_adapt() writes inboundlostseen: no need of a mutex
+    p->adaptive.inboundlost = inboundlost;
+    
+    return(eores_OK);
+}
+
+extern uint32_t eo_transmitter_Footprint(EOtransmitter *p, uint16_t *mutexes)
+{
+    uint32_t bytes = 0;
+    uint16_t capacity = 0;
+    
+    if(NULL != mutexes)
+    {
+        *mutexes = 0;
+    }
+    
+    if(NULL == p) 
+    {
+        return(0);
+    }
+    
+    bytes = sizeof(EOtransmitter);
+    
+    // the ropframereadytotx uses the memory of the txpacket, the others have their own buffer
+    bytes += 6*sizeof(EOropframe);
+    bytes += p->ropframeregulars_standard->capacity + p->ropframeregulars_cycle0of->capacity + p->ropframeregulars_cycle1of->capacity;
+    bytes += p->ropframeoccasionals->capacity + p->ropframereplies->capacity;
+    
+    bytes += eo_rop_Footprint(p->roptmp) + eo_rop_Footprint(p->roptmpoccasionals) + eo_rop_Footprint(p->roptmpreplies);
+    
+    eo_packet_Capacity_Get(p->txpacket, &capacity);
+    bytes += sizeof(EOpacket) + capacity;
+    
+    bytes += eo_list_Footprint(p->listofregropinfo);
+    
+    if(NULL != mutexes)
+    {
+        *mutexes = (NULL == p->mtx_replies) ? (0) : (5);
+    }
+    
+    return(bytes);    
+}
+
+
 extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outpkt)
 {
     uint16_t size;
@@ -1255,13 +1488,13 @@ extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, i
 
 extern eOresult_t eo_transmitter_occasional_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
 {   // we dont care about p->ropframeoccasionals being invalid because all controls are inside s_eo_transmitter_rops_Load().
-    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframeoccasionals, p->mtx_occasionals));
+    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframeoccasionals, p->roptmpoccasionals, p->mtx_roptmpoccasionals, p->mtx_occasionals));
 }
 
 
 extern eOresult_t eo_transmitter_reply_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
 {   // we dont care about p->ropframereplies being invalid because all controls are inside s_eo_transmitter_rops_Load().
-    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframereplies, p->mtx_replies));
+    return(s_eo_transmitter_rops_Load(p, ropdesc, p->ropframereplies, p->roptmpreplies, p->mtx_roptmpreplies, p->mtx_replies));
 }
 
 
@@ -1396,15 +1629,19 @@ static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param)
 }
 
 
-static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived* mtx)
+static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOrop* roptmp, EOVmutexDerived *mtxrop, EOVmutexDerived* mtx)
 {
-    // marco.accame on 23oct14: mtx protects the occasional or replies ropframe. p->mtx_roptmp protects the use of tmprop
+    // mtx protects the occasional or replies ropframe, and mtxrop protects roptmp, which is private to that ropframe. 
+    // in this way the replies loaded by the rx path and the occasionals loaded by the tx path never wait for each other.
+    // moreover, the value of the nv is copied into roptmp before mtx is taken, so that the tx of the ropframe never
+    // waits for the mutex of a nv.
     eOresult_t res;
     uint16_t usedbytes;
     uint16_t ropsize;
     uint16_t remainingbytes;   
     EOnv nv;
     eObool_t boolres = eobool_false;
+    eObool_t isbulkask = eobool_false;
     
     if((NULL == p) || (NULL == ropdesc)) 
     {
@@ -1428,12 +1665,27 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
         return(eores_NOK_generic);
     }
     
+    // a rop with confirmation request is sent only if the window of the confirmation manager has room for it
+    if((1 == ropdesc->control.rqstconf) && (NULL != p->confmanager) && (eobool_false == eo_confman_ConfirmationRequest_CanInsert(p->confmanager, ropdesc)))
+    {
+        p->lasterror = 6;
+        return(eores_NOK_busy);
+    }
+    
       
     res = eo_nvset_NV_Get(  (p->nvset),  
                             ropdesc->id32,
                             &nv
                             );   
 
+    // a bulk ask<> does not refer to any netvar: it goes out with a cleared nv and, as any ask<>, without data
+    if((eores_OK != res) && (eo_ropcode_ask == ropdesc->ropcode) && (eobool_true == eoprot_ID_isbulk(ropdesc->id32)))
+    {
+        eo_nv_Clear(&nv);
+        isbulkask = eobool_true;
+        res = eores_OK;
+    }
+
     // if the nvset does not have the pair (ip, id) then we return an error because we cannot form the rop
     if(eores_OK != res)
     {
@@ -1442,7 +1694,7 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     } 
 
     // force size to be coherent with the nv. the size is always used, even if there is no data to transmit
-    ropdesc->size = eo_nv_Size(&nv);    
+    ropdesc->size = (eobool_true == isbulkask) ? (0) : (eo_nv_Size(&nv));    
     
     // now we have the nv. we set its value in local ram
     if(eobool_true == eo_rop_ropcode_has_data(ropdesc->ropcode))
@@ -1468,25 +1720,24 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     }
 
 
-    // we begin the use in rw of p->tmprop: take its mutex ... we must avoid that a concurrent thread use it at the same time.
-    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
+    // the snapshot of the nv goes into roptmp under mtxrop only. the ropframe is locked just for the copy of roptmp
+    eov_mutex_Take(mtxrop, eok_reltimeINFINITE);
            
-    res = eo_agent_OutROPprepare(p->agent, &nv, ropdesc, p->roptmp, &usedbytes);    
+    res = eo_agent_OutROPprepare(p->agent, &nv, ropdesc, roptmp, &usedbytes);    
     
     if(eores_OK != res)
     {
         p->lasterror = 4;
-        eov_mutex_Release(p->mtx_roptmp);
+        eov_mutex_Release(mtxrop);
         return(res);
     }
 
-    // put the rop inside the ropframe: protec ropframe vs concurrent use
+    // put the rop inside the ropframe
     eov_mutex_Take(mtx, eok_reltimeINFINITE);
-    res = eo_ropframe_ROP_Add(intoropframe, p->roptmp, NULL, &ropsize, &remainingbytes);
+    res = eo_ropframe_ROP_Add(intoropframe, roptmp, NULL, &ropsize, &remainingbytes);
     eov_mutex_Release(mtx);
     
-    // we dont use p->tmprop anymore: release its mutex
-    eov_mutex_Release(p->mtx_roptmp);
+    eov_mutex_Release(mtxrop);
     
     if(eores_OK != res)
     {
@@ -1549,9 +1800,11 @@ static EOropframe * s_eo_transmitter_get_cycled_regropframe(EOtransmitter* p, ui
     EOropframe* ret = NULL;
     uint16_t s0 = eo_ropframe_ROP_NumberOf(p->ropframeregulars_cycle0of);
     uint16_t s1 = eo_ropframe_ROP_NumberOf(p->ropframeregulars_cycle1of);
+    // the cycled regulars are appended only once every txdecimationcycledregulars regulars
+    uint64_t cycledprogressive = p->txregularsprogressive / p->txdecimationcycledregulars;
     
-    if(0 == (s0+s1))
-    {   // we dont have any
+    if((0 == (s0+s1)) || (0 != (p->txregularsprogressive % p->txdecimationcycledregulars)))
+    {   // we dont have any or it is not their turn
         ret = NULL;
         *ropsinside = 0;
     }
@@ -1567,7 +1820,7 @@ static EOropframe * s_eo_transmitter_get_cycled_regropframe(EOtransmitter* p, ui
     }
     else
     {   // we have both. i must alternate
-        if(0 == (p->txregularsprogressive % 2))
+        if(0 == (cycledprogressive % 2))
         {   // we chose cycle0
             ret = p->ropframeregulars_cycle0of;
             *ropsinside = s0;
@@ -1652,6 +1905,149 @@ static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_r
     p->maxsizeofregulars = s_eo_transmitter_get_maxsizeof_regularsropframe(p);
 }
 
+static void s_eo_transmitter_txdecimation_adapt(EOtransmitter *p, uint16_t txsize, uint16_t occasionalsbacklog)
+{
+    eOtransmitter_adaptive_t *a = &p->adaptive;
+    uint16_t capacity = 0;
+    uint32_t lost = 0;
+    uint32_t fill = 0;
+    eObool_t congested = eobool_false;
+    eObool_t idle = eobool_false;
+    eObool_t changed = eobool_false;
+    
+    if(eobool_false == a->enabled)
+    {
+        return;
+    }
+    
+    // accumulate the measures of the window
+    eo_packet_Capacity_Get(p->txpacket, &capacity);
+    a->frames ++;
+    a->bytes += txsize;
+    a->fills += (0 == capacity) ? (0) : ((100 * (uint32_t)txsize) / capacity);
+    a->backlog = EO_MAX(a->backlog, occasionalsbacklog);
+    
+    if(a->frames < a->bounds.window)
+    {
+        return;
+    }
+    
+    // the window is over: evaluate the load of the link. the loss is the inbound one, as the peer does not report what it 
+    // misses from us. the difference of the lost ropframes is correct also when the counter wraps 
+    lost = a->inboundlost - a->inboundlostseen;
+    a->inboundlostseen += lost;
+    fill = a->fills / a->frames;
+    
+    congested = ((0 != lost) || (fill > a->bounds.highfill) || ((0 != a->bounds.bytebudget) && (a->bytes > a->bounds.bytebudget))) ? (eobool_true) : (eobool_false);
+    idle = ((0 == lost) && (fill < a->bounds.lowfill) && ((0 == a->bounds.bytebudget) || (4*a->bytes < 3*(uint32_t)a->bounds.bytebudget))) ? (eobool_true) : (eobool_false);
+    
+    // the occasionals which are waiting too much get priority in any case 
+    if(a->backlog > a->bounds.maxoccasionalsbacklog)
+    {
+        s_eo_transmitter_txdecimation_step(&p->txdecimationoccasionals, a->minimum.occasionals, a->bounds.maxdecimationoccasionals, eobool_false);
+    }
+    else if(eobool_true == congested)
+    {   // we decimate more. at first what is less important: the cycled regulars, then the regulars, ... at last the replies
+        changed = s_eo_transmitter_txdecimation_step(&p->txdecimationcycledregulars, a->minimum.cycledregulars, a->bounds.maxdecimationcycledregulars, eobool_true);
+        if(eobool_false == changed)
+        {
+            changed = s_eo_transmitter_txdecimation_step(&p->txdecimationregulars, a->minimum.regulars, a->bounds.maxdecimationregulars, eobool_true);
+        }
+        if(eobool_false == changed)
+        {
+            changed = s_eo_transmitter_txdecimation_step(&p->txdecimationoccasionals, a->minimum.occasionals, a->bounds.maxdecimationoccasionals, eobool_true);
+        }
+        if(eobool_false == changed)
+        {
+            changed = s_eo_transmitter_txdecimation_step(&p->txdecimationreplies, a->minimum.replies, a->bounds.maxdecimationreplies, eobool_true);
+        }
+    }
+    
+    if((eobool_false == congested) && (eobool_true == idle))
+    {   // we decimate less in the opposite order 
+        changed = s_eo_transmitter_txdecimation_step(&p->txdecimationreplies, a->minimum.replies, a->bounds.maxdecimationreplies, eobool_false);
+        if(eobool_false == changed)
+        {
+            changed = s_eo_transmitter_txdecimation_step(&p->txdecimationoccasionals, a->minimum.occasionals, a->bounds.maxdecimationoccasionals, eobool_false);
+        }
+        if(eobool_false == changed)
+        {
+            changed = s_eo_transmitter_txdecimation_step(&p->txdecimationregulars, a->minimum.regulars, a->bounds.maxdecimationregulars, eobool_false);
+        }
+        if(eobool_false == changed)
+        {
+            changed = s_eo_transmitter_txdecimation_step(&p->txdecimationcycledregulars, a->minimum.cycledregulars, a->bounds.maxdecimationcycledregulars, eobool_false);
+        }        
+    }
+    
+    // start a new window
+    a->frames   = 0;
+    a->bytes    = 0;
+    a->fills    = 0;
+    a->backlog  = 0;
+}
+
+
+static eObool_t s_eo_transmitter_txdecimation_step(uint8_t *decimation, uint8_t minimum, uint8_t maximum, eObool_t increase)
+{
+    if((eobool_true == increase) && (*decimation < maximum))
+    {
+        (*decimation) ++;
+        return(eobool_true);
+    }
+    
+    if((eobool_false == increase) && (*decimation > minimum))
+    {
+        (*decimation) --;
+        return(eobool_true);
+    }
+    
+    return(eobool_false);
+}
+
+
+// it adds to the ropframe ready to tx the say<> of the wholeitems requested by a bulk ask<> as long as there is room.
+// it returns the number of added rops.
+static uint16_t s_eo_transmitter_bulk_Load(EOtransmitter *p)
+{
+    eOropdescriptor_t ropdesc;
+    eOprotID32_t id32 = 0;
+    uint16_t numberofrops = 0;
+    EOnv nv;
+    
+    while(eores_OK == eo_agent_BulkROP_Get(p->agent, &id32))
+    {
+        if((eores_OK != eo_nvset_NV_Get(p->nvset, id32, &nv)) || (eo_nv_Size(&nv) > p->roptmpreplies->stream.capacity))
+        {   // a wholeitem which does not fit into a rop can never be sent: we skip it 
+            eo_agent_BulkROP_Next(p->agent);
+            continue;
+        }
+        
+        memcpy(&ropdesc, &eok_ropdesc_basic, sizeof(eOropdescriptor_t));
+        ropdesc.ropcode = eo_ropcode_say;
+        ropdesc.id32    = id32;
+        
+        // p->ropframereadytotx is used only by the tx path, thus it needs no mutex, but p->roptmpreplies is shared with 
+        // the rx path under p->mtx_roptmpreplies 
+        if(eores_OK != s_eo_transmitter_rops_Load(p, &ropdesc, p->ropframereadytotx, p->roptmpreplies, p->mtx_roptmpreplies, NULL))
+        {
+            if(0 == eo_ropframe_ROP_NumberOf(p->ropframereadytotx))
+            {   // it does not fit even into an empty ropframe: we skip it 
+                eo_agent_BulkROP_Next(p->agent);
+                continue;
+            }
+            // else it will go out with the next ropframe
+            break;
+        }
+        
+        eo_agent_BulkROP_Next(p->agent);
+        numberofrops ++;
+    }
+    
+    return(numberofrops);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
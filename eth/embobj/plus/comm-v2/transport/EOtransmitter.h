@@ -101,6 +101,55 @@ typedef struct
     uint8_t     numberofregulars;
     uint8_t     numberofreplies;    
 } eOtransmitter_ropsnumber_t;
+
+
+/** @typedef    typedef struct eOtransmitter_txdecimation_adaptive_t
+    @brief      contains the bounds used by the closed-loop control of the tx decimation. the control measures, over a window 
+                of calls of eo_transmitter_outpacket_Prepare(), the transmitted bytes, the fill of the transmitted ropframe, the 
+                backlog of the occasionals and the ropframes of the peer lost on their way to us (see 
+                eo_transmitter_TXdecimation_InboundLost_Set()). at the end of each window it increases by one step the 
+                decimation of the cycled regulars, then of the regulars, then of the occasionals and at last of the replies if the 
+                link is congested, and it decreases them in the opposite order if the link is idle. the decimations never go below 
+                the values given by eo_transmitter_TXdecimation_Set() and never above the maximum values in here.
+ **/
+typedef struct
+{
+    uint16_t    window;                     /**< number of calls of eo_transmitter_outpacket_Prepare() over which the load is measured */
+    uint16_t    bytebudget;                 /**< max bytes to transmit inside the window. if 0 it is not used */
+    uint8_t     highfill;                   /**< average percentage of fill of the transmitted ropframe above which the link is congested */
+    uint8_t     lowfill;                    /**< average percentage of fill of the transmitted ropframe below which the link is idle */
+    uint16_t    maxoccasionalsbacklog;      /**< bytes waiting in the occasionals above which their decimation is decreased first */
+    uint8_t     maxdecimationreplies;
+    uint8_t     maxdecimationregulars;
+    uint8_t     maxdecimationoccasionals;
+    uint8_t     maxdecimationcycledregulars;/**< the cycled regulars are appended only once every such many regulars */
+} eOtransmitter_txdecimation_adaptive_t;
+
+
+/** @typedef    typedef struct eOtransmitter_regularrop_t
+    @brief      contains what is needed to load again a regular rop with eo_transmitter_regular_rops_Load(). it has no pointers, 
+                thus it can be stored in a file.
+ **/
+typedef struct      // 12 bytes
+{
+    eOropctrl_t     control;
+    eOropcode_t     ropcode;
+    uint16_t        dummy;
+    eOnvID32_t      id32;
+    uint32_t        signature;
+} eOtransmitter_regularrop_t;   EO_VERIFYsizeof(eOtransmitter_regularrop_t, 12);
+
+
+/** @typedef    typedef struct eOtransmitter_txdecimation_t
+    @brief      contains the decimations currently used by the transmitter.
+ **/
+typedef struct
+{
+    uint8_t     replies;
+    uint8_t     regulars;
+    uint8_t     occasionals;
+    uint8_t     cycledregulars;
+} eOtransmitter_txdecimation_t;
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -150,6 +199,50 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
 
 extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repliesTXdecimation, uint8_t regularsTXdecimation, uint8_t occasionalsTXdecimation);
 
+
+/** @fn         extern eOresult_t eo_transmitter_TXdecimation_Adaptive_Set(EOtransmitter *p, const eOtransmitter_txdecimation_adaptive_t *adaptive)
+    @brief      enables the closed-loop control of the tx decimation. the values given by eo_transmitter_TXdecimation_Set() 
+                become the lower bounds of the decimations.
+    @param      p               the object
+    @param      adaptive        the bounds of the control. if NULL the control is disabled and the decimations go back to 
+                                the values given by eo_transmitter_TXdecimation_Set().
+    @return     eores_OK or eores_NOK_nullpointer
+ **/
+extern eOresult_t eo_transmitter_TXdecimation_Adaptive_Set(EOtransmitter *p, const eOtransmitter_txdecimation_adaptive_t *adaptive);
+
+
+/** @fn         extern eOresult_t eo_transmitter_TXdecimation_Get(EOtransmitter *p, eOtransmitter_txdecimation_t *txdecimation)
+    @brief      retrieves the decimations currently in use.
+    @param      p               the object
+    @param      txdecimation    in output
+    @return     eores_OK or eores_NOK_nullpointer
+ **/
+extern eOresult_t eo_transmitter_TXdecimation_Get(EOtransmitter *p, eOtransmitter_txdecimation_t *txdecimation);
+
+
+/** @fn         extern eOresult_t eo_transmitter_TXdecimation_InboundLost_Set(EOtransmitter *p, uint32_t inboundlost)
+    @brief      tells the closed-loop control how many ropframes sent by the peer went lost before reaching us so far. it is 
+                the cumulative value given by eo_receiver_GetLostRopframes(). the protocol does not carry any report of the 
+                ropframes which the peer has lost from us, thus the inbound loss is used as a sign of congestion of the link: 
+                a link which drops only the outbound packets is not detected. it may be called by a thread other than the 
+                one which calls eo_transmitter_outpacket_Prepare().
+    @param      p               the object
+    @param      inboundlost     the cumulative number of ropframes of the peer which went lost
+    @return     eores_OK or eores_NOK_nullpointer
+ **/
+extern eOresult_t eo_transmitter_TXdecimation_InboundLost_Set(EOtransmitter *p, uint32_t inboundlost);
+
+
+/** @fn         extern uint32_t eo_transmitter_Footprint(EOtransmitter *p, uint16_t *mutexes)
+    @brief      computes the bytes of memory used by the transmitter: the object, its ropframes with their buffers, the
+                rops, the tx packet and the list of the regulars. the memory of the mutexes depends on the EOVmutexDerived
+                in use, thus they are only counted.
+    @param      p               the object
+    @param      mutexes         if not NULL, in output it contains the number of mutexes used by the transmitter
+    @return     the number of bytes, or 0 if p is NULL
+ **/
+extern uint32_t eo_transmitter_Footprint(EOtransmitter *p, uint16_t *mutexes);
+
 // the rops in regular_rops stay forever unless unloaded one by one or all cleared. at each eo_transmitter_outpacket_Prepare() they are placed 
 // inside the packet. they however need an explicit refresh of their values. 
 extern eOsizecntnr_t eo_transmitter_regular_rops_Size(EOtransmitter *p);
@@ -161,6 +254,9 @@ extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdesc
 extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eOnvEP8_t ep8, eOnvENT_t ent);
 extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p); 
 extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p);
+// it copies the regular rops in their order of loading into rops, which has room for capacity items. if rops is NULL it only gives 
+// back their number. 
+extern eOresult_t eo_transmitter_regular_rops_Snapshot_Get(EOtransmitter *p, eOtransmitter_regularrop_t *rops, uint16_t capacity, uint16_t *number);
 
 // the rops in occasional_rops are inserted with following functions, put inside the packet with function eo_transmitter_outpacket_Get()
 // and after that they are cleared.
@@ -82,6 +82,20 @@ typedef struct
 } EOtransmitterDEBUG_t;
 
 
+typedef struct
+{
+    eObool_t                                enabled;
+    eOtransmitter_txdecimation_adaptive_t   bounds;
+    eOtransmitter_txdecimation_t            minimum;        // the values given by eo_transmitter_TXdecimation_Set()
+    uint16_t                                frames;         // calls of eo_transmitter_outpacket_Prepare() inside the current window
+    uint32_t                                bytes;          // bytes transmitted inside the current window
+    uint32_t                                fills;          // sum of the percentages of fill inside the current window
+    uint16_t                                backlog;        // max bytes waiting in the occasionals inside the current window
+    uint32_t                                inboundlost;    // ropframes of the peer lost on their way to us, written by eo_transmitter_TXdecimation_InboundLost_Set()
+    uint32_t                                inboundlostseen;// value of inboundlost at the end of the previous window
+} eOtransmitter_adaptive_t;
+
+
 /** @struct     EOtransmitter_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -97,7 +111,9 @@ struct EOtransmitter_hid
     EOropframe*                 ropframeregulars_cycle1of;  
     EOropframe*                 ropframeoccasionals;    
     EOropframe*                 ropframereplies;
-    EOrop*                      roptmp;
+    EOrop*                      roptmp;             // used only by the regulars, under mtx_regulars
+    EOrop*                      roptmpoccasionals;  // used only by the occasionals, under mtx_roptmpoccasionals
+    EOrop*                      roptmpreplies;      // used only by the replies, under mtx_roptmpreplies
     EOagent*                    agent;
     EOnvSet*                    nvset;
     EOconfirmationManager*      confmanager;
@@ -113,7 +129,8 @@ struct EOtransmitter_hid
     EOVmutexDerived*            mtx_replies;
     EOVmutexDerived*            mtx_regulars;
     EOVmutexDerived*            mtx_occasionals;
-    EOVmutexDerived*            mtx_roptmp;
+    EOVmutexDerived*            mtx_roptmpoccasionals;  // taken before mtx_occasionals, never after it
+    EOVmutexDerived*            mtx_roptmpreplies;      // taken before mtx_replies, never after it
     uint64_t                    tx_seqnum;
 #if defined(USE_DEBUG_EOTRANSMITTER)    
     EOtransmitterDEBUG_t        debug;
@@ -126,6 +143,8 @@ struct EOtransmitter_hid
     uint8_t                     txdecimationreplies;
     uint8_t                     txdecimationregulars;
     uint8_t                     txdecimationoccasionals;
+    uint8_t                     txdecimationcycledregulars;
+    eOtransmitter_adaptive_t    adaptive;
     uint16_t                    totalsizeofregulars_standard;
     uint16_t                    totalsizeofregulars_cycle0of;
     uint16_t                    totalsizeofregulars_cycle1of;
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// the benchmark of EOlist. it is built twice: bench_list with the pointer-based storage, which is the original one, and
+// bench_list_indexed with EOLIST_USE_INDEXED_STORAGE. for each number of items it prints the ns per operation of:
+// - eo_list_PushBack() of all the items into an empty list,
+// - eo_list_Find() of an item which is not in the list (a full walk), divided by the number of items,
+// - eo_list_Execute() on all the items, divided by the number of items,
+// - eo_list_Erase() of an item in the middle, which checks eo_list_IsIterInside(),
+// - eo_list_PopFront() of all the items,
+// and the footprint of the full list.
+// usage: bench_list [numberofitems]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "EOtheMemoryPool.h"
+#include "EOlist.h"
+
+
+#define BENCH_REPEAT            (2000000)   // the operations on all the items of a list
+
+
+typedef struct
+{
+    uint32_t    key;
+    uint32_t    value;
+    uint32_t    other;
+} bench_item_t;
+
+
+static volatile uint32_t s_sum = 0;
+
+
+static double s_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((double)ts.tv_sec * 1e9 + (double)ts.tv_nsec);
+}
+
+
+static eOresult_t s_match(void *item, void *param)
+{
+    return((((bench_item_t*)item)->key == *((uint32_t*)param)) ? (eores_OK) : (eores_NOK_generic));
+}
+
+
+static void s_execute(void *item, void *param)
+{
+    (void)param;
+    s_sum += ((bench_item_t*)item)->value;
+}
+
+
+static void s_fill(EOlist *list, uint16_t n)
+{
+    bench_item_t item = {0, 0, 0};
+    uint16_t i = 0;
+
+    for(i=0; i<n; i++)
+    {
+        item.key = i;
+        item.value = i;
+        eo_list_PushBack(list, &item);
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    uint16_t n = (argc > 1) ? ((uint16_t)atoi(argv[1])) : (1000);
+    uint32_t rounds = (BENCH_REPEAT / n) + 1;
+    uint32_t missing = 0xffffffff;
+    EOlist *list = NULL;
+    EOlistIter *li = NULL;
+    uint32_t footprint = 0;
+    double push = 0, find = 0, exec = 0, erase = 0, pop = 0;
+    double t = 0;
+    uint32_t r = 0;
+    uint16_t i = 0;
+
+    eo_mempool_Initialise(NULL);
+
+    list = eo_list_New(sizeof(bench_item_t), n, NULL, 0, NULL, NULL);
+
+    for(r=0; r<rounds; r++)
+    {
+        t = s_now_ns();
+        s_fill(list, n);
+        push += s_now_ns() - t;
+
+        if(0 == r)
+        {
+            footprint = eo_list_Footprint(list);
+        }
+
+        t = s_now_ns();
+        s_sum += (NULL == eo_list_Find(list, s_match, &missing)) ? (0) : (1);
+        find += s_now_ns() - t;
+
+        t = s_now_ns();
+        eo_list_Execute(list, s_execute, NULL);
+        exec += s_now_ns() - t;
+
+        // an item in the middle: the iterator is taken outside of the measure
+        for(li=eo_list_Begin(list), i=0; i<n/2; i++)
+        {
+            li = eo_list_Next(list, li);
+        }
+        t = s_now_ns();
+        eo_list_Erase(list, li);
+        erase += s_now_ns() - t;
+
+        t = s_now_ns();
+        while(eobool_false == eo_list_Empty(list))
+        {
+            eo_list_PopFront(list);
+        }
+        pop += s_now_ns() - t;
+    }
+
+#if     defined(EOLIST_USE_INDEXED_STORAGE)
+    printf("indexed storage, %u items:", n);
+#else
+    printf("pointer storage, %u items:", n);
+#endif
+    printf(" push %.1f, find %.2f, execute %.2f, erase %.1f, pop %.1f ns/item, footprint %u bytes\n",
+           push/rounds/n, find/rounds/n, exec/rounds/n, erase/rounds, pop/rounds/(n-1), footprint);
+
+    eo_list_Delete(list);
+
+    return(EXIT_SUCCESS);
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// the benchmark of EOPtheTimerManager with 10k, 50k and 100k timers. for each population it prints: 
+// - the cost of eo_timer_Start() and eo_timer_Stop(),
+// - the expiries per second, with half of the timers periodic and half one-shot, for BENCH_DURATION.
+// - the lateness of the one-shot timers. that of the periodic ones is not measured, because the manager skips the expiries
+//   which it is late for, thus a periodic timer has no expected instant once the pthread has been late.
+// usage: bench_timerman [numberoftimers]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "EOPtheSystem.h"
+#include "EOtimer.h"
+#include "EOaction_hid.h"
+#include "EOVtheSystem.h"
+
+
+#define BENCH_MAXTIMERS         100000
+#define BENCH_DURATION          2000000     // usec
+#define BENCH_MAXPERIOD         500000      // usec
+
+
+static uint32_t s_numberof = 0;
+static EOtimer* s_timers[BENCH_MAXTIMERS];
+static eOabstime_t s_expiry[BENCH_MAXTIMERS];
+static eOreltime_t s_period[BENCH_MAXTIMERS];
+static volatile uint64_t s_expiries = 0;
+static uint64_t s_early = 0;
+static uint64_t s_lateness[4] = {0};        // < 1 ms, < 2 ms, < 10 ms, more
+static eOabstime_t s_maxlateness = 0;
+static double s_start_ns = 0;
+static double s_stop_ns = 0;
+
+
+static double s_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((double)ts.tv_sec * 1e9 + (double)ts.tv_nsec);
+}
+
+
+static void s_onexpiry(void *p)
+{   // only the pthread of the timer manager executes the callbacks, thus the statistics need no lock
+    uint32_t i = (uint32_t)(uintptr_t)p;
+    eOabstime_t now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    eOabstime_t late = 0;
+    
+    s_expiries ++;
+    
+    if(1 == (i & 1))
+    {   // periodic
+        return;
+    }
+    
+    if(now < s_expiry[i])
+    {
+        s_early ++;
+    }
+    else
+    {
+        late = now - s_expiry[i];
+        s_lateness[(late < 1000) ? (0) : ((late < 2000) ? (1) : ((late < 10000) ? (2) : (3)))] ++;
+        s_maxlateness = (late > s_maxlateness) ? (late) : (s_maxlateness);
+    }
+}
+
+
+static void *s_stopper(void *p)
+{
+    (void)p;
+    usleep(BENCH_DURATION);
+    eov_sys_Stop(eov_sys_GetHandle());
+    return(NULL);
+}
+
+
+static void s_init(void)
+{
+    EOaction action;
+    uint32_t i = 0;
+    double t0 = 0;
+    pthread_t thread;
+    
+    srand(1);
+    
+    for(i=0; i<s_numberof; i++)
+    {
+        s_timers[i] = eo_timer_New();
+        s_period[i] = 1000 + rand() % BENCH_MAXPERIOD;
+    }
+    
+    // the cost of the stop is measured on timers which are running, then they all start again for the run
+    t0 = s_now_ns();
+    for(i=0; i<s_numberof; i++)
+    {
+        eo_action_SetCallback(&action, s_onexpiry, (void*)(uintptr_t)i, NULL);
+        s_expiry[i] = eov_sys_LifeTimeGet(eov_sys_GetHandle()) + s_period[i];
+        eo_timer_Start(s_timers[i], eok_abstimeNOW, s_period[i], (i & 1) ? (eo_tmrmode_FOREVER) : (eo_tmrmode_ONESHOT), &action);
+    }
+    s_start_ns = (s_now_ns() - t0) / s_numberof;
+    
+    t0 = s_now_ns();
+    for(i=0; i<s_numberof; i++)
+    {
+        eo_timer_Stop(s_timers[i]);
+    }
+    s_stop_ns = (s_now_ns() - t0) / s_numberof;
+    
+    for(i=0; i<s_numberof; i++)
+    {
+        eo_action_SetCallback(&action, s_onexpiry, (void*)(uintptr_t)i, NULL);
+        s_expiry[i] = eov_sys_LifeTimeGet(eov_sys_GetHandle()) + s_period[i];
+        eo_timer_Start(s_timers[i], eok_abstimeNOW, s_period[i], (i & 1) ? (eo_tmrmode_FOREVER) : (eo_tmrmode_ONESHOT), &action);
+    }
+    
+    pthread_create(&thread, NULL, s_stopper, NULL);
+}
+
+
+int main(int argc, char *argv[])
+{
+    uint64_t total = 0;
+    
+    s_numberof = (argc > 1) ? ((uint32_t)atoi(argv[1])) : (BENCH_MAXTIMERS);
+    if((0 == s_numberof) || (s_numberof > BENCH_MAXTIMERS))
+    {
+        fprintf(stderr, "usage: %s [1 ... %d]\n", argv[0], BENCH_MAXTIMERS);
+        return(EXIT_FAILURE);
+    }
+    
+    eop_sys_Start(eop_sys_Initialise(NULL, NULL, NULL, NULL, NULL), s_init);
+    
+    total = s_lateness[0] + s_lateness[1] + s_lateness[2] + s_lateness[3];
+    printf("timers %6u: start %6.0f ns, stop %6.0f ns, %8.0f expiries/s, one-shots early %llu, late <1ms %5.1f%% <2ms %5.1f%% <10ms %5.1f%% more %5.1f%%, max %llu us\n",
+           s_numberof, s_start_ns, s_stop_ns, (double)s_expiries * 1e6 / BENCH_DURATION, (unsigned long long)s_early,
+           100.0 * s_lateness[0] / total, 100.0 * s_lateness[1] / total, 100.0 * s_lateness[2] / total, 100.0 * s_lateness[3] / total,
+           (unsigned long long)s_maxlateness);
+    
+    return(EXIT_SUCCESS);
+}
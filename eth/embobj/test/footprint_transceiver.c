@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// it prints what eo_transceiver_Footprint_Get() gives for the EOhostTransceiver of a board in some typical configurations:
+// - the board with only the management endpoint (eonvset_BRDcfgBasic), with the std and with the max endpoints,
+// - without protection, with the protection used by a multi-threaded host (eo_trans_protection_enabled and one mutex per
+//   endpoint in the nvset), and with one mutex per NV and the lazy init of the nvset.
+// the sizes are those of eo_hosttransceiver_cfg_default. the memory of the mutexes is not counted, only their number.
+// the mempool column is 0 with the heap of gcc, as eo_common_msize() cannot tell the size of an allocation.
+// usage: footprint_transceiver
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EOtheMemoryPool.h"
+#include "EOPmutex.h"
+#include "EOhostTransceiver.h"
+
+
+typedef struct
+{
+    const char*                 name;
+    const eOnvset_BRDcfg_t*     brdcfg;
+} footprint_board_t;
+
+typedef struct
+{
+    const char*                 name;
+    eOtransceiver_protection_t  transprotection;
+    eOnvset_protection_t        nvsetprotection;
+    eOnvset_initmode_t          nvsetinitmode;
+} footprint_mode_t;
+
+
+static const footprint_board_t s_boards[] =
+{
+    {"basic",   &eonvset_BRDcfgBasic},
+    {"std",     &eonvset_BRDcfgStd},
+    {"max",     &eonvset_BRDcfgMax}
+};
+
+static const footprint_mode_t s_modes[] =
+{
+    {"unprotected, eager",  eo_trans_protection_none,       eo_nvset_protection_none,               eo_nvset_initmode_eager},
+    {"per endpoint, eager", eo_trans_protection_enabled,    eo_nvset_protection_one_per_endpoint,   eo_nvset_initmode_eager},
+    {"per netvar, lazy",    eo_trans_protection_enabled,    eo_nvset_protection_one_per_netvar,     eo_nvset_initmode_lazy}
+};
+
+
+static void s_print(const footprint_board_t *board, const footprint_mode_t *mode)
+{
+    eOhosttransceiver_cfg_t cfg = eo_hosttransceiver_cfg_default;
+    eOtransceiver_footprint_t fp;
+    EOhostTransceiver *host = NULL;
+
+    cfg.nvsetbrdcfg         = board->brdcfg;
+    cfg.mutex_fn_new        = (eov_mutex_fn_mutexderived_new)eop_mutex_New;
+    cfg.transprotection     = mode->transprotection;
+    cfg.nvsetprotection     = mode->nvsetprotection;
+    cfg.nvsetinitmode       = mode->nvsetinitmode;
+
+    host = eo_hosttransceiver_New(&cfg);
+
+    eo_transceiver_Footprint_Get(eo_hosttransceiver_GetTransceiver(host), &fp);
+
+    printf("%-6s %-19s %8u %8u %8u %6u %6u %8u %8u %8u %8u %8u %8u %8u %4u\n", board->name, mode->name,
+           fp.nvset.ram, fp.nvset.descriptors, fp.nvset.layout, fp.nvset.endpoints, fp.nvset.mutexes,
+           fp.transmitter, fp.receiver, fp.proxy, fp.confmanager, fp.others, fp.total, fp.mempool, fp.mutexes);
+
+    eo_hosttransceiver_Delete(host);
+}
+
+
+int main(void)
+{
+    uint32_t b = 0;
+    uint32_t m = 0;
+
+    eo_mempool_Initialise(NULL);
+
+    printf("bytes of the EOhostTransceiver with the default sizes (txpacket %u, rop %u)\n",
+           EOK_HOSTTRANSCEIVER_capacityoftxpacket, EOK_HOSTTRANSCEIVER_capacityofrop);
+    printf("%-6s %-19s %8s %8s %8s %6s %6s %8s %8s %8s %8s %8s %8s %8s %4s\n", "board", "mode",
+           "nv.ram", "nv.descr", "nv.layout", "nv.eps", "nv.mtx",
+           "transm", "receiv", "proxy", "confman", "others", "total", "mempool", "mtx");
+
+    for(b=0; b<sizeof(s_boards)/sizeof(s_boards[0]); b++)
+    {
+        for(m=0; m<sizeof(s_modes)/sizeof(s_modes[0]); m++)
+        {
+            s_print(&s_boards[b], &s_modes[m]);
+        }
+    }
+
+    return(EXIT_SUCCESS);
+}
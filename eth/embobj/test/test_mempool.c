@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// the tests of the slab mode of EOtheMemoryPool.
+// - the blocks left in the cache of a thread which exits go back to the free lists, thus many short threads which
+//   allocate and release the same amount of memory do not take new pages.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "EOtheMemoryPool.h"
+#include "EOPmutex.h"
+
+
+#define TEST_NUMBEROFTHREADS    100
+#define TEST_NUMBEROFBLOCKS     200
+#define TEST_SIZEOFBLOCK        100
+
+
+static int s_failures = 0;
+
+
+static void s_check(int ok, const char *what)
+{
+    printf("%s: %s\n", (ok) ? ("ok  ") : ("FAIL"), what);
+    if(!ok)
+    {
+        s_failures ++;
+    }
+}
+
+
+static void *s_worker(void *p)
+{
+    void *blocks[TEST_NUMBEROFBLOCKS];
+    uint32_t i = 0;
+
+    (void)p;
+
+    for(i=0; i<TEST_NUMBEROFBLOCKS; i++)
+    {
+        blocks[i] = eo_mempool_New(eo_mempool_GetHandle(), TEST_SIZEOFBLOCK);
+    }
+    for(i=0; i<TEST_NUMBEROFBLOCKS; i++)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), blocks[i]);
+    }
+
+    return(NULL);
+}
+
+
+static void s_run_worker(void)
+{
+    pthread_t thread;
+
+    pthread_create(&thread, NULL, s_worker, NULL);
+    pthread_join(thread, NULL);
+}
+
+
+static uint32_t s_pagebytes(void)
+{
+    eOmempool_slabstats_t stats;
+
+    eo_mempool_SlabStats_Get(eo_mempool_GetHandle(), &stats);
+
+    return(stats.pagebytes);
+}
+
+
+static void s_test_threads_exit(void)
+{
+    eOmempool_slabstats_t stats;
+    uint32_t inuse = 0;
+    uint32_t first = 0;
+    uint32_t i = 0;
+    char what[128];
+
+    // the main thread keeps the mutex of the singleton
+    eo_mempool_SlabStats_Get(eo_mempool_GetHandle(), &stats);
+    inuse = stats.inusebytes;
+
+    s_run_worker();
+    first = s_pagebytes();
+
+    for(i=1; i<TEST_NUMBEROFTHREADS; i++)
+    {
+        s_run_worker();
+    }
+
+    eo_mempool_SlabStats_Get(eo_mempool_GetHandle(), &stats);
+
+    snprintf(what, sizeof(what), "%d threads which exit take no more pages than the first one (%u bytes, then %u)", TEST_NUMBEROFTHREADS, first, stats.pagebytes);
+    s_check(first == stats.pagebytes, what);
+    s_check(inuse == stats.inusebytes, "no block of the threads is in use after the threads have released them");
+}
+
+
+int main(void)
+{
+    eOmempool_cfg_t cfg = {eo_mempool_alloc_slab, NULL};
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    eo_mempool_Initialise(&cfg);
+    eo_mempool_SetMutex(eo_mempool_GetHandle(), (EOVmutexDerived*)eop_mutex_New(), eok_reltimeINFINITE);
+
+    s_test_threads_exit();
+
+    return((0 == s_failures) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
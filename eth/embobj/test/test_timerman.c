@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2013 iCub Facility - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// the tests of the timing wheel of EOPtheTimerManager. the source is included so that its static functions can be checked.
+// - a timer in the second level must cascade when the first level turns, also if the first level is empty by then. 
+// - 1000 one-shot timers from 1 ms to 3 s on a 1 ms tick must never fire early and almost always within a few ticks. 
+//   a loaded host can stall a thread for some tens of ms, thus a few of them can be later, but never by a turn of the
+//   first level of the wheel (64 ms), which is what a timer left in an upper level costs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "../core/exec/pthread/EOPtheTimerManager.c"
+
+#include "EOPtheSystem.h"
+#include "EOtimer.h"
+
+
+#define TEST_NUMBEROFTIMERS     1000
+#define TEST_MAXLATENESS        10000       // usec: some ticks plus the scheduling jitter of a host
+#define TEST_MAXLATE            (TEST_NUMBEROFTIMERS/20)    // the timers which can be later, for the stalls of the host
+#define TEST_MAXSTALL           50000       // usec: no timer can be later than that
+
+
+static int s_failures = 0;
+
+static EOtimer* s_timers[TEST_NUMBEROFTIMERS];
+static eOabstime_t s_expiry[TEST_NUMBEROFTIMERS];
+static volatile uint32_t s_fired = 0;
+static uint32_t s_early = 0;
+static uint32_t s_late = 0;
+static eOabstime_t s_maxlateness = 0;
+
+
+static void s_check(int ok, const char *what)
+{
+    printf("%s: %s\n", (ok) ? ("ok  ") : ("FAIL"), what);
+    if(!ok)
+    {
+        s_failures ++;
+    }
+}
+
+
+static void s_test_cascade_at_turn(void)
+{
+    EOPtheTimerManager *tm = &s_eop_thetimermanager;
+    EOPtheTimerManager initial;
+    eOptimerman_node_t node;
+    
+    // the manager is not initialised yet: we use its wheel and then we restore it
+    memcpy(&initial, tm, sizeof(EOPtheTimerManager));
+    memset(tm, 0, sizeof(EOPtheTimerManager));
+    memset(&node, 0, sizeof(node));
+    tm->tickperiod = 1000;
+    tm->base = 100;
+    
+    // tick 170 is 70 ticks ahead: it goes in the second level and cascades at tick 128
+    node.expiry = 170 * 1000;
+    s_eop_timerman_insert(&node);
+    tm->running = 1;
+    s_check((1 == node.level) && (0 == tm->occupied[0]), "a timer 70 ticks ahead waits in the second level");
+
+    // the first level is empty, thus the wheel goes up to the turn and stops there without cascading
+    s_eop_timerman_advance(127);
+    s_check(128 == tm->base, "the wheel stops at the start of the turn");
+    s_check(128 == s_eop_timerman_nexttick(), "the next tick is the start of the turn, where the second level cascades");
+
+    s_eop_timerman_advance(128);
+    s_check(0 == node.level, "the timer cascades into the first level at the turn");
+    s_check(170 == s_eop_timerman_nexttick(), "the next tick is the one of the timer");
+
+    s_eop_timerman_advance(170);
+    s_check(&node == tm->due.head, "the timer expires at its tick");
+    
+    memcpy(tm, &initial, sizeof(EOPtheTimerManager));
+}
+
+
+static void s_onexpiry(void *p)
+{
+    uint32_t i = (uint32_t)(uintptr_t)p;
+    eOabstime_t now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    
+    if(now < s_expiry[i])
+    {
+        s_early ++;
+    }
+    else
+    {
+        s_maxlateness = ((now - s_expiry[i]) > s_maxlateness) ? (now - s_expiry[i]) : (s_maxlateness);
+        s_late += ((now - s_expiry[i]) > TEST_MAXLATENESS) ? (1) : (0);
+    }
+    
+    __sync_fetch_and_add(&s_fired, 1);
+}
+
+
+static void *s_stopper(void *p)
+{
+    (void)p;
+    
+    while(s_fired < TEST_NUMBEROFTIMERS)
+    {
+        usleep(100000);
+    }
+    eov_sys_Stop(eov_sys_GetHandle());
+    
+    return(NULL);
+}
+
+
+static void s_init_oneshots(void)
+{
+    EOaction action;
+    eOreltime_t delay = 0;
+    uint32_t i = 0;
+    pthread_t thread;
+    
+    srand(1);
+    
+    for(i=0; i<TEST_NUMBEROFTIMERS; i++)
+    {
+        delay = 1000 + (rand() % 3000) * 1000;
+        s_timers[i] = eo_timer_New();
+        s_expiry[i] = eov_sys_LifeTimeGet(eov_sys_GetHandle()) + delay;
+        eo_action_SetCallback(&action, s_onexpiry, (void*)(uintptr_t)i, NULL);
+        eo_timer_Start(s_timers[i], eok_abstimeNOW, delay, eo_tmrmode_ONESHOT, &action);
+    }
+    
+    pthread_create(&thread, NULL, s_stopper, NULL);
+}
+
+
+int main(void)
+{
+    char what[128];
+    
+    setvbuf(stdout, NULL, _IONBF, 0);
+    
+    s_test_cascade_at_turn();
+    
+    eop_sys_Start(eop_sys_Initialise(NULL, NULL, NULL, NULL, NULL), s_init_oneshots);
+    
+    s_check(TEST_NUMBEROFTIMERS == s_fired, "all the one-shot timers fire");
+    s_check(0 == s_early, "no one-shot timer fires early");
+    snprintf(what, sizeof(what), "at most %d one-shot timers fire more than %d us late (they are %u)", TEST_MAXLATE, TEST_MAXLATENESS, s_late);
+    s_check(s_late <= TEST_MAXLATE, what);
+    snprintf(what, sizeof(what), "no one-shot timer fires more than %d us late (max lateness %llu us)", TEST_MAXSTALL, (unsigned long long)s_maxlateness);
+    s_check(s_maxlateness <= TEST_MAXSTALL, what);
+    
+    return((0 == s_failures) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}